@@ -1010,4 +1010,18 @@ int DataLoader::LoadBuffer(const char* name, BYTE*& buf, bool null_terminate, bo
 	return 0;
 }
 
+// +--------------------------------------------------------------------+
+
+int DataLoader::MapFile(const char* name, MappedFile& file, bool optional)
+{
+	file.Close();
+
+	if (use_file_system && file.Open(name))
+		return file.GetSize();
+
+	if (!optional)
+		Print("WARNING - DataLoader could not map file '%s'\n", name);
+	return 0;
+}
+
 
@@ -31,28 +31,55 @@ template <class T> class Dictionary
 {
 public:
 	Dictionary();
+	Dictionary(const Dictionary<T>& d);
 	~Dictionary();
 
+	Dictionary<T>& operator=(const Dictionary<T>& d);
+
 	T& operator[](const Text& key);
 
 	void Insert(const Text& key, const T& val);
 	void Remove(const Text& key);
+	void Remove(const char* key);
 
 	void Clear();
+	void Reserve(int n);
 
 	int  Size() const { return items; }
 	int  IsEmpty() const { return !items; }
 
 	int  Contains(const Text& key)         const;
+	int  Contains(const char* key)         const;
 	T    Find(const Text& key, T defval)   const;
+	T    Find(const char* key, T defval)   const;
+	bool Lookup(const Text& key, T& val)   const;
+	bool Lookup(const char* key, T& val)   const;
 
 private:
 	void           Init();
-
-	int            items;
-
-	typedef DictionaryCell<T>* PTR;
-	PTR            table[256];
+	void           Rehash(int newsize);
+	int            Slot(unsigned h)        const;
+	int            FindCell(const Text& key) const;
+	int            FindCell(const char* key) const;
+	void           RemoveCell(int cell);
+
+	// cells are kept densely packed in [0, items) so that iteration
+	// and growth never have to walk empty space.  the open-addressed
+	// slot table maps a (hash, cell) pair to each key, probed linearly
+	// from the hash position and compacted by backward shift on removal:
+
+	struct DictionarySlot {
+		unsigned hash;
+		int      cell;   // -1 when empty
+	};
+
+	int                  items;
+	int                  extent;   // capacity of the cell array
+	int                  mask;     // slot table size - 1
+	int                  shift;    // 32 - log2(slot table size)
+
+	DictionaryCell<T>*   cells;
+	DictionarySlot*      slots;
 
 	friend class DictionaryIter<T>;
 };
@@ -78,8 +105,7 @@ public:
 
 private:
 	Dictionary<T>* dict;
-	DictionaryCell<T>* here;
-	int                  chain;
+	int            here;
 };
 
 // +-------------------------------------------------------------------+
@@ -87,13 +113,13 @@ private:
 template <class T> class DictionaryCell
 {
 public:
-	DictionaryCell(const Text& k) : key(k), value(), next(0) { }
-	DictionaryCell(const Text& k, const T& v) : key(k), value(v), next(0) { }
+	DictionaryCell() : key(), value() { }
+	DictionaryCell(const Text& k) : key(k), value() { }
+	DictionaryCell(const Text& k, const T& v) : key(k), value(v) { }
 	~DictionaryCell() { }
 
 	Text                 key;
 	T                    value;
-	DictionaryCell<T>* next;
 };
 
 #include "Dictionary.inl"
@@ -10,77 +10,200 @@
 
 #define DICT_CHECK(a, b)
 
-const int CHAINS = 256;
+const int DICT_MIN_SLOTS = 16;
 
 // +-------------------------------------------------------------------+
 
 template <class T> Dictionary<T>::Dictionary()
-    : items(0)
+    : items(0), extent(0), mask(0), shift(32), cells(0), slots(0)
 {
     Init();
 }
 
+template <class T> Dictionary<T>::Dictionary(const Dictionary<T>& d)
+    : items(0), extent(0), mask(0), shift(32), cells(0), slots(0)
+{
+    Init();
+    operator=(d);
+}
+
 template <class T> Dictionary<T>::~Dictionary()
 {
     Clear();
 }
 
+template <class T>
+Dictionary<T>& Dictionary<T>::operator=(const Dictionary<T>& d)
+{
+    if (&d != this) {
+        Clear();
+        Reserve(d.items);
+
+        for (int i = 0; i < d.items; i++)
+            Insert(d.cells[i].key, d.cells[i].value);
+    }
+
+    return *this;
+}
+
 // +-------------------------------------------------------------------+
 
 template <class T>
 void Dictionary<T>::Init()
 {
     items = 0;
-    memset(table, 0, CHAINS * sizeof(PTR));
+    extent = 0;
+    mask = 0;
+    shift = 32;
+    cells = 0;
+    slots = 0;
 }
 
 template <class T>
 void Dictionary<T>::Clear()
 {
-    for (int i = 0; i < CHAINS; i++) {
-        DictionaryCell<T>* link = table[i];
+    delete[] cells;
+    delete[] slots;
 
-        while (link) {
-            DictionaryCell<T>* n = link->next;
-            delete link;
-            link = n;
-        }
+    Init();
+}
+
+template <class T>
+void Dictionary<T>::Reserve(int n)
+{
+    if (n > extent) {
+        int size = DICT_MIN_SLOTS;
+
+        // keep the load factor at or below 3/4:
+        while (size - size / 4 < n)
+            size *= 2;
+
+        Rehash(size);
     }
+}
 
-    Init();
+// +-------------------------------------------------------------------+
+
+template <class T>
+void Dictionary<T>::Rehash(int newsize)
+{
+    int bits = 0;
+    while ((1 << bits) < newsize)
+        bits++;
+
+    DictionaryCell<T>* c = new DictionaryCell<T>[newsize - newsize / 4];
+    DictionarySlot*    s = new DictionarySlot[newsize];
+
+    for (int i = 0; i < items; i++)
+        c[i] = cells[i];
+
+    for (int i = 0; i < newsize; i++)
+        s[i].cell = -1;
+
+    delete[] cells;
+    delete[] slots;
+
+    cells = c;
+    slots = s;
+    extent = newsize - newsize / 4;
+    mask = newsize - 1;
+    shift = 32 - bits;
+
+    // the hash cached in each key's TextRep means the keys
+    // never have to be rescanned when the table grows:
+    for (int i = 0; i < items; i++) {
+        unsigned h = cells[i].key.hash();
+        int      n = Slot(h);
+
+        while (slots[n].cell >= 0)
+            n = (n + 1) & mask;
+
+        slots[n].hash = h;
+        slots[n].cell = i;
+    }
 }
 
 // +-------------------------------------------------------------------+
 
 template <class T>
-T& Dictionary<T>::operator[](const Text& key)
+int Dictionary<T>::Slot(unsigned h) const
+{
+    // fibonacci hashing spreads the weak low bits of the text hash
+    // across the whole table:
+    if (shift >= 32)
+        return 0;
+
+    return (int)((h * 2654435769u) >> shift);
+}
+
+template <class T>
+int Dictionary<T>::FindCell(const Text& key) const
 {
-    int idx = key.hash() % CHAINS;
-    DictionaryCell<T>* cell = table[idx];
+    if (!items)
+        return -1;
 
-    if (cell == 0) {  // empty chain
-        items++;
+    unsigned h = key.hash();
+    int      n = Slot(h);
 
-        cell = new DictionaryCell<T>(key);
-        table[idx] = cell;
+    while (slots[n].cell >= 0) {
+        if (slots[n].hash == h && cells[slots[n].cell].key == key)
+            return n;
 
-        return cell->value;
+        n = (n + 1) & mask;
     }
-    else {            // search for key
-        while (cell->next && cell->key != key)
-            cell = cell->next;
 
-        if (cell->key != key) {    // not found in chain
-            items++;
+    return -1;
+}
+
+template <class T>
+int Dictionary<T>::FindCell(const char* key) const
+{
+    if (!items || !key)
+        return -1;
+
+    int      len = (int) ::strlen(key);
+    unsigned h = Text::hashOf(key, len);
+    int      n = Slot(h);
+
+    while (slots[n].cell >= 0) {
+        const Text& k = cells[slots[n].cell].key;
 
-            cell->next = new DictionaryCell<T>(key);
+        if (slots[n].hash == h && k.length() == len && k == key)
+            return n;
 
-            return cell->next->value;
-        }
-        else {         // found: return it!
-            return cell->value;
-        }
+        n = (n + 1) & mask;
     }
+
+    return -1;
+}
+
+// +-------------------------------------------------------------------+
+
+template <class T>
+T& Dictionary<T>::operator[](const Text& key)
+{
+    int n = FindCell(key);
+
+    if (n >= 0)
+        return cells[slots[n].cell].value;
+
+    if (items >= extent)
+        Rehash(extent ? (mask + 1) * 2 : DICT_MIN_SLOTS);
+
+    unsigned h = key.hash();
+    n = Slot(h);
+
+    while (slots[n].cell >= 0)
+        n = (n + 1) & mask;
+
+    DictionaryCell<T>& cell = cells[items];
+    cell.key = key;
+    cell.value = T();
+
+    slots[n].hash = h;
+    slots[n].cell = items++;
+
+    return cell.value;
 }
 
 // +-------------------------------------------------------------------+
@@ -96,33 +219,64 @@ void Dictionary<T>::Insert(const Text& key, const T& val)
 template <class T>
 void Dictionary<T>::Remove(const Text& key)
 {
-    int idx = key.hash() % CHAINS;
-    DictionaryCell<T>* cell = table[idx];
+    int n = FindCell(key);
+
+    if (n >= 0)
+        RemoveCell(n);
+}
+
+template <class T>
+void Dictionary<T>::Remove(const char* key)
+{
+    int n = FindCell(key);
+
+    if (n >= 0)
+        RemoveCell(n);
+}
+
+template <class T>
+void Dictionary<T>::RemoveCell(int n)
+{
+    int cell = slots[n].cell;
+
+    // backward shift deletion: pull later members of the probe run
+    // into the hole so that lookups never need tombstones:
+    int i = n;
+    int j = n;
 
-    if (cell == 0) {  // empty chain
-        return;
+    slots[i].cell = -1;
+
+    for (;;) {
+        j = (j + 1) & mask;
+
+        if (slots[j].cell < 0)
+            break;
+
+        int k = Slot(slots[j].hash);
+
+        if (i <= j ? (i < k && k <= j) : (i < k || k <= j))
+            continue;
+
+        slots[i] = slots[j];
+        slots[j].cell = -1;
+        i = j;
     }
-    else {            // search for key
-        while (cell->next && cell->key != key)
-            cell = cell->next;
-
-        if (cell->key != key) {    // not found in chain
-            return;
-        }
-        else {         // found: remove it!
-            if (table[idx] == cell) {
-                table[idx] = cell->next;
-                delete cell;
-            }
-            else {
-                DictionaryCell<T>* p = table[idx];
-                while (p->next != cell)
-                    p = p->next;
-                p->next = cell->next;
-                delete cell;
-            }
-        }
+
+    // move the last cell down into the vacated cell:
+    int last = items - 1;
+
+    if (cell != last) {
+        cells[cell] = cells[last];
+
+        int s = Slot(cells[cell].key.hash());
+        while (slots[s].cell != last)
+            s = (s + 1) & mask;
+
+        slots[s].cell = cell;
     }
+
+    cells[last] = DictionaryCell<T>();
+    items--;
 }
 
 // +-------------------------------------------------------------------+
@@ -130,18 +284,13 @@ void Dictionary<T>::Remove(const Text& key)
 template <class T>
 int Dictionary<T>::Contains(const Text& key) const
 {
-    int idx = key.hash() % CHAINS;
-    DictionaryCell<T>* cell = table[idx];
-
-    if (cell != 0) {
-        while (cell->next && cell->key != key)
-            cell = cell->next;
-
-        if (cell->key == key)
-            return 1;
-    }
+    return FindCell(key) >= 0;
+}
 
-    return 0;
+template <class T>
+int Dictionary<T>::Contains(const char* key) const
+{
+    return FindCell(key) >= 0;
 }
 
 // +-------------------------------------------------------------------+
@@ -149,24 +298,55 @@ int Dictionary<T>::Contains(const Text& key) const
 template <class T>
 T Dictionary<T>::Find(const Text& key, T defval) const
 {
-    int idx = key.hash() % CHAINS;
-    DictionaryCell<T>* cell = table[idx];
+    int n = FindCell(key);
 
-    if (cell != 0) {
-        while (cell->next && cell->key != key)
-            cell = cell->next;
+    if (n >= 0)
+        return cells[slots[n].cell].value;
 
-        if (cell->key == key)
-            return cell->value;
-    }
+    return defval;
+}
+
+template <class T>
+T Dictionary<T>::Find(const char* key, T defval) const
+{
+    int n = FindCell(key);
+
+    if (n >= 0)
+        return cells[slots[n].cell].value;
 
     return defval;
 }
 
+template <class T>
+bool Dictionary<T>::Lookup(const Text& key, T& val) const
+{
+    int n = FindCell(key);
+
+    if (n >= 0) {
+        val = cells[slots[n].cell].value;
+        return true;
+    }
+
+    return false;
+}
+
+template <class T>
+bool Dictionary<T>::Lookup(const char* key, T& val) const
+{
+    int n = FindCell(key);
+
+    if (n >= 0) {
+        val = cells[slots[n].cell].value;
+        return true;
+    }
+
+    return false;
+}
+
 // +-------------------------------------------------------------------+
 
 template <class T> DictionaryIter<T>::DictionaryIter(Dictionary<T>& d)
-    : dict(&d), chain(0), here(0)
+    : dict(&d), here(-1)
 { }
 
 template <class T> DictionaryIter<T>::~DictionaryIter()
@@ -177,8 +357,7 @@ template <class T> DictionaryIter<T>::~DictionaryIter()
 template <class T>
 void DictionaryIter<T>::reset()
 {
-    chain = 0;
-    here = 0;
+    here = -1;
 }
 
 // +-------------------------------------------------------------------+
@@ -186,13 +365,13 @@ void DictionaryIter<T>::reset()
 template <class T>
 Text DictionaryIter<T>::key() const
 {
-    return here->key;
+    return dict->cells[here].key;
 }
 
 template <class T>
 T DictionaryIter<T>::value() const
 {
-    return here->value;
+    return dict->cells[here].value;
 }
 
 // +-------------------------------------------------------------------+
@@ -201,7 +380,7 @@ template <class T>
 int DictionaryIter<T>::operator++()
 {
     forth();
-    int more = chain < CHAINS;
+    int more = here < dict->items;
     return more;
 }
 
@@ -210,21 +389,8 @@ int DictionaryIter<T>::operator++()
 template <class T>
 void DictionaryIter<T>::forth()
 {
-    if (here) {
-        here = here->next;
-        if (!here) // off the end of this chain
-            chain++;
-    }
-
-    if (!here) {
-        while (!dict->table[chain] && chain < CHAINS)
-            chain++;
-
-        if (chain < CHAINS)
-            here = dict->table[chain];
-        else
-            here = 0;
-    }
+    if (here < dict->items)
+        here++;
 }
 
 // +-------------------------------------------------------------------+
@@ -244,4 +410,3 @@ Dictionary<T>& DictionaryIter<T>::container()
     return *dict;
 }
 
-
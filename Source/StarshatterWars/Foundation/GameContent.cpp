@@ -13,6 +13,11 @@
 Text
 GameContent::GetText(const char* key) const
 {
-	return ContentValues.Find(key, Text(key));
+	Text value;
+
+	if (ContentValues.Lookup(key, value))
+		return value;
+
+	return Text(key);
 }
 
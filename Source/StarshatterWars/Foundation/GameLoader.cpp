@@ -64,8 +64,7 @@ void AGameLoader::InitializeGame()
 	UUniverse* Universe;
 	Universe = NewObject<UUniverse>();
 
-	USim* Sim;
-	Sim = NewObject<USim>();
+	Sim = NewObject<USim>(this);
 
 	//UCampaign::Initialize();
 }
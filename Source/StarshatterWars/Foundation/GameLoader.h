@@ -15,6 +15,8 @@
 #include "../Foundation/DataLoader.h"
 #include "GameLoader.generated.h"
 
+class USim;
+
 /**
  * 
  */
@@ -39,4 +41,9 @@ public:
 	void InitializeGame();
 
 	static DataLoader* loader;
+
+protected:
+	// the game's sim, held here so it is not collected while it ticks:
+	UPROPERTY()
+	USim* Sim;
 };
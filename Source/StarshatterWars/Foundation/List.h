@@ -27,8 +27,15 @@ template <class T> class STARSHATTERWARS_API List
 public:
 	List() : items(0), extent(0), array(0) { }
 	List(const List<T>& l);
+	List(List<T>&& l) : items(l.items), extent(l.extent), array(l.array)
+	{
+		l.items = 0; l.extent = 0; l.array = 0;
+	}
 	~List() { delete[] array; }
 
+	List<T>& operator=(const List<T>& l);
+	List<T>& operator=(List<T>&& l);
+
 	T*& operator[](int i);
 	T* operator[](int i) const;
 	T*& at(int i);
@@ -37,6 +44,10 @@ public:
 	void     append(List<T>& list);
 	void     append(const T* val);
 	void     insert(const T* val, int index = 0);
+
+	// the list must already be sorted, as it is when every item went
+	// in through insertSort().  the slot is found by binary search,
+	// after any items that compare equal:
 	void     insertSort(const T* val);
 
 	T* first()   const { return operator[](0); }
@@ -48,8 +59,12 @@ public:
 	void     destroy();
 
 	int      size()    const { return items; }
+	int      capacity() const { return extent; }
 	bool     isEmpty() const { return !items; }
 
+	void     reserve(int n);
+	void     shrink_to_fit();
+
 	bool     contains(const T* val) const;
 	int      count(const T* val)    const;
 	int      index(const T* val)    const;
@@ -17,12 +17,49 @@ void Print(const char* fmt, ...);
 
 template <class T>
 List<T>::List(const List<T>& l)
-    : items(l.items), extent(l.extent)
+    : items(l.items), extent(l.extent), array(0)
 {
-    array = new PTR[extent];
+    if (extent) {
+        array = new PTR[extent];
+        memcpy(array, l.array, extent * sizeof(PTR));
+    }
+}
+
+template <class T>
+List<T>& List<T>::operator=(const List<T>& l)
+{
+    if (&l != this) {
+        PTR* v = 0;
 
-    for (int i = 0; i < extent; i++)
-        array[i] = l.array[i];
+        if (l.extent) {
+            v = new PTR[l.extent];
+            memcpy(v, l.array, l.extent * sizeof(PTR));
+        }
+
+        delete[] array;
+        array  = v;
+        items  = l.items;
+        extent = l.extent;
+    }
+
+    return *this;
+}
+
+template <class T>
+List<T>& List<T>::operator=(List<T>&& l)
+{
+    if (&l != this) {
+        delete[] array;
+        array  = l.array;
+        items  = l.items;
+        extent = l.extent;
+
+        l.array  = 0;
+        l.items  = 0;
+        l.extent = 0;
+    }
+
+    return *this;
 }
 
 template <class T>
@@ -116,19 +153,46 @@ template <class T>
 void List<T>::resize(int newsize)
 {
     if (newsize > extent) {
-        extent = 16 * (newsize / 16 + 1);
+        // grow geometrically so that a run of appends is amortized O(1):
+        int grow = extent + extent / 2;
+        if (grow < 16)      grow = 16;
+        if (grow < newsize) grow = newsize;
+
+        reserve(grow);
+    }
+}
+
+template <class T>
+void List<T>::reserve(int n)
+{
+    if (n > extent) {
+        PTR* v = new PTR[n];
+
+        if (items)
+            memcpy(v, array, items * sizeof(PTR));
 
-     T** v = new PTR[extent];
+        memset(v + items, 0, (n - items) * sizeof(PTR));
 
-        int i;
-        for (i = 0; i < items; i++)
-            v[i] = array[i];
+        delete[] array;
+        array = v;
+        extent = n;
+    }
+}
 
-        for (; i < extent; i++)
-            v[i] = 0;
+template <class T>
+void List<T>::shrink_to_fit()
+{
+    if (extent > items) {
+        PTR* v = 0;
+
+        if (items) {
+            v = new PTR[items];
+            memcpy(v, array, items * sizeof(PTR));
+        }
 
         delete[] array;
         array = v;
+        extent = items;
     }
 }
 
@@ -150,8 +214,8 @@ void List<T>::append(List<T>& list)
         int need = items + list.items;
         if (need > extent) resize(need);
 
-        for (int i = 0; i < list.items; i++)
-            array[items++] = list.array[i];
+        memcpy(array + items, list.array, list.items * sizeof(PTR));
+        items = need;
     }
 }
 
@@ -164,8 +228,8 @@ void List<T>::insert(const T* item, int index)
         if (items + 1 > extent) resize(items + 1);
 
         // slide right:
-        for (int i = items; i > index; i--)
-            array[i] = array[i - 1];
+        if (index < items)
+            memmove(array + index + 1, array + index, (items - index) * sizeof(PTR));
 
         array[index] = (T*)item;
         items++;
@@ -178,13 +242,22 @@ template <class T>
 void List<T>::insertSort(const T* item)
 {
     if (item) {
-        int i;
-        for (i = 0; i < items; i++) {
-            if (*item < *array[i])
-                break;
+        // binary search for the first element that sorts after item,
+        // so equal elements keep their insertion order.  on a sorted
+        // list this is the slot the old linear scan found:
+        int lo = 0;
+        int hi = items;
+
+        while (lo < hi) {
+            int mid = (lo + hi) / 2;
+
+            if (*item < *array[mid])
+                hi = mid;
+            else
+                lo = mid + 1;
         }
 
-        insert(item, i);
+        insert(item, lo);
     }
 }
 
@@ -217,8 +290,8 @@ T* List<T>::removeIndex(int index)
     array[index] = 0;
 
     // slide left:
-    for (int i = index; i < items - 1; i++)
-        array[i] = array[i + 1];
+    if (index < items - 1)
+        memmove(array + index, array + index + 1, (items - index - 1) * sizeof(PTR));
 
     // blank out the hole we just created:
     array[items - 1] = 0;
@@ -0,0 +1,194 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         MappedFile.cpp
+	AUTHOR:       Carlos Bott
+*/
+
+
+#include "MappedFile.h"
+#include <stdio.h>
+#include <limits.h>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define MAPPED_FILE_POSIX
+#endif
+
+// +--------------------------------------------------------------------+
+
+MappedFile::MappedFile()
+	: data(0), size(0), mapped(false), buffer(0), view(0), extent(0), handle(0)
+{ }
+
+MappedFile::MappedFile(const char* filename)
+	: data(0), size(0), mapped(false), buffer(0), view(0), extent(0), handle(0)
+{
+	Open(filename);
+}
+
+MappedFile::~MappedFile()
+{
+	Close();
+}
+
+// +--------------------------------------------------------------------+
+
+bool
+MappedFile::Open(const char* filename)
+{
+	Close();
+
+	if (!filename || !*filename)
+		return false;
+
+	if (Map(filename))
+		return true;
+
+	return Read(filename);
+}
+
+void
+MappedFile::Close()
+{
+#if defined(_WIN32)
+	if (view)
+		::UnmapViewOfFile(view);
+
+	if (handle)
+		::CloseHandle((HANDLE)handle);
+#elif defined(MAPPED_FILE_POSIX)
+	if (view)
+		::munmap(view, extent);
+#endif
+
+	delete[] buffer;
+
+	data = 0;
+	size = 0;
+	mapped = false;
+	buffer = 0;
+	view = 0;
+	extent = 0;
+	handle = 0;
+}
+
+// +--------------------------------------------------------------------+
+// A mapping is only usable as a null terminated block when the file
+// does not end exactly on a page boundary: the OS zero fills the tail
+// of the last page, which supplies the terminator for free.  Files
+// that do fill their last page (and empty files) use the fallback.
+
+bool
+MappedFile::Map(const char* filename)
+{
+#if defined(_WIN32)
+	HANDLE file = ::CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, 0,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, 0);
+
+	if (file == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER len;
+	SYSTEM_INFO   info;
+	::GetSystemInfo(&info);
+
+	if (!::GetFileSizeEx(file, &len) || len.QuadPart < 1 || len.QuadPart > INT_MAX ||
+		(len.QuadPart % info.dwPageSize) == 0) {
+		::CloseHandle(file);
+		return false;
+	}
+
+	HANDLE map = ::CreateFileMappingA(file, 0, PAGE_READONLY, 0, 0, 0);
+	::CloseHandle(file);   // the mapping keeps the file open
+
+	if (!map)
+		return false;
+
+	void* base = ::MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0);
+
+	if (!base) {
+		::CloseHandle(map);
+		return false;
+	}
+
+	view = base;
+	extent = (size_t)len.QuadPart;
+	handle = map;
+	data = (const char*)base;
+	size = (int)len.QuadPart;
+	mapped = true;
+	return true;
+
+#elif defined(MAPPED_FILE_POSIX)
+	int fd = ::open(filename, O_RDONLY);
+
+	if (fd < 0)
+		return false;
+
+	struct stat st;
+	long page = ::sysconf(_SC_PAGESIZE);
+
+	if (::fstat(fd, &st) != 0 || st.st_size < 1 || st.st_size > INT_MAX ||
+		(page > 0 && (st.st_size % page) == 0)) {
+		::close(fd);
+		return false;
+	}
+
+	void* base = ::mmap(0, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	::close(fd);   // the mapping keeps the file open
+
+	if (base == MAP_FAILED)
+		return false;
+
+#if defined(MADV_SEQUENTIAL)
+	::madvise(base, (size_t)st.st_size, MADV_SEQUENTIAL);
+#endif
+
+	view = base;
+	extent = (size_t)st.st_size;
+	data = (const char*)base;
+	size = (int)st.st_size;
+	mapped = true;
+	return true;
+
+#else
+	return false;
+#endif
+}
+
+// +--------------------------------------------------------------------+
+
+bool
+MappedFile::Read(const char* filename)
+{
+	FILE* f = ::fopen(filename, "rb");
+
+	if (!f)
+		return false;
+
+	::fseek(f, 0, SEEK_END);
+	long len = ::ftell(f);
+	::fseek(f, 0, SEEK_SET);
+
+	if (len < 0) {
+		::fclose(f);
+		return false;
+	}
+
+	buffer = new char[len + 1];
+	size = (int) ::fread(buffer, 1, len, f);
+	buffer[size] = 0;
+
+	::fclose(f);
+
+	data = buffer;
+	return true;
+}
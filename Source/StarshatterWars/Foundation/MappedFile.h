@@ -0,0 +1,59 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         MappedFile.h
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Read-only view of a whole file.  The file is memory mapped where
+	the platform allows it (Win32 file mapping, POSIX mmap), and read
+	into a private buffer otherwise.  Either way the contents are
+	followed by a null terminator, so the view can be handed straight
+	to a BlockReader and tokenized in place by the Scanner.
+
+	The view is released when the MappedFile is closed or destroyed.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// +--------------------------------------------------------------------+
+
+class STARSHATTERWARS_API MappedFile
+{
+public:
+	static const char* TYPENAME() { return "MappedFile"; }
+
+	MappedFile();
+	MappedFile(const char* filename);
+	~MappedFile();
+
+	bool        Open(const char* filename);
+	void        Close();
+
+	bool        IsOpen()   const { return data != 0; }
+	bool        IsMapped() const { return mapped; }
+
+	const char* GetData()  const { return data; }
+	int         GetSize()  const { return size; }
+
+private:
+	MappedFile(const MappedFile&);
+	MappedFile& operator=(const MappedFile&);
+
+	bool        Map(const char* filename);
+	bool        Read(const char* filename);
+
+	const char* data;
+	int         size;
+	bool        mapped;
+
+	char*       buffer;   // fallback copy, when the file can't be mapped
+	void*       view;     // base of the mapped view
+	size_t      extent;   // length of the mapped view
+	void*       handle;   // platform file mapping handle
+};
@@ -0,0 +1,120 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         ObjectPool.cpp
+	AUTHOR:       Carlos Bott
+*/
+
+
+#include "ObjectPool.h"
+#include <new>
+
+// +--------------------------------------------------------------------+
+
+static const size_t POOL_ALIGN = 16;
+
+static size_t
+AlignUp(size_t n)
+{
+	return (n + POOL_ALIGN - 1) & ~(POOL_ALIGN - 1);
+}
+
+// every slot, and the link at the head of every block, is rounded
+// up to the same alignment the heap would give:
+static size_t HeaderSize()  { return AlignUp(2 * sizeof(void*)); }
+
+// +--------------------------------------------------------------------+
+
+ObjectPool::ObjectPool(size_t object_size, int slots)
+	: slot_size(HeaderSize() + AlignUp(object_size)),
+	  per_block(slots > 0 ? slots : 1),
+	  block(0), free_list(0), allocs(0), blocks(0), live(0)
+{ }
+
+ObjectPool::~ObjectPool()
+{
+	while (block) {
+		void* next = *(void**) block;
+		::operator delete(block);
+		block = next;
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+void*
+ObjectPool::New(ObjectPool* pool, size_t size)
+{
+	Slot* slot = 0;
+
+	if (pool && HeaderSize() + size <= pool->slot_size) {
+		slot = (Slot*) pool->Alloc();
+		slot->pool = pool;
+	}
+	else {
+		slot = (Slot*) ::operator new(HeaderSize() + size);
+		slot->pool = 0;
+	}
+
+	slot->next = 0;
+	return (char*) slot + HeaderSize();
+}
+
+void
+ObjectPool::Delete(void* p)
+{
+	if (!p) return;
+
+	Slot* slot = (Slot*) ((char*) p - HeaderSize());
+
+	if (slot->pool)
+		slot->pool->Free(slot);
+	else
+		::operator delete(slot);
+}
+
+// +--------------------------------------------------------------------+
+
+void*
+ObjectPool::Alloc()
+{
+	if (!free_list)
+		Grow();
+
+	Slot* slot = free_list;
+	free_list  = slot->next;
+
+	allocs++;
+	live++;
+	return slot;
+}
+
+void
+ObjectPool::Free(Slot* slot)
+{
+	slot->next = free_list;
+	free_list  = slot;
+	live--;
+}
+
+void
+ObjectPool::Grow()
+{
+	char* mem = (char*) ::operator new(POOL_ALIGN + slot_size * per_block);
+
+	*(void**) mem = block;
+	block = mem;
+	blocks++;
+
+	// thread the new slots onto the free list in address order:
+	char* first = mem + POOL_ALIGN;
+
+	for (int i = per_block - 1; i >= 0; i--) {
+		Slot* slot = (Slot*) (first + i * slot_size);
+		slot->pool = this;
+		slot->next = free_list;
+		free_list  = slot;
+	}
+}
@@ -0,0 +1,68 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         ObjectPool.h
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Free list allocator for small objects of one size that are created
+	and destroyed in bulk, over and over.  Slots are cut from blocks
+	that stay with the pool, so once a pool has grown to the size of a
+	pass, later passes allocate nothing from the heap.
+
+	A class opts in with operator new(size_t, ObjectPool*) calling
+	ObjectPool::New, and operator delete calling ObjectPool::Delete.
+	Each slot records the pool that owns it, so "delete obj" and
+	List::destroy() work unchanged, and objects made with a null pool
+	come from the heap as before.  A pool is not thread safe; it must
+	only be used by one thread at a time, and it must outlive every
+	object allocated from it.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// +--------------------------------------------------------------------+
+
+class STARSHATTERWARS_API ObjectPool
+{
+public:
+	static const char* TYPENAME() { return "ObjectPool"; }
+
+	ObjectPool(size_t object_size, int slots_per_block = 256);
+	~ObjectPool();
+
+	static void* New(ObjectPool* pool, size_t size);
+	static void  Delete(void* p);
+
+	int         NumAllocs() const { return allocs; }   // objects handed out
+	int         NumBlocks() const { return blocks; }   // heap allocations
+	int         NumLive()   const { return live; }
+
+private:
+	ObjectPool(const ObjectPool&);
+	ObjectPool& operator=(const ObjectPool&);
+
+	struct Slot {
+		ObjectPool* pool;        // zero for objects on the heap
+		Slot*       next;        // free list link while unused
+	};
+
+	void*       Alloc();
+	void        Free(Slot* slot);
+	void        Grow();
+
+	size_t      slot_size;
+	int         per_block;
+
+	void*       block;           // newest block, linked to older ones
+	Slot*       free_list;
+
+	int         allocs;
+	int         blocks;
+	int         live;
+};
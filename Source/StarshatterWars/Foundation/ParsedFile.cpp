@@ -0,0 +1,78 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         ParsedFile.cpp
+	AUTHOR:       Carlos Bott
+*/
+
+
+#include "ParsedFile.h"
+#include "Parser.h"
+#include "Reader.h"
+
+// +--------------------------------------------------------------------+
+
+ParsedFile::ParsedFile()
+	: next(0), loaded(false), clean(false)
+{ }
+
+ParsedFile::ParsedFile(const char* fname)
+	: filename(fname), next(0), loaded(false), clean(false)
+{ }
+
+ParsedFile::~ParsedFile()
+{
+	Clear();
+}
+
+// +--------------------------------------------------------------------+
+
+void
+ParsedFile::Clear()
+{
+	// terms before 'next' now belong to whoever asked for them:
+	for (int i = next; i < terms.size(); i++)
+		delete terms[i];
+
+	terms.clear();
+	arena.Reset();
+	next   = 0;
+	loaded = false;
+	clean  = false;
+}
+
+// +--------------------------------------------------------------------+
+
+void
+ParsedFile::Parse(const char* block, int len)
+{
+	Clear();
+
+	if (!block)
+		return;
+
+	Parser parser(new BlockReader(block, len), &arena);
+	Term*  term = parser.ParseTerm();
+
+	while (term) {
+		terms.append(term);
+		term = parser.ParseTerm();
+	}
+
+	// a syntax error ends the parse early, keeping what came before:
+	loaded = true;
+	clean  = parser.NumErrors() == 0 && parser.AtEnd();
+}
+
+// +--------------------------------------------------------------------+
+
+Term*
+ParsedFile::ParseTerm()
+{
+	if (next < terms.size())
+		return terms[next++];
+
+	return 0;
+}
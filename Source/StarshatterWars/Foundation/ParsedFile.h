@@ -0,0 +1,70 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         ParsedFile.h
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	The top level terms of one definition file, parsed ahead of time.
+	ParseTerm() hands the terms back in file order with the same
+	ownership rules as Parser::ParseTerm(), so a loader written
+	against a Parser can consume a ParsedFile unchanged.  This lets
+	the file be read and parsed on a worker thread while the terms are
+	interpreted later on the calling thread.
+
+	The terms are allocated from the file's own TermArena.  Terms that
+	ParseTerm() hands out may be deleted as usual, but must not be kept
+	past the lifetime of the ParsedFile (or its next Parse or Clear).
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Types.h"
+#include "List.h"
+#include "Text.h"
+#include "Term.h"
+#include "TermArena.h"
+
+// +--------------------------------------------------------------------+
+
+class STARSHATTERWARS_API ParsedFile
+{
+public:
+	static const char* TYPENAME() { return "ParsedFile"; }
+
+	ParsedFile();
+	ParsedFile(const char* filename);
+	~ParsedFile();
+
+	void        Parse(const char* block, int len = 0);
+	void        Clear();
+
+	// next top level term, owned by the caller; zero at end of file:
+	Term*       ParseTerm();
+
+	const char* GetFilename() const { return filename; }
+	bool        IsLoaded()    const { return loaded; }
+	bool        IsClean()     const { return clean; }   // loaded without syntax errors
+	int         NumTerms()    const { return terms.size(); }
+
+	// direct access for TermCache, valid until ParseTerm() is called:
+	Term*       GetTerm(int i) const { return terms[i]; }
+	void        AppendTerm(Term* t)  { if (t) terms.append(t); }
+	void        SetLoaded()          { loaded = true; clean = true; }
+	TermArena*  GetArena()           { return &arena; }
+
+private:
+	ParsedFile(const ParsedFile&);
+	ParsedFile& operator=(const ParsedFile&);
+
+	Text        filename;
+	TermArena   arena;
+	List<Term>  terms;
+	int         next;
+	bool        loaded;
+	bool        clean;
+};
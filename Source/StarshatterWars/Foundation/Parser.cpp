@@ -12,12 +12,11 @@
 #include "reader.h"
 #include "token.h"
 #include "parser.h"
+#include "TermArena.h"
 #include <stdio.h>
 #include <stdlib.h>
 
 
-enum KEYS { KEY_TRUE, KEY_FALSE, KEY_DEF, KEY_MINUS };
-
 void Print(const char* fmt, ...);
 
 static int dump_tokens = 0;
@@ -26,7 +25,7 @@ static int dump_tokens = 0;
 
 Term* error(char* msg, const Token& token)
 {
-    static char buf[1024];
+    char buf[1024];
     sprintf_s(buf, " near '%s' in line %d.", (const char*)token.symbol(), token.line());
 
     return error(msg, buf);
@@ -34,15 +33,31 @@ Term* error(char* msg, const Token& token)
 
 // +-------------------------------------------------------------------+
 
-Parser::Parser(Reader* r)
+static bool AddParserKeys()
+{
+    Token::addKey("true", Parser::KEY_TRUE);
+    Token::addKey("false", Parser::KEY_FALSE);
+    Token::addKey(":", Parser::KEY_DEF);
+    Token::addKey("-", Parser::KEY_MINUS);
+    return true;
+}
+
+void
+Parser::AddKeys()
+{
+    // register the keywords once, so that parsers running on
+    // worker threads never write to the shared key map:
+    static bool keys = AddParserKeys();
+    (void) keys;
+}
+
+Parser::Parser(Reader* r, TermArena* a)
+    : arena(a), errors(0)
 {
+    AddKeys();
+
     reader = r ? r : new ConsoleReader;
     lexer = new Scanner(reader);
-
-    Token::addKey("true", KEY_TRUE);
-    Token::addKey("false", KEY_FALSE);
-    Token::addKey(":", KEY_DEF);
-    Token::addKey("-", KEY_MINUS);
 }
 
 Parser::~Parser()
@@ -77,7 +92,7 @@ Parser::ParseTermRest(Term* base)
         // concatenate adjacent string literal tokens:
         TermText* text = base->isText();
         if (text) {
-            TermText* base2 = new TermText(text->value() + t.symbol()(1, t.symbol().length() - 2));
+            TermText* base2 = new(arena) TermText(text->value() + t.symbol()(1, t.symbol().length() - 2));
             delete base;
             return ParseTermRest(base2);
         }
@@ -91,9 +106,10 @@ Parser::ParseTermRest(Term* base)
         switch (t.key()) {
         case KEY_DEF:
             if (base->isText())
-                return new TermDef(base->isText(), ParseTerm());
+                return new(arena) TermDef(base->isText(), ParseTerm());
             else {
                 UE_LOG(LogTemp, Log, TEXT("(Parse) illegal lhs in def"));
+                errors++;
             }
  
         default:
@@ -106,6 +122,15 @@ Parser::ParseTermRest(Term* base)
     return base;
 }
 
+bool
+Parser::AtEnd()
+{
+    Token t = lexer->Get();
+    lexer->PutBack();
+
+    return t.type() == Token::EOT;
+}
+
 static int xtol(const char* p)
 {
     int n = 0;
@@ -127,99 +152,81 @@ static int xtol(const char* p)
     return n;
 }
 
-Term*
-Parser::ParseTermBase()
+double
+Parser::NumberValue(const Token& t, bool negative)
 {
-    Token    t = lexer->Get();
-    int      n = 0;
-    double   d = 0.0;
+    Text     s = t.symbol();
+    char nstr[256], * p = nstr;
 
-    switch (t.type()) {
-    case Token::IntLiteral: {
-        if (dump_tokens)
-            Print("%s", t.symbol().data());
+    for (int i = 0; i < (int)s.length() && p < nstr + sizeof(nstr) - 1; i++)
+        if (s[i] != '_')
+            *p++ = s[i];
+    *p++ = '\0';
+
+    if (t.type() == Token::FloatLiteral)
+        return negative ? -1.0 * atof(nstr) : atof(nstr);
 
-        char nstr[256], * p = nstr;
-        for (int i = 0; i < (int)t.symbol().length(); i++)
-            if (t.symbol()[i] != '_')
-                *p++ = t.symbol()[i];
-        *p++ = '\0';
+    int n = 0;
 
-        // handle hex notation:
-        if (nstr[1] == 'x')
-            n = xtol(nstr + 2);
+    // handle hex notation (positive literals only):
+    if (negative)
+        n = -1 * atol(nstr);
 
-        else
-            n = atol(nstr);
+    else if (nstr[1] == 'x')
+        n = xtol(nstr + 2);
 
-        return new TermNumber(n);
-    }
+    else
+        n = atol(nstr);
+
+    return n;
+}
+
+Term*
+Parser::ParseTermBase()
+{
+    Token    t = lexer->Get();
 
-    case Token::FloatLiteral: {
+    switch (t.type()) {
+    case Token::IntLiteral:
+    case Token::FloatLiteral:
         if (dump_tokens)
             Print("%s", t.symbol().data());
 
-        char nstr[256], * p = nstr;
-        for (int i = 0; i < (int)t.symbol().length(); i++)
-            if (t.symbol()[i] != '_')
-                *p++ = t.symbol()[i];
-        *p++ = '\0';
-
-        d = atof(nstr);
-        return new TermNumber(d);
-    }
+        return new(arena) TermNumber(NumberValue(t));
 
     case Token::StringLiteral:
         if (dump_tokens)
             Print("%s", t.symbol().data());
 
-        return new TermText(t.symbol()(1, t.symbol().length() - 2));
+        return new(arena) TermText(t.symbol()(1, t.symbol().length() - 2));
 
     case Token::AlphaIdent:
         if (dump_tokens)
             Print("%s", t.symbol().data());
 
-        return new TermText(t.symbol());
+        return new(arena) TermText(t.symbol(), t.sym());
 
     case Token::Keyword:
         if (dump_tokens)
             Print("%s", t.symbol().data());
 
         switch (t.key()) {
-        case KEY_FALSE:   return new TermBool(0);
-        case KEY_TRUE:    return new TermBool(1);
+        case KEY_FALSE:   return new(arena) TermBool(0);
+        case KEY_TRUE:    return new(arena) TermBool(1);
 
         case KEY_MINUS: {
             Token next = lexer->Get();
-            if (next.type() == Token::IntLiteral) {
-                if (dump_tokens)
-                    Print("%s", next.symbol().data());
-
-                char nstr[256], * p = nstr;
-                for (int i = 0; i < (int)next.symbol().length(); i++)
-                    if (next.symbol()[i] != '_')
-                        *p++ = next.symbol()[i];
-                *p++ = '\0';
-
-                n = -1 * atol(nstr);
-                return new TermNumber(n);
-            }
-            else if (next.type() == Token::FloatLiteral) {
+            if (next.type() == Token::IntLiteral ||
+                next.type() == Token::FloatLiteral) {
                 if (dump_tokens)
                     Print("%s", next.symbol().data());
 
-                char nstr[256], * p = nstr;
-                for (int i = 0; i < (int)next.symbol().length(); i++)
-                    if (next.symbol()[i] != '_')
-                        *p++ = next.symbol()[i];
-                *p++ = '\0';
-
-                d = -1.0 * atof(nstr);
-                return new TermNumber(d);
+                return new(arena) TermNumber(NumberValue(next, true));
             }
             else {
                 lexer->PutBack();
                 UE_LOG(LogTemp, Log, TEXT("(Parse) illegal token '-': number expected"));
+                errors++;
                 return 0;
             }
         }
@@ -236,6 +243,7 @@ Parser::ParseTermBase()
 
     case Token::CharLiteral:
         UE_LOG(LogTemp, Log, TEXT("(Parse) illegal token"));
+        errors++;
 
     default:
         lexer->PutBack();
@@ -251,10 +259,11 @@ Parser::ParseArray()
 
     if (end.type() != Token::RParen) {
         UE_LOG(LogTemp, Log, TEXT("(Parse) illegal token"));
+        errors++;
         return 0;
     }
 
-    return new TermArray(elems);
+    return new(arena) TermArray(elems);
 }
 
 TermStruct*
@@ -265,26 +274,29 @@ Parser::ParseStruct()
 
     if (end.type() != Token::RBrace) {
         UE_LOG(LogTemp, Log, TEXT("(Parse) '}' missing in struct"));
+        errors++;
         return 0;
     }
      
 
-    return new TermStruct(elems);
+    return new(arena) TermStruct(elems);
 }
 
 TermList*
 Parser::ParseTermList(int for_struct)
 {
-    TermList* tlist = new TermList;
+    TermList* tlist = arena ? arena->CreateList() : new TermList;
 
     Term* term = ParseTerm();
     while (term) {
         if (for_struct && !term->isDef()) {
             UE_LOG(LogTemp, Log, TEXT("(Parse) non-definition term in struct"));
+            errors++;
             return 0;
         }
         else if (!for_struct && term->isDef()) {
             UE_LOG(LogTemp, Log, TEXT("(Parse) illegal definition in array"));
+            errors++;
             return 0;
         }
 
@@ -17,6 +17,8 @@
 
 class Reader;
 class Scanner;
+class Token;
+class TermArena;
 
 /**
  * 
@@ -25,7 +27,15 @@ class STARSHATTERWARS_API Parser
 {
 public:
 
-	Parser(Reader* r = 0);
+	// keywords shared with TermStream, registered once by AddKeys():
+	enum KEYS { KEY_TRUE, KEY_FALSE, KEY_DEF, KEY_MINUS };
+	static void AddKeys();
+
+	// value of an int or float literal token, as the parser reads it:
+	static double NumberValue(const Token& t, bool negative = false);
+
+	// terms are allocated from the arena when one is given:
+	Parser(Reader* r = 0, TermArena* a = 0);
 	~Parser();
 
 	Term* ParseTerm();
@@ -35,9 +45,16 @@ public:
 	TermArray* ParseArray();
 	TermStruct* ParseStruct();
 
+	// syntax errors reported so far, and whether every token of the
+	// input has been consumed:
+	int  NumErrors() const { return errors; }
+	bool AtEnd();
+
 private:
 	Reader* reader;
 	Scanner* lexer;
+	TermArena* arena;
+	int errors;
 };
 
 
@@ -13,79 +13,85 @@
 
 
 #include "Random.h"
+#include <atomic>
+
+// +----------------------------------------------------------------------+
+
+static std::atomic<uint64> master_seed(1);
+static std::atomic<int>    master_generation(1);
+
+static uint64 SplitMix(uint64& x)
+{
+	uint64 z = (x += 0x9e3779b97f4a7c15ULL);
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+	return z ^ (z >> 31);
+}
+
+static inline uint64 Rotl(uint64 x, int k)
+{
+	return (x << k) | (x >> (64 - k));
+}
+
+struct ThreadStreams
+{
+	ThreadStreams() : current(0), generation(0) { }
+
+	RandomStream  streams[RandomStream::NUM_STREAMS];
+	RandomStream* current;
+	int           generation;
+};
+
+static thread_local ThreadStreams thread_streams;
 
 // +----------------------------------------------------------------------+
 
 void RandomInit()
 {
-	srand(timeGetTime());
+	RandomStream::SeedAll(timeGetTime());
+	UE_LOG(LogTemp, Log, TEXT("Random seed: %llu"), (unsigned long long) RandomStream::GetMasterSeed());
 }
 
 // +----------------------------------------------------------------------+
 
 Point RandomDirection()
 {
-	Point p = Point(rand() - 16384, rand() - 16384, 0);
-	p.Normalize();
-	return p;
+	return RandomStream::Current().Direction();
 }
 
 // +----------------------------------------------------------------------+
 
 Point RandomPoint()
 {
-	Point p = Point(rand() - 16384, rand() - 16384, 0);
-	p.Normalize();
-	p *= 15e3 + rand() / 3;
-	return p;
+	return RandomStream::Current().Offset();
 }
 
 // +----------------------------------------------------------------------+
 
 Vec3 RandomVector(double radius)
 {
-	Vec3 v = Vec3(rand() - 16384, rand() - 16384, rand() - 16384);
-	v.Normalize();
-
-	if (radius > 0)
-		v *= (float)radius;
-	else
-		v *= (float)RandomDouble(radius / 3, radius);
-
-	return v;
+	return RandomStream::Current().Vector(radius);
 }
 
 // +----------------------------------------------------------------------+
 
 double RandomDouble(double min, double max)
 {
-	double delta = max - min;
-	double r = delta * rand() / 32768.0;
-
-	return min + r;
+	return RandomStream::Current().Double(min, max);
 }
 
 // +----------------------------------------------------------------------+
 
 int RandomIndex()
 {
-	static int index = 0;
-	static int table[16] = { 0, 9, 4, 7, 14, 11, 2, 12, 1, 5, 13, 8, 6, 10, 3, 15 };
-
-	int r = 1 + ((rand() & 0x0700) >> 8);
-	index += r;
-	if (index > 1e7) index = 0;
-	return table[index % 16];
+	return RandomStream::Current().Index();
 }
 
 // +----------------------------------------------------------------------+
 
 bool RandomChance(int wins, int tries)
 {
-	double fraction = 256.0 * wins / tries;
-	double r = (rand() >> 4) & 0xFF;
-
-	return r < fraction;
+	return RandomStream::Current().Chance(wins, tries);
 }
 
 // +----------------------------------------------------------------------+
@@ -104,20 +110,115 @@ int RandomSequence(int current, int range)
 
 int RandomShuffle(int count)
 {
-	static int  set_size = -1;
-	static BYTE set[256];
-	static int  index = -1;
+	return RandomStream::Current().Shuffle(count);
+}
+
+// +----------------------------------------------------------------------+
 
+int RandomInt()
+{
+	return RandomStream::Current().Rand();
+}
+
+// +----------------------------------------------------------------------+
+
+void RandomDoubles(double* dst, int count, double min, double max)
+{
+	RandomStream::Current().FillDoubles(dst, count, min, max);
+}
+
+void RandomPoints(Point* dst, int count)
+{
+	RandomStream::Current().FillPoints(dst, count);
+}
+
+// +----------------------------------------------------------------------+
+
+RandomStream::RandomStream(uint64 s)
+{
+	Seed(s);
+}
+
+void
+RandomStream::Seed(uint64 s)
+{
+	seed = s;
+
+	uint64 x = s;
+	for (int i = 0; i < 4; i++)
+		state[i] = SplitMix(x);
+
+	index     = 0;
+	set_size  = -1;
+	set_index = -1;
+}
+
+uint64
+RandomStream::Next()
+{
+	const uint64 result = Rotl(state[1] * 5, 7) * 9;
+	const uint64 t = state[1] << 17;
+
+	state[2] ^= state[0];
+	state[3] ^= state[1];
+	state[1] ^= state[2];
+	state[0] ^= state[3];
+	state[2] ^= t;
+	state[3] = Rotl(state[3], 45);
+
+	return result;
+}
+
+int
+RandomStream::Rand()
+{
+	return (int)(Next() >> 49);
+}
+
+// +----------------------------------------------------------------------+
+
+double
+RandomStream::Double(double min, double max)
+{
+	double delta = max - min;
+	double r = delta * Rand() / 32768.0;
+
+	return min + r;
+}
+
+int
+RandomStream::Index()
+{
+	static const int table[16] = { 0, 9, 4, 7, 14, 11, 2, 12, 1, 5, 13, 8, 6, 10, 3, 15 };
+
+	int r = 1 + ((Rand() & 0x0700) >> 8);
+	index += r;
+	if (index > 1e7) index = 0;
+	return table[index % 16];
+}
+
+bool
+RandomStream::Chance(int wins, int tries)
+{
+	double fraction = 256.0 * wins / tries;
+	double r = (Rand() >> 4) & 0xFF;
+
+	return r < fraction;
+}
+
+int
+RandomStream::Shuffle(int count)
+{
 	if (count < 0 || count > 250)
 		return 0;
 
 	if (set_size != count) {
 		set_size = count;
-		index = -1;
+		set_index = -1;
 	}
 
 	// need to reshuffle
-	if (index < 0 || index > set_size - 1) {
+	if (set_index < 0 || set_index > set_size - 1) {
 		// set up the deck
 		int tmp[256];
 		for (int i = 0; i < 256; i++)
@@ -125,7 +226,7 @@ int RandomShuffle(int count)
 
 		// shuffle the cards
 		for (int i = 0; i < set_size; i++) {
-			int n = (int)RandomDouble(0, set_size);
+			int n = (int)Double(0, set_size);
 			int tries = set_size;
 			while (tmp[n] < 0 && tries--) {
 				n = (n + 1) % set_size;
@@ -140,10 +241,123 @@ int RandomShuffle(int count)
 			}
 		}
 
-		index = 0;
+		set_index = 0;
+	}
+
+	return set[set_index++];
+}
+
+// +----------------------------------------------------------------------+
+
+Point
+RandomStream::Direction()
+{
+	Point p = Point(Rand() - 16384, Rand() - 16384, 0);
+	p.Normalize();
+	return p;
+}
+
+Point
+RandomStream::Offset()
+{
+	Point p = Point(Rand() - 16384, Rand() - 16384, 0);
+	p.Normalize();
+	p *= 15e3 + Rand() / 3;
+	return p;
+}
+
+Vec3
+RandomStream::Vector(double radius)
+{
+	Vec3 v = Vec3(Rand() - 16384, Rand() - 16384, Rand() - 16384);
+	v.Normalize();
+
+	if (radius > 0)
+		v *= (float)radius;
+	else
+		v *= (float)Double(radius / 3, radius);
+
+	return v;
+}
+
+// +----------------------------------------------------------------------+
+
+void
+RandomStream::FillDoubles(double* dst, int count, double min, double max)
+{
+	const double scale = (max - min) / 32768.0;
+
+	for (int i = 0; i < count; i++)
+		dst[i] = min + scale * (double)(Next() >> 49);
+}
+
+void
+RandomStream::FillPoints(Point* dst, int count)
+{
+	for (int i = 0; i < count; i++)
+		dst[i] = Offset();
+}
+
+// +----------------------------------------------------------------------+
+
+RandomStream&
+RandomStream::Get(int stream)
+{
+	ThreadStreams& t = thread_streams;
+	int generation = master_generation;
+
+	// the streams depend on the master seed alone, not on which
+	// thread happened to draw first:
+	if (t.generation != generation) {
+		uint64 x = master_seed;
+
+		for (int i = 0; i < NUM_STREAMS; i++)
+			t.streams[i].Seed(SplitMix(x));
+
+		t.generation = generation;
 	}
 
-	return set[index++];
+	if (stream < 0 || stream >= NUM_STREAMS)
+		stream = SIMULATION;
+
+	return t.streams[stream];
+}
+
+uint64
+RandomStream::TaskSeed(uint64 batch, int task)
+{
+	uint64 x = batch ^ ((uint64)(unsigned)task * 0xd1b54a32d192ed03ULL);
+	return SplitMix(x);
+}
+
+RandomStream&
+RandomStream::Current()
+{
+	ThreadStreams& t = thread_streams;
+	RandomStream&  s = Get(SIMULATION);     // reseeds if the master seed changed
+
+	return t.current ? *t.current : s;
 }
 
+RandomStream*
+RandomStream::Select(RandomStream* s)
+{
+	ThreadStreams& t = thread_streams;
+	RandomStream* prev = t.current;
 
+	t.current = s;
+	return prev;
+}
+
+void
+RandomStream::SeedAll(uint64 master)
+{
+	master_seed = master;
+	master_generation++;
+}
+
+uint64
+RandomStream::GetMasterSeed()
+{
+	return master_seed;
+}
@@ -31,6 +31,87 @@
 	bool     RandomChance(int wins = 1, int tries = 2);
 	int      RandomSequence(int current, int range);
 	int      RandomShuffle(int count);
+	int      RandomInt();    // 0 to 32767, in place of rand()
+
+	// batch versions, for spawning many objects at once:
+	void     RandomDoubles(double* dst, int count, double min = 0, double max = 1);
+	void     RandomPoints(Point* dst, int count);
 
 	// +----------------------------------------------------------------------+
 
+// Seedable generator (xoshiro256**) behind the functions above.
+// Each thread has one stream per subsystem, seeded from the master
+// seed alone, so a run can be replayed by seeding it the same way.
+// The functions above draw from the thread's current stream, which is
+// the simulation stream unless a RandomScope selects another one.
+
+class STARSHATTERWARS_API RandomStream
+{
+public:
+	static const char* TYPENAME() { return "RandomStream"; }
+
+	enum STREAMS { CAMPAIGN, MISSION, SIMULATION, NUM_STREAMS };
+
+	RandomStream(uint64 seed = 1);
+
+	void     Seed(uint64 seed);
+	uint64   GetSeed() const { return seed; }
+
+	uint64   Next();
+	int      Rand();     // 0 to 32767, the range the old rand() calls expect
+	double   Double(double min = 0, double max = 1);
+	int      Index();
+	bool     Chance(int wins = 1, int tries = 2);
+	int      Shuffle(int count);
+	Point    Direction();
+	Point    Offset();       // as RandomPoint()
+	Vec3     Vector(double radius);
+
+	void     FillDoubles(double* dst, int count, double min = 0, double max = 1);
+	void     FillPoints(Point* dst, int count);
+
+	// the calling thread's streams.  every thread starts its streams
+	// from the same seeds, so worker threads that draw in parallel
+	// should be handed a stream of their own instead:
+	static RandomStream& Get(int stream);
+
+	// seed for one task of a parallel batch.  the caller draws the
+	// batch seed once from its own stream before the batch starts;
+	// each task then seeds a private stream from the batch seed and
+	// its index, so it draws the same numbers whichever thread runs it:
+	static uint64  TaskSeed(uint64 batch, int task);
+	static RandomStream& Current();
+	static RandomStream* Select(RandomStream* s);
+
+	// reseeds every thread's streams (lazily, on their next draw):
+	static void    SeedAll(uint64 master);
+	static uint64  GetMasterSeed();
+
+private:
+	uint64   seed;
+	uint64   state[4];
+
+	int      index;          // RandomIndex sequence
+	int      set_size;       // RandomShuffle deck
+	int      set_index;
+	BYTE     set[256];
+};
+
+// +----------------------------------------------------------------------+
+
+// Selects the stream the Random functions draw from on this thread,
+// until the scope ends:
+
+class STARSHATTERWARS_API RandomScope
+{
+public:
+	RandomScope(int stream) : prev(RandomStream::Select(&RandomStream::Get(stream))) { }
+	RandomScope(RandomStream& s) : prev(RandomStream::Select(&s)) { }
+	~RandomScope() { RandomStream::Select(prev); }
+
+private:
+	RandomStream* prev;
+};
+
+// +----------------------------------------------------------------------+
+
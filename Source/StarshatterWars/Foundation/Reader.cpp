@@ -122,5 +122,21 @@ BlockReader::more()
     return Text();
 }
 
+int
+BlockReader::moreBlock(const char*& block)
+{
+    block = 0;
+
+    if (done || !data) {
+        done = 1;
+        return 0;
+    }
+
+    block = data;
+    done = 1;
+
+    return length ? length : (int) ::strlen(data);
+}
+
 
 
@@ -15,6 +15,12 @@ public:
 	virtual ~Reader() { }
 
 	virtual Text more() = 0;
+
+	// readers whose input is already in memory can hand the Scanner
+	// the next null terminated block to scan in place.  returns the
+	// block length (0 at the end), or -1 to make the Scanner copy the
+	// input from more() instead:
+	virtual int  moreBlock(const char*& block) { block = 0; return -1; }
 };
 
 class ConsoleReader : public Reader
@@ -47,6 +53,7 @@ public:
 	BlockReader(const char* block);
 	BlockReader(const char* block, int len);
 	virtual Text more();
+	virtual int  moreBlock(const char*& block);
 
 private:
 	char* data;
@@ -0,0 +1,560 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         Symbol.cpp
+	AUTHOR:       Carlos Bott
+*/
+
+#include "Symbol.h"
+#include "Dictionary.h"
+#include "ThreadSync.h"
+#include <atomic>
+
+// +-------------------------------------------------------------------+
+
+static const char* predefined[] = {
+	"",
+	"CD",
+	"CL",
+	"abrv",
+	"acs",
+	"action",
+	"action_groups",
+	"action_id",
+	"action_status",
+	"affects",
+	"agility",
+	"aim_az_max",
+	"aim_az_min",
+	"aim_az_rest",
+	"aim_el_max",
+	"aim_el_min",
+	"aim_el_rest",
+	"air_factor",
+	"alert",
+	"alias",
+	"align",
+	"ambient",
+	"ammo",
+	"approach",
+	"apron",
+	"apron_texture",
+	"asset_id",
+	"asset_kill",
+	"asset_type",
+	"asteroids",
+	"atmosphere",
+	"augmenter",
+	"auto_roll",
+	"avail",
+	"avoid_fighter",
+	"avoid_strike",
+	"avoid_target",
+	"avoid_time",
+	"az",
+	"az_var",
+	"azimuth",
+	"back",
+	"back_color",
+	"base_color",
+	"beam_hit_sound",
+	"beauty",
+	"blend",
+	"bolt_hit_sound",
+	"bounding_box",
+	"box",
+	"bridge",
+	"bump",
+	"c1",
+	"c2",
+	"callsign",
+	"cam",
+	"capacity",
+	"caption",
+	"carrier",
+	"cell_insets",
+	"cells",
+	"chance",
+	"chase",
+	"class",
+	"clouds_alt_high",
+	"clouds_alt_low",
+	"clouds_high",
+	"clouds_low",
+	"cmd",
+	"cockpit_model",
+	"cockpit_scale",
+	"code",
+	"color",
+	"combatant",
+	"combatant_groups",
+	"command_ai",
+	"commander",
+	"commit_range",
+	"comp",
+	"component",
+	"computer",
+	"consumption",
+	"count",
+	"countdown",
+	"ctrl",
+	"cycle_time",
+	"damage",
+	"dead_count",
+	"death_spiral",
+	"debris",
+	"debris_count",
+	"debris_drag",
+	"debris_fire",
+	"debris_fire_type",
+	"debris_life",
+	"debris_loc",
+	"debris_mass",
+	"debris_speed",
+	"decoy",
+	"defctrl",
+	"deflection_cost",
+	"degrees",
+	"delay",
+	"desc",
+	"description",
+	"design",
+	"detail_0",
+	"detail_1",
+	"detail_2",
+	"detail_3",
+	"detail_texture_0",
+	"detail_texture_1",
+	"detec",
+	"dex",
+	"dex_var",
+	"display_name",
+	"drag",
+	"drive",
+	"dust",
+	"el",
+	"el_var",
+	"elem",
+	"element",
+	"elevation",
+	"emcon",
+	"emcon_1",
+	"emcon_2",
+	"emcon_3",
+	"end",
+	"env_texture_negative_x",
+	"env_texture_negative_y",
+	"env_texture_negative_z",
+	"env_texture_positive_x",
+	"env_texture_positive_y",
+	"env_texture_positive_z",
+	"event",
+	"event_chance",
+	"event_message",
+	"event_param",
+	"event_ship",
+	"event_sound",
+	"event_source",
+	"event_target",
+	"exec_once",
+	"explosion",
+	"explosion_loc",
+	"explosion_scale",
+	"explosion_time",
+	"explosion_type",
+	"fade",
+	"farcast",
+	"farcaster",
+	"feature_0",
+	"feature_1",
+	"feature_2",
+	"feature_3",
+	"file",
+	"filter",
+	"final",
+	"final_loc",
+	"final_type",
+	"fire",
+	"fire_type",
+	"flightdeck",
+	"fog_density",
+	"fog_scale",
+	"font",
+	"fore_color",
+	"form",
+	"formation",
+	"fuel",
+	"fuel_range",
+	"gear",
+	"gloss",
+	"glow",
+	"glow_high_res",
+	"grid",
+	"group",
+	"group_id",
+	"group_type",
+	"hardpoint",
+	"haze",
+	"haze_fade",
+	"head",
+	"heading",
+	"high_res",
+	"high_res_east",
+	"high_res_west",
+	"hold",
+	"hud_icon",
+	"hull_factor",
+	"icon",
+	"id",
+	"iff",
+	"image",
+	"image_east",
+	"image_west",
+	"inclination",
+	"instr",
+	"integrity",
+	"intel",
+	"invulnerable",
+	"jump_time",
+	"ka",
+	"kd",
+	"ke",
+	"ks",
+	"launch",
+	"layer",
+	"layout",
+	"life",
+	"light",
+	"link",
+	"loadout",
+	"loc",
+	"location",
+	"luminous",
+	"main_drive",
+	"maint_count",
+	"map",
+	"margins",
+	"mass",
+	"material",
+	"max",
+	"max_output",
+	"max_rank",
+	"maxrad",
+	"message",
+	"min",
+	"min_rank",
+	"minrad",
+	"mission",
+	"model",
+	"moon",
+	"mtl",
+	"mtn_scale",
+	"mtnscale",
+	"muzzle",
+	"name",
+	"nav",
+	"navlight",
+	"navpt",
+	"nebula",
+	"not",
+	"ns",
+	"objective",
+	"offset_0",
+	"offset_1",
+	"offset_2",
+	"offset_3",
+	"opp_type",
+	"optional",
+	"orbit",
+	"order",
+	"orders",
+	"param",
+	"parent",
+	"parent_id",
+	"parent_type",
+	"patch",
+	"patch_texture",
+	"path",
+	"pattern",
+	"pcs",
+	"period",
+	"pid",
+	"pitch_rate",
+	"planet",
+	"playable",
+	"player",
+	"poly_stars",
+	"port",
+	"port_aft",
+	"port_bottom",
+	"port_fore",
+	"port_left",
+	"port_right",
+	"port_top",
+	"power",
+	"prep_time",
+	"priority",
+	"probability",
+	"probe",
+	"quantum",
+	"quantum_drive",
+	"radius",
+	"range",
+	"recovery",
+	"rect",
+	"ref",
+	"region",
+	"regnum",
+	"repair_speed",
+	"repair_teams",
+	"repair_time",
+	"replace_time",
+	"req",
+	"respawn",
+	"respawns",
+	"rest_azimuth",
+	"rest_elevation",
+	"retro",
+	"rgn",
+	"ring",
+	"rloc",
+	"rogue",
+	"roll_rate",
+	"rotation",
+	"runway",
+	"scale",
+	"scene",
+	"score",
+	"script",
+	"scripted",
+	"scuttle",
+	"sender",
+	"sensor",
+	"sequential",
+	"shades_high",
+	"shades_low",
+	"shield",
+	"ship",
+	"show_trail",
+	"sitrep",
+	"situation",
+	"size",
+	"skin",
+	"sky",
+	"sky_color",
+	"sound",
+	"source",
+	"spares",
+	"speed",
+	"spin",
+	"splash_radius",
+	"spot",
+	"sprite",
+	"squadron",
+	"stall",
+	"star",
+	"stardate",
+	"stars",
+	"start",
+	"station",
+	"stations",
+	"status",
+	"style",
+	"subtitles",
+	"subtype",
+	"sys",
+	"system",
+	"target",
+	"target_id",
+	"target_iff",
+	"target_kill",
+	"target_type",
+	"team",
+	"terrain",
+	"text",
+	"text_align",
+	"text_insets",
+	"texture",
+	"tgt",
+	"tgt_desc",
+	"thrust",
+	"thruster",
+	"tilt",
+	"time",
+	"trail",
+	"trans_x",
+	"trans_y",
+	"trans_z",
+	"transparent",
+	"trigger",
+	"trigger_param",
+	"trigger_ship",
+	"trigger_target",
+	"tscale",
+	"turn_bank",
+	"type",
+	"unit",
+	"unit_index",
+	"vec",
+	"velocity",
+	"vlimit",
+	"ward",
+	"water_texture",
+	"weapon",
+	"weather_clear",
+	"weather_fog",
+	"weather_high_clouds",
+	"weather_moderate_clouds",
+	"weather_overcast",
+	"weather_period",
+	"weather_storm",
+	"yaw_rate",
+	"zone",
+};
+
+static_assert(sizeof(predefined) / sizeof(predefined[0]) == SYM_PREDEFINED,
+	"Symbol.cpp predefined table does not match the SYMBOLS enum");
+
+// +-------------------------------------------------------------------+
+// Entries are stored in fixed size blocks that never move once they
+// are allocated, so an id handed out by Intern() can be resolved
+// without taking the lock:
+
+const int SYMBOL_BLOCK_BITS = 8;
+const int SYMBOL_BLOCK_SIZE = 1 << SYMBOL_BLOCK_BITS;
+const int SYMBOL_MAX_BLOCKS = 1024;
+
+struct SymbolEntry
+{
+	Text  text;
+};
+
+static SymbolEntry*      symbol_blocks[SYMBOL_MAX_BLOCKS];
+static std::atomic<int>  symbol_count(0);
+static Dictionary<int>   symbol_index;
+static ThreadSync        symbol_sync;
+static bool              symbol_init = false;
+
+static SymbolEntry& Entry(int id)
+{
+	return symbol_blocks[id >> SYMBOL_BLOCK_BITS][id & (SYMBOL_BLOCK_SIZE - 1)];
+}
+
+static int AddEntry(const char* s, int len)
+{
+	int id = symbol_count;
+	int block = id >> SYMBOL_BLOCK_BITS;
+
+	if (block >= SYMBOL_MAX_BLOCKS)
+		return SYM_NONE;
+
+	if (!symbol_blocks[block])
+		symbol_blocks[block] = new SymbolEntry[SYMBOL_BLOCK_SIZE];
+
+	SymbolEntry& e = Entry(id);
+	e.text = Text(s, len);
+	symbol_count++;
+
+	symbol_index.Insert(e.text, id);
+	return id;
+}
+
+static void Init()
+{
+	if (!symbol_init) {
+		symbol_init = true;
+		symbol_index.Reserve(SYM_PREDEFINED * 2);
+
+		// add the predefined keys in order,
+		// so that their ids match the SYMBOLS enum:
+		for (int i = 0; i < SYM_PREDEFINED; i++)
+			AddEntry(predefined[i], (int) ::strlen(predefined[i]));
+	}
+}
+
+// +-------------------------------------------------------------------+
+
+const Text&
+Symbol::GetText() const
+{
+	static Text empty;
+
+	if (id > SYM_NONE && id < symbol_count)
+		return Entry(id).text;
+
+	return empty;
+}
+
+// +-------------------------------------------------------------------+
+
+Symbol
+Symbol::Intern(const char* s)
+{
+	if (!s || !*s)
+		return Symbol();
+
+	return Intern(s, (int) ::strlen(s));
+}
+
+Symbol
+Symbol::Intern(const Text& s)
+{
+	return Intern(s.data(), s.length());
+}
+
+Symbol
+Symbol::Intern(const char* s, int len)
+{
+	if (!s || len < 1)
+		return Symbol();
+
+	AutoThreadSync a(symbol_sync);
+	Init();
+
+	char  local[64];
+	char* buf = len < (int)sizeof(local) ? local : new char[len + 1];
+
+	CopyMemory(buf, s, len);
+	buf[len] = 0;
+
+	int id = symbol_index.Find(buf, -1);
+
+	if (buf != local)
+		delete[] buf;
+
+	if (id < 0)
+		id = AddEntry(s, len);
+
+	return Symbol(id);
+}
+
+// +-------------------------------------------------------------------+
+
+Symbol
+Symbol::Find(const char* s)
+{
+	if (!s || !*s)
+		return Symbol();
+
+	AutoThreadSync a(symbol_sync);
+	Init();
+
+	return Symbol(symbol_index.Find(s, SYM_NONE));
+}
+
+Symbol
+Symbol::Find(const Text& s)
+{
+	return Find(s.data());
+}
+
+int
+Symbol::Count()
+{
+	AutoThreadSync a(symbol_sync);
+	Init();
+
+	return symbol_count;
+}
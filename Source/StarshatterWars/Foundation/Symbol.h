@@ -0,0 +1,463 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         Symbol.h
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Global table of interned identifiers.  The Scanner interns every
+	identifier it reads, so each distinct key in the data files is
+	stored and hashed once and shares a single canonical TextRep.
+	Parsers compare the resulting Symbol ids instead of the text.
+
+	The keys used by the content loaders are registered up front in
+	a fixed order, so their ids are compile-time constants that can
+	be used in switch statements.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Text.h"
+
+// +-------------------------------------------------------------------+
+
+enum SYMBOLS {
+	SYM_NONE,
+	SYM_CD,
+	SYM_CL,
+	SYM_ABRV,
+	SYM_ACS,
+	SYM_ACTION,
+	SYM_ACTION_GROUPS,
+	SYM_ACTION_ID,
+	SYM_ACTION_STATUS,
+	SYM_AFFECTS,
+	SYM_AGILITY,
+	SYM_AIM_AZ_MAX,
+	SYM_AIM_AZ_MIN,
+	SYM_AIM_AZ_REST,
+	SYM_AIM_EL_MAX,
+	SYM_AIM_EL_MIN,
+	SYM_AIM_EL_REST,
+	SYM_AIR_FACTOR,
+	SYM_ALERT,
+	SYM_ALIAS,
+	SYM_ALIGN,
+	SYM_AMBIENT,
+	SYM_AMMO,
+	SYM_APPROACH,
+	SYM_APRON,
+	SYM_APRON_TEXTURE,
+	SYM_ASSET_ID,
+	SYM_ASSET_KILL,
+	SYM_ASSET_TYPE,
+	SYM_ASTEROIDS,
+	SYM_ATMOSPHERE,
+	SYM_AUGMENTER,
+	SYM_AUTO_ROLL,
+	SYM_AVAIL,
+	SYM_AVOID_FIGHTER,
+	SYM_AVOID_STRIKE,
+	SYM_AVOID_TARGET,
+	SYM_AVOID_TIME,
+	SYM_AZ,
+	SYM_AZ_VAR,
+	SYM_AZIMUTH,
+	SYM_BACK,
+	SYM_BACK_COLOR,
+	SYM_BASE_COLOR,
+	SYM_BEAM_HIT_SOUND,
+	SYM_BEAUTY,
+	SYM_BLEND,
+	SYM_BOLT_HIT_SOUND,
+	SYM_BOUNDING_BOX,
+	SYM_BOX,
+	SYM_BRIDGE,
+	SYM_BUMP,
+	SYM_C1,
+	SYM_C2,
+	SYM_CALLSIGN,
+	SYM_CAM,
+	SYM_CAPACITY,
+	SYM_CAPTION,
+	SYM_CARRIER,
+	SYM_CELL_INSETS,
+	SYM_CELLS,
+	SYM_CHANCE,
+	SYM_CHASE,
+	SYM_CLASS,
+	SYM_CLOUDS_ALT_HIGH,
+	SYM_CLOUDS_ALT_LOW,
+	SYM_CLOUDS_HIGH,
+	SYM_CLOUDS_LOW,
+	SYM_CMD,
+	SYM_COCKPIT_MODEL,
+	SYM_COCKPIT_SCALE,
+	SYM_CODE,
+	SYM_COLOR,
+	SYM_COMBATANT,
+	SYM_COMBATANT_GROUPS,
+	SYM_COMMAND_AI,
+	SYM_COMMANDER,
+	SYM_COMMIT_RANGE,
+	SYM_COMP,
+	SYM_COMPONENT,
+	SYM_COMPUTER,
+	SYM_CONSUMPTION,
+	SYM_COUNT,
+	SYM_COUNTDOWN,
+	SYM_CTRL,
+	SYM_CYCLE_TIME,
+	SYM_DAMAGE,
+	SYM_DEAD_COUNT,
+	SYM_DEATH_SPIRAL,
+	SYM_DEBRIS,
+	SYM_DEBRIS_COUNT,
+	SYM_DEBRIS_DRAG,
+	SYM_DEBRIS_FIRE,
+	SYM_DEBRIS_FIRE_TYPE,
+	SYM_DEBRIS_LIFE,
+	SYM_DEBRIS_LOC,
+	SYM_DEBRIS_MASS,
+	SYM_DEBRIS_SPEED,
+	SYM_DECOY,
+	SYM_DEFCTRL,
+	SYM_DEFLECTION_COST,
+	SYM_DEGREES,
+	SYM_DELAY,
+	SYM_DESC,
+	SYM_DESCRIPTION,
+	SYM_DESIGN,
+	SYM_DETAIL_0,
+	SYM_DETAIL_1,
+	SYM_DETAIL_2,
+	SYM_DETAIL_3,
+	SYM_DETAIL_TEXTURE_0,
+	SYM_DETAIL_TEXTURE_1,
+	SYM_DETEC,
+	SYM_DEX,
+	SYM_DEX_VAR,
+	SYM_DISPLAY_NAME,
+	SYM_DRAG,
+	SYM_DRIVE,
+	SYM_DUST,
+	SYM_EL,
+	SYM_EL_VAR,
+	SYM_ELEM,
+	SYM_ELEMENT,
+	SYM_ELEVATION,
+	SYM_EMCON,
+	SYM_EMCON_1,
+	SYM_EMCON_2,
+	SYM_EMCON_3,
+	SYM_END,
+	SYM_ENV_TEXTURE_NEGATIVE_X,
+	SYM_ENV_TEXTURE_NEGATIVE_Y,
+	SYM_ENV_TEXTURE_NEGATIVE_Z,
+	SYM_ENV_TEXTURE_POSITIVE_X,
+	SYM_ENV_TEXTURE_POSITIVE_Y,
+	SYM_ENV_TEXTURE_POSITIVE_Z,
+	SYM_EVENT,
+	SYM_EVENT_CHANCE,
+	SYM_EVENT_MESSAGE,
+	SYM_EVENT_PARAM,
+	SYM_EVENT_SHIP,
+	SYM_EVENT_SOUND,
+	SYM_EVENT_SOURCE,
+	SYM_EVENT_TARGET,
+	SYM_EXEC_ONCE,
+	SYM_EXPLOSION,
+	SYM_EXPLOSION_LOC,
+	SYM_EXPLOSION_SCALE,
+	SYM_EXPLOSION_TIME,
+	SYM_EXPLOSION_TYPE,
+	SYM_FADE,
+	SYM_FARCAST,
+	SYM_FARCASTER,
+	SYM_FEATURE_0,
+	SYM_FEATURE_1,
+	SYM_FEATURE_2,
+	SYM_FEATURE_3,
+	SYM_FILE,
+	SYM_FILTER,
+	SYM_FINAL,
+	SYM_FINAL_LOC,
+	SYM_FINAL_TYPE,
+	SYM_FIRE,
+	SYM_FIRE_TYPE,
+	SYM_FLIGHTDECK,
+	SYM_FOG_DENSITY,
+	SYM_FOG_SCALE,
+	SYM_FONT,
+	SYM_FORE_COLOR,
+	SYM_FORM,
+	SYM_FORMATION,
+	SYM_FUEL,
+	SYM_FUEL_RANGE,
+	SYM_GEAR,
+	SYM_GLOSS,
+	SYM_GLOW,
+	SYM_GLOW_HIGH_RES,
+	SYM_GRID,
+	SYM_GROUP,
+	SYM_GROUP_ID,
+	SYM_GROUP_TYPE,
+	SYM_HARDPOINT,
+	SYM_HAZE,
+	SYM_HAZE_FADE,
+	SYM_HEAD,
+	SYM_HEADING,
+	SYM_HIGH_RES,
+	SYM_HIGH_RES_EAST,
+	SYM_HIGH_RES_WEST,
+	SYM_HOLD,
+	SYM_HUD_ICON,
+	SYM_HULL_FACTOR,
+	SYM_ICON,
+	SYM_ID,
+	SYM_IFF,
+	SYM_IMAGE,
+	SYM_IMAGE_EAST,
+	SYM_IMAGE_WEST,
+	SYM_INCLINATION,
+	SYM_INSTR,
+	SYM_INTEGRITY,
+	SYM_INTEL,
+	SYM_INVULNERABLE,
+	SYM_JUMP_TIME,
+	SYM_KA,
+	SYM_KD,
+	SYM_KE,
+	SYM_KS,
+	SYM_LAUNCH,
+	SYM_LAYER,
+	SYM_LAYOUT,
+	SYM_LIFE,
+	SYM_LIGHT,
+	SYM_LINK,
+	SYM_LOADOUT,
+	SYM_LOC,
+	SYM_LOCATION,
+	SYM_LUMINOUS,
+	SYM_MAIN_DRIVE,
+	SYM_MAINT_COUNT,
+	SYM_MAP,
+	SYM_MARGINS,
+	SYM_MASS,
+	SYM_MATERIAL,
+	SYM_MAX,
+	SYM_MAX_OUTPUT,
+	SYM_MAX_RANK,
+	SYM_MAXRAD,
+	SYM_MESSAGE,
+	SYM_MIN,
+	SYM_MIN_RANK,
+	SYM_MINRAD,
+	SYM_MISSION,
+	SYM_MODEL,
+	SYM_MOON,
+	SYM_MTL,
+	SYM_MTN_SCALE,
+	SYM_MTNSCALE,
+	SYM_MUZZLE,
+	SYM_NAME,
+	SYM_NAV,
+	SYM_NAVLIGHT,
+	SYM_NAVPT,
+	SYM_NEBULA,
+	SYM_NOT,
+	SYM_NS,
+	SYM_OBJECTIVE,
+	SYM_OFFSET_0,
+	SYM_OFFSET_1,
+	SYM_OFFSET_2,
+	SYM_OFFSET_3,
+	SYM_OPP_TYPE,
+	SYM_OPTIONAL,
+	SYM_ORBIT,
+	SYM_ORDER,
+	SYM_ORDERS,
+	SYM_PARAM,
+	SYM_PARENT,
+	SYM_PARENT_ID,
+	SYM_PARENT_TYPE,
+	SYM_PATCH,
+	SYM_PATCH_TEXTURE,
+	SYM_PATH,
+	SYM_PATTERN,
+	SYM_PCS,
+	SYM_PERIOD,
+	SYM_PID,
+	SYM_PITCH_RATE,
+	SYM_PLANET,
+	SYM_PLAYABLE,
+	SYM_PLAYER,
+	SYM_POLY_STARS,
+	SYM_PORT,
+	SYM_PORT_AFT,
+	SYM_PORT_BOTTOM,
+	SYM_PORT_FORE,
+	SYM_PORT_LEFT,
+	SYM_PORT_RIGHT,
+	SYM_PORT_TOP,
+	SYM_POWER,
+	SYM_PREP_TIME,
+	SYM_PRIORITY,
+	SYM_PROBABILITY,
+	SYM_PROBE,
+	SYM_QUANTUM,
+	SYM_QUANTUM_DRIVE,
+	SYM_RADIUS,
+	SYM_RANGE,
+	SYM_RECOVERY,
+	SYM_RECT,
+	SYM_REF,
+	SYM_REGION,
+	SYM_REGNUM,
+	SYM_REPAIR_SPEED,
+	SYM_REPAIR_TEAMS,
+	SYM_REPAIR_TIME,
+	SYM_REPLACE_TIME,
+	SYM_REQ,
+	SYM_RESPAWN,
+	SYM_RESPAWNS,
+	SYM_REST_AZIMUTH,
+	SYM_REST_ELEVATION,
+	SYM_RETRO,
+	SYM_RGN,
+	SYM_RING,
+	SYM_RLOC,
+	SYM_ROGUE,
+	SYM_ROLL_RATE,
+	SYM_ROTATION,
+	SYM_RUNWAY,
+	SYM_SCALE,
+	SYM_SCENE,
+	SYM_SCORE,
+	SYM_SCRIPT,
+	SYM_SCRIPTED,
+	SYM_SCUTTLE,
+	SYM_SENDER,
+	SYM_SENSOR,
+	SYM_SEQUENTIAL,
+	SYM_SHADES_HIGH,
+	SYM_SHADES_LOW,
+	SYM_SHIELD,
+	SYM_SHIP,
+	SYM_SHOW_TRAIL,
+	SYM_SITREP,
+	SYM_SITUATION,
+	SYM_SIZE,
+	SYM_SKIN,
+	SYM_SKY,
+	SYM_SKY_COLOR,
+	SYM_SOUND,
+	SYM_SOURCE,
+	SYM_SPARES,
+	SYM_SPEED,
+	SYM_SPIN,
+	SYM_SPLASH_RADIUS,
+	SYM_SPOT,
+	SYM_SPRITE,
+	SYM_SQUADRON,
+	SYM_STALL,
+	SYM_STAR,
+	SYM_STARDATE,
+	SYM_STARS,
+	SYM_START,
+	SYM_STATION,
+	SYM_STATIONS,
+	SYM_STATUS,
+	SYM_STYLE,
+	SYM_SUBTITLES,
+	SYM_SUBTYPE,
+	SYM_SYS,
+	SYM_SYSTEM,
+	SYM_TARGET,
+	SYM_TARGET_ID,
+	SYM_TARGET_IFF,
+	SYM_TARGET_KILL,
+	SYM_TARGET_TYPE,
+	SYM_TEAM,
+	SYM_TERRAIN,
+	SYM_TEXT,
+	SYM_TEXT_ALIGN,
+	SYM_TEXT_INSETS,
+	SYM_TEXTURE,
+	SYM_TGT,
+	SYM_TGT_DESC,
+	SYM_THRUST,
+	SYM_THRUSTER,
+	SYM_TILT,
+	SYM_TIME,
+	SYM_TRAIL,
+	SYM_TRANS_X,
+	SYM_TRANS_Y,
+	SYM_TRANS_Z,
+	SYM_TRANSPARENT,
+	SYM_TRIGGER,
+	SYM_TRIGGER_PARAM,
+	SYM_TRIGGER_SHIP,
+	SYM_TRIGGER_TARGET,
+	SYM_TSCALE,
+	SYM_TURN_BANK,
+	SYM_TYPE,
+	SYM_UNIT,
+	SYM_UNIT_INDEX,
+	SYM_VEC,
+	SYM_VELOCITY,
+	SYM_VLIMIT,
+	SYM_WARD,
+	SYM_WATER_TEXTURE,
+	SYM_WEAPON,
+	SYM_WEATHER_CLEAR,
+	SYM_WEATHER_FOG,
+	SYM_WEATHER_HIGH_CLOUDS,
+	SYM_WEATHER_MODERATE_CLOUDS,
+	SYM_WEATHER_OVERCAST,
+	SYM_WEATHER_PERIOD,
+	SYM_WEATHER_STORM,
+	SYM_YAW_RATE,
+	SYM_ZONE,
+
+	SYM_PREDEFINED
+};
+
+// +-------------------------------------------------------------------+
+
+class STARSHATTERWARS_API Symbol
+{
+public:
+	static const char* TYPENAME() { return "Symbol"; }
+
+	Symbol() : id(SYM_NONE) { }
+	Symbol(int n) : id(n) { }
+
+	operator int()           const { return id; }
+	int         GetID()      const { return id; }
+
+	// canonical text of the symbol, shared by every Token and
+	// TermText that refers to it:
+	const Text& GetText()    const;
+
+	// find or add the symbol for s:
+	static Symbol  Intern(const char* s);
+	static Symbol  Intern(const char* s, int len);
+	static Symbol  Intern(const Text& s);
+
+	// find the symbol for s without adding it.
+	// returns SYM_NONE if s has never been interned:
+	static Symbol  Find(const char* s);
+	static Symbol  Find(const Text& s);
+
+	static int     Count();
+
+private:
+	int            id;
+};
+
+// +-------------------------------------------------------------------+
@@ -0,0 +1,206 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         TaskPool.cpp
+	AUTHOR:       Carlos Bott
+*/
+
+
+#include "TaskPool.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// +--------------------------------------------------------------------+
+
+struct TaskBatch
+{
+	TaskFunc          func;
+	void*             param;
+	int               count;
+	std::atomic<int>  next;
+};
+
+struct TaskPoolState
+{
+	std::mutex                lock;
+	std::condition_variable   wake;       // a new batch, or quit
+	std::condition_variable   done;       // the last worker left the batch
+	std::vector<std::thread>  workers;
+
+	TaskBatch*  batch;
+	unsigned    generation;
+	int         pending;                  // workers still in the batch
+	bool        busy;
+	bool        quit;
+
+	TaskPoolState()
+		: batch(0), generation(0), pending(0), busy(false), quit(false)
+	{ }
+};
+
+static void
+TaskWork(TaskBatch* batch)
+{
+	for (;;) {
+		int index = batch->next.fetch_add(1, std::memory_order_relaxed);
+		if (index >= batch->count)
+			break;
+
+		batch->func(batch->param, index);
+	}
+}
+
+static void
+TaskWorker(TaskPoolState* s)
+{
+	unsigned seen = 0;
+
+	std::unique_lock<std::mutex> guard(s->lock);
+
+	for (;;) {
+		while (!s->quit && s->generation == seen)
+			s->wake.wait(guard);
+
+		if (s->quit)
+			return;
+
+		seen = s->generation;
+		TaskBatch* batch = s->batch;
+
+		guard.unlock();
+		TaskWork(batch);
+		guard.lock();
+
+		if (--s->pending == 0)
+			s->done.notify_one();
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+TaskPool::TaskPool(int n)
+	: threads(1), state(new TaskPoolState)
+{
+	SetThreads(n);
+}
+
+TaskPool::~TaskPool()
+{
+	StopWorkers();
+	delete state;
+}
+
+// +--------------------------------------------------------------------+
+
+int
+TaskPool::HardwareThreads()
+{
+	int n = (int)std::thread::hardware_concurrency();
+	return n > 0 ? n : 1;
+}
+
+void
+TaskPool::SetThreads(int n)
+{
+	n = n > 0 ? n : HardwareThreads();
+
+	if (n != threads) {
+		StopWorkers();
+		threads = n;
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+void
+TaskPool::StartWorkers()
+{
+	// the calling thread is the last member of the pool:
+	int workers = threads - 1;
+
+	state->quit = false;
+	state->workers.reserve(workers);
+
+	while ((int)state->workers.size() < workers)
+		state->workers.emplace_back(TaskWorker, state);
+}
+
+void
+TaskPool::StopWorkers()
+{
+	if (state->workers.empty())
+		return;
+
+	{
+		std::lock_guard<std::mutex> guard(state->lock);
+		state->quit = true;
+	}
+
+	state->wake.notify_all();
+
+	for (size_t i = 0; i < state->workers.size(); i++)
+		state->workers[i].join();
+
+	state->workers.clear();
+	state->quit = false;
+}
+
+// +--------------------------------------------------------------------+
+
+void
+TaskPool::Run(int count, TaskFunc func, void* param)
+{
+	if (count < 1 || !func)
+		return;
+
+	bool inline_batch = threads < 2 || count < 2;
+
+	if (!inline_batch) {
+		std::lock_guard<std::mutex> guard(state->lock);
+
+		if (state->busy)
+			inline_batch = true;
+		else
+			state->busy = true;
+	}
+
+	if (inline_batch) {
+		for (int i = 0; i < count; i++)
+			func(param, i);
+		return;
+	}
+
+	TaskBatch batch;
+	batch.func  = func;
+	batch.param = param;
+	batch.count = count;
+	batch.next  = 0;
+
+	{
+		std::lock_guard<std::mutex> guard(state->lock);
+
+		if (state->workers.empty())
+			StartWorkers();
+
+		state->batch   = &batch;
+		state->pending = (int)state->workers.size();
+		state->generation++;
+	}
+
+	state->wake.notify_all();
+
+	TaskWork(&batch);
+
+	std::unique_lock<std::mutex> guard(state->lock);
+
+	while (state->pending > 0)
+		state->done.wait(guard);
+
+	state->batch = 0;
+	state->busy  = false;
+}
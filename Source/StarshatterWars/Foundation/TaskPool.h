@@ -0,0 +1,62 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         TaskPool.h
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Fork/join worker pool for batches of independent tasks.  Run()
+	calls the task function once for every index in [0, count), spread
+	over the pool's worker threads, and returns when all of them have
+	finished.  The calling thread works on the batch as well, so a pool
+	of one thread runs the batch inline, in index order.
+
+	The worker threads are started by the first batch that needs them
+	and then sleep between batches until the pool is destroyed, so a
+	pool should be kept for as long as its owner rather than built for
+	every batch.  A pool runs one batch at a time; Run() called while
+	another batch is in progress (from a task, or from a second thread)
+	runs its batch inline on the calling thread.
+
+	Tasks must not touch shared state; anything that has to be combined
+	should be written to per-index slots and merged by the caller after
+	Run() returns.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// +--------------------------------------------------------------------+
+
+typedef void (*TaskFunc)(void* param, int index);
+
+class STARSHATTERWARS_API TaskPool
+{
+public:
+	static const char* TYPENAME() { return "TaskPool"; }
+
+	// threads <= 0 selects one thread per hardware thread:
+	TaskPool(int threads = 0);
+	~TaskPool();
+
+	int         GetThreads() const { return threads; }
+	void        SetThreads(int n);
+
+	void        Run(int count, TaskFunc func, void* param);
+
+	static int  HardwareThreads();
+
+private:
+	TaskPool(const TaskPool&);
+	TaskPool& operator=(const TaskPool&);
+
+	void        StartWorkers();
+	void        StopWorkers();
+
+	int         threads;
+	struct TaskPoolState* state;
+};
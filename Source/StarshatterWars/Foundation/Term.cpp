@@ -8,11 +8,82 @@
 */
 
 #include "Term.h"
+#include "TermArena.h"
+#include <new>
 
 void Print(const char* fmt, ...);
 
 // +-------------------------------------------------------------------+
 
+// header space, rounded up to keep the term itself 16 byte aligned:
+static const size_t TERM_HEADER_SIZE = (sizeof(TermHeader) + 15) & ~(size_t)15;
+
+static TermHeader*
+HeaderOf(const void* p)
+{
+   return (TermHeader*) ((char*) p - TERM_HEADER_SIZE);
+}
+
+void*
+Term::operator new(size_t size)
+{
+   return operator new(size, (TermArena*) 0);
+}
+
+void*
+Term::operator new(size_t size, TermArena* arena)
+{
+   TermHeader* h = 0;
+
+   if (arena) {
+      h = (TermHeader*) arena->Alloc(TERM_HEADER_SIZE + size);
+      arena->Track(h);
+   }
+   else {
+      h = (TermHeader*) ::operator new(TERM_HEADER_SIZE + size);
+      h->next = 0;
+   }
+
+   h->arena = arena;
+   h->alive = 1;
+
+   return (char*) h + TERM_HEADER_SIZE;
+}
+
+void
+Term::operator delete(void* p)
+{
+   if (!p) return;
+
+   TermHeader* h = HeaderOf(p);
+
+   if (h->arena)
+      h->alive = 0;         // memory goes back with the arena
+   else
+      ::operator delete(h);
+}
+
+void
+Term::operator delete(void* p, TermArena*)
+{
+   // only reached when a constructor throws:
+   operator delete(p);
+}
+
+bool
+Term::inArena() const
+{
+   return HeaderOf(this)->arena != 0;
+}
+
+Term*
+Term::FromHeader(TermHeader* h)
+{
+   return (Term*) ((char*) h + TERM_HEADER_SIZE);
+}
+
+// +-------------------------------------------------------------------+
+
 Term*
 error(char* s1, char* s2)
 {
@@ -38,8 +109,14 @@ TermArray::TermArray(TermList* elist)
 
 TermArray::~TermArray()
 {
-   if (elems) elems->destroy();
-   delete elems;
+   // arena elements and lists are released with the arena:
+   if (inArena()) {
+      if (elems) elems->~TermList();
+   }
+   else {
+      if (elems) elems->destroy();
+      delete elems;
+   }
 }
 
 void
@@ -70,8 +147,13 @@ TermStruct::TermStruct(TermList* elist)
 
 TermStruct::~TermStruct()
 {
-   if (elems) elems->destroy();
-   delete elems;
+   if (inArena()) {
+      if (elems) elems->~TermList();
+   }
+   else {
+      if (elems) elems->destroy();
+      delete elems;
+   }
 }
 
 void
@@ -97,8 +179,10 @@ TermStruct::print(int level)
 
 TermDef::~TermDef()
 {
-   delete mname;
-   delete mval;
+   if (!inArena()) {
+      delete mname;
+      delete mval;
+   }
 }
 
 void
@@ -12,6 +12,7 @@
 #include "CoreMinimal.h"
 #include "Text.h"
 #include "List.h"
+#include "Symbol.h"
 
 /**
  * 
@@ -20,6 +21,7 @@
 // +-------------------------------------------------------------------+
 
 class Term;
+class TermArena;
 class TermBool;
 class TermNumber;
 class TermText;
@@ -29,6 +31,16 @@ class TermStruct;
 
 // +-------------------------------------------------------------------+
 
+// prefix of every term allocation, heap or arena:
+struct TermHeader
+{
+	TermArena*   arena;    // zero for terms on the heap
+	TermHeader*  next;     // arena's list of terms to clean up
+	int          alive;
+};
+
+// +-------------------------------------------------------------------+
+
 class STARSHATTERWARS_API Term
 {
 public:
@@ -37,6 +49,15 @@ public:
 	Term() { }
 	virtual ~Term() { }
 
+	// new(arena) places the term in a TermArena (zero means the heap):
+	static void* operator new(size_t size);
+	static void* operator new(size_t size, TermArena* arena);
+	static void  operator delete(void* p);
+	static void  operator delete(void* p, TermArena* arena);
+
+	bool         inArena() const;
+	static Term* FromHeader(TermHeader* h);
+
 	virtual int operator==(const Term& rhs) const { return 0; }
 
 	virtual void print(int level = 10) { }
@@ -99,14 +120,21 @@ class TermText : public Term
 public:
 	static const char* TYPENAME() { return "TermText"; }
 
-	TermText(const Text& v) : val(v) { }
+	TermText(const Text& v) : val(v), sym(-1) { }
+	TermText(const Text& v, Symbol s) : val(v), sym(s ? (int)s : -1) { }
 
 	virtual void      print(int level = 10);
 	virtual TermText* isText() { return this; }
 	Text      value() const { return val; }
 
+	// interned id of the text, for identifiers and definition names.
+	// quoted strings are looked up (but never added) on first use:
+	Symbol    symbol() { if (sym < 0) sym = Symbol::Find(val); return Symbol(sym); }
+	bool      isInterned() const { return sym > 0; }
+
 private:
 	Text val;
+	int  sym;
 };
 
 // +-------------------------------------------------------------------+
@@ -0,0 +1,107 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         TermArena.cpp
+	AUTHOR:       Carlos Bott
+*/
+
+
+#include "TermArena.h"
+#include "Term.h"
+#include <new>
+
+// +--------------------------------------------------------------------+
+
+static const size_t ARENA_ALIGN = 16;
+
+static size_t
+AlignUp(size_t n)
+{
+	return (n + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+}
+
+// +--------------------------------------------------------------------+
+
+TermArena::TermArena(int size)
+	: block(0), free_ptr(0), free_end(0), block_size(size > 1024 ? size : 1024),
+	  live(0), allocs(0), blocks(0), used(0)
+{ }
+
+TermArena::~TermArena()
+{
+	Reset();
+}
+
+// +--------------------------------------------------------------------+
+
+void*
+TermArena::Alloc(size_t size)
+{
+	size = AlignUp(size);
+
+	if (free_ptr + size > free_end || !free_ptr) {
+		size_t extent = AlignUp(sizeof(Block));
+		size_t bytes  = size > (size_t) block_size - extent ? size + extent : (size_t) block_size;
+
+		Block* b = (Block*) ::operator new(bytes);
+		b->next  = block;
+		b->size  = bytes;
+		block    = b;
+		blocks++;
+
+		free_ptr = (char*) b + extent;
+		free_end = (char*) b + bytes;
+	}
+
+	void* p = free_ptr;
+	free_ptr += size;
+
+	allocs++;
+	used += size;
+	return p;
+}
+
+List<Term>*
+TermArena::CreateList()
+{
+	return new(Alloc(sizeof(List<Term>))) List<Term>;
+}
+
+void
+TermArena::Track(TermHeader* header)
+{
+	header->next = live;
+	live = header;
+}
+
+// +--------------------------------------------------------------------+
+
+void
+TermArena::Reset()
+{
+	// destroy whatever the caller did not delete, so that text and
+	// term lists are released; children are never visited twice since
+	// arena containers leave their elements to us:
+	for (TermHeader* h = live; h; h = h->next) {
+		if (h->alive) {
+			h->alive = 0;
+			Term::FromHeader(h)->~Term();
+		}
+	}
+
+	live = 0;
+
+	while (block) {
+		Block* next = block->next;
+		::operator delete(block);
+		block = next;
+	}
+
+	free_ptr = 0;
+	free_end = 0;
+	allocs   = 0;
+	blocks   = 0;
+	used     = 0;
+}
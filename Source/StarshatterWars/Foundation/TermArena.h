@@ -0,0 +1,73 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         TermArena.h
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Bump allocator for the Term trees of a single parse.  Terms created
+	with new(arena) are carved out of large blocks.  Deleting one of
+	them runs its destructor but gives no memory back, and a container
+	term does not delete its children.  Reset() (or the arena's own
+	destructor) finishes off whatever is still alive and releases the
+	whole tree in one go.
+
+	Loaders can keep their "delete term" loops unchanged.  The arena
+	just has to outlive every term that was allocated from it.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "List.h"
+
+// +--------------------------------------------------------------------+
+
+class Term;
+struct TermHeader;
+
+class STARSHATTERWARS_API TermArena
+{
+public:
+	static const char* TYPENAME() { return "TermArena"; }
+
+	enum { BLOCK_SIZE = 64 * 1024 };
+
+	TermArena(int block_size = BLOCK_SIZE);
+	~TermArena();
+
+	void*       Alloc(size_t size);
+	void        Track(TermHeader* header);
+	void        Reset();
+
+	// an empty term list placed in the arena.  The element array is
+	// freed by the TermArray or TermStruct that takes the list over:
+	List<Term>* CreateList();
+
+	int         NumAllocs()  const { return allocs; }
+	int         NumBlocks()  const { return blocks; }
+	size_t      BytesUsed()  const { return used; }
+
+private:
+	TermArena(const TermArena&);
+	TermArena& operator=(const TermArena&);
+
+	struct Block {
+		Block*  next;
+		size_t  size;
+	};
+
+	Block*      block;        // current block, linked to older ones
+	char*       free_ptr;
+	char*       free_end;
+	int         block_size;
+
+	TermHeader* live;         // every tracked term, newest first
+
+	int         allocs;
+	int         blocks;
+	size_t      used;
+};
@@ -0,0 +1,336 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         TermBinder.cpp
+	AUTHOR:       Carlos Bott
+*/
+
+
+#include "TermBinder.h"
+
+// +--------------------------------------------------------------------+
+
+TermBinder::TermBinder(const char* fname)
+	: filename(fname ? fname : ""), field(0), value(false), defs(0), depth(0),
+	  active(0), in_vec(false), vec_size(0)
+{ }
+
+TermBinder::~TermBinder()
+{
+	bindings.destroy();
+}
+
+// +--------------------------------------------------------------------+
+
+void
+TermBinder::Bind(Symbol k, int kind, void* dst, TermBinder* nested)
+{
+	Binding* b = new Binding;
+	b->key     = k;
+	b->kind    = kind;
+	b->dst     = dst;
+	b->nested  = nested;
+
+	bindings.append(b);
+}
+
+void TermBinder::BindText(Symbol k, Text* dst)     { Bind(k, BIND_TEXT,   dst); }
+void TermBinder::BindNumber(Symbol k, int* dst)    { Bind(k, BIND_INT,    dst); }
+void TermBinder::BindNumber(Symbol k, DWORD* dst)  { Bind(k, BIND_DWORD,  dst); }
+void TermBinder::BindNumber(Symbol k, float* dst)  { Bind(k, BIND_FLOAT,  dst); }
+void TermBinder::BindNumber(Symbol k, double* dst) { Bind(k, BIND_DOUBLE, dst); }
+void TermBinder::BindBool(Symbol k, bool* dst)     { Bind(k, BIND_BOOL,   dst); }
+void TermBinder::BindVec(Symbol k, Vec3* dst)      { Bind(k, BIND_VEC,    dst); }
+
+void
+TermBinder::BindStruct(Symbol k, TermBinder* nested)
+{
+	if (nested) {
+		nested->SetFilename(filename);
+		Bind(k, BIND_STRUCT, 0, nested);
+	}
+}
+
+void
+TermBinder::SetFilename(const char* fname)
+{
+	filename = fname ? fname : "";
+
+	for (int i = 0; i < bindings.size(); i++)
+		if (bindings[i]->nested)
+			bindings[i]->nested->SetFilename(filename);
+}
+
+TermBinder::Binding*
+TermBinder::Find(Symbol k)
+{
+	// records have a dozen or so keys, a scan is cheaper than a hash:
+	for (int i = 0; i < bindings.size(); i++)
+		if (bindings[i]->key == k)
+			return bindings[i];
+
+	return 0;
+}
+
+const char*
+TermBinder::KindName(int kind)
+{
+	switch (kind) {
+	case BIND_TEXT:   return "TEXT";
+	case BIND_BOOL:   return "BOOL";
+	case BIND_VEC:    return "VEC3";
+	case BIND_STRUCT: return "STRUCT";
+	default:          return "NUMBER";
+	}
+}
+
+void
+TermBinder::Invalid()
+{
+	if (field->kind == BIND_VEC)
+		UE_LOG(LogTemp, Log, TEXT("WARNING: vector expected in '%s'"), *FString(filename));
+
+	else if (field->kind == BIND_STRUCT)
+		UE_LOG(LogTemp, Log, TEXT("WARNING: %s struct missing in '%s'"), *FString(key_name.data()), *FString(filename));
+
+	else
+		UE_LOG(LogTemp, Log, TEXT("WARNING: invalid %s %s in '%s'"), *FString(KindName(field->kind)), *FString(key_name.data()), *FString(filename));
+}
+
+// +--------------------------------------------------------------------+
+
+void
+TermBinder::OnKey(Symbol k, const Text& name)
+{
+	if (active) {
+		active->OnKey(k, name);
+		return;
+	}
+
+	if (depth > 0)
+		return;
+
+	if (defs++ > 0) {
+		// a definition as the value of a definition:
+		if (defs == 2 && !value) {
+			value = true;
+			if (field) Invalid();
+		}
+		return;
+	}
+
+	key      = k;
+	key_name = name;
+	field    = Find(k);
+	value    = false;
+}
+
+void
+TermBinder::OnKeyEnd()
+{
+	if (active) {
+		active->OnKeyEnd();
+		return;
+	}
+
+	if (depth > 0 || --defs > 0)
+		return;
+
+	if (field && !value)
+		UE_LOG(LogTemp, Log, TEXT("WARNING: missing %s TermDef in '%s'"), *FString(KindName(field->kind)), *FString(filename));
+
+	EndField(key);
+	field = 0;
+}
+
+// +--------------------------------------------------------------------+
+
+void
+TermBinder::OnStructBegin()
+{
+	if (active) {
+		active->OnStructBegin();
+		return;
+	}
+
+	if (InField()) {
+		value = true;
+
+		if (field && field->kind == BIND_STRUCT) {
+			active           = field->nested;
+			active->field    = 0;
+			active->defs     = 0;
+			active->depth    = 0;
+			active->active   = 0;
+			active->in_vec   = false;
+			active->BeginRecord();
+			return;
+		}
+
+		if (field) Invalid();
+	}
+	else if (in_vec && depth == 1) {
+		vec_size = -1;
+	}
+
+	depth++;
+}
+
+void
+TermBinder::OnStructEnd()
+{
+	if (active) {
+		if (active->depth == 0 && active->defs == 0 && !active->active) {
+			active->EndRecord();
+			active = 0;
+		}
+		else {
+			active->OnStructEnd();
+		}
+		return;
+	}
+
+	depth--;
+}
+
+void
+TermBinder::OnArrayBegin()
+{
+	if (active) {
+		active->OnArrayBegin();
+		return;
+	}
+
+	if (InField()) {
+		value = true;
+
+		if (field && field->kind == BIND_VEC) {
+			in_vec   = true;
+			vec_size = 0;
+		}
+		else if (field) {
+			Invalid();
+		}
+	}
+	else if (in_vec && depth == 1) {
+		vec_size = -1;
+	}
+
+	depth++;
+}
+
+void
+TermBinder::OnArrayEnd()
+{
+	if (active) {
+		active->OnArrayEnd();
+		return;
+	}
+
+	if (--depth > 0 || !in_vec)
+		return;
+
+	in_vec = false;
+
+	if (vec_size != 3) {
+		UE_LOG(LogTemp, Log, TEXT("WARNING: malformed vector in '%s'"), *FString(filename));
+		return;
+	}
+
+	Vec3* dst = (Vec3*) field->dst;
+	dst->x = (float) vec[0];
+	dst->y = (float) vec[1];
+	dst->z = (float) vec[2];
+}
+
+// +--------------------------------------------------------------------+
+
+void
+TermBinder::OnText(const Text& v, Symbol sym)
+{
+	if (active) {
+		active->OnText(v, sym);
+		return;
+	}
+
+	if (in_vec && depth == 1) {
+		vec_size = -1;
+		return;
+	}
+
+	if (!InField())
+		return;
+
+	value = true;
+
+	if (!field)
+		return;
+
+	if (field->kind == BIND_TEXT)
+		*((Text*) field->dst) = v;
+	else
+		Invalid();
+}
+
+void
+TermBinder::OnNumber(double v)
+{
+	if (active) {
+		active->OnNumber(v);
+		return;
+	}
+
+	if (in_vec && depth == 1) {
+		if (vec_size >= 0 && vec_size < 3)
+			vec[vec_size] = v;
+
+		if (vec_size >= 0)
+			vec_size++;
+		return;
+	}
+
+	if (!InField())
+		return;
+
+	value = true;
+
+	if (!field)
+		return;
+
+	switch (field->kind) {
+	case BIND_INT:    *((int*)    field->dst) = (int)   v;  break;
+	case BIND_DWORD:  *((DWORD*)  field->dst) = (DWORD) v;  break;
+	case BIND_FLOAT:  *((float*)  field->dst) = (float) v;  break;
+	case BIND_DOUBLE: *((double*) field->dst) = v;          break;
+	default:          Invalid();                            break;
+	}
+}
+
+void
+TermBinder::OnBool(bool v)
+{
+	if (active) {
+		active->OnBool(v);
+		return;
+	}
+
+	if (in_vec && depth == 1) {
+		vec_size = -1;
+		return;
+	}
+
+	if (!InField())
+		return;
+
+	value = true;
+
+	if (!field)
+		return;
+
+	if (field->kind == BIND_BOOL)
+		*((bool*) field->dst) = v;
+	else
+		Invalid();
+}
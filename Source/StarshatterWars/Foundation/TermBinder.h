@@ -0,0 +1,107 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         TermBinder.h
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Schema binding for a TermStream.  A TermBinder is a table of keys,
+	each bound to a destination variable (or to another binder for a
+	nested struct).  As the stream goes past, every value whose key is
+	bound is converted and stored, with the same conversions and
+	warnings as the GetDef functions in ParseUtil.  Keys that are not
+	bound are skipped along with everything inside them.
+
+	Handed straight to a TermStream, a binder treats the top level of
+	the file as its record.  Bound to a key of another binder, it fills
+	one record for each struct value of that key; BeginRecord, EndField
+	and EndRecord let a subclass reset its destination and act on each
+	field or record as it completes.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Types.h"
+#include "List.h"
+#include "Text.h"
+#include "Symbol.h"
+#include "Geometry.h"
+#include "TermStream.h"
+
+// +--------------------------------------------------------------------+
+
+class STARSHATTERWARS_API TermBinder : public TermHandler
+{
+public:
+	static const char* TYPENAME() { return "TermBinder"; }
+
+	TermBinder(const char* filename = 0);
+	virtual ~TermBinder();
+
+	void           BindText(Symbol key, Text* dst);
+	void           BindNumber(Symbol key, int* dst);
+	void           BindNumber(Symbol key, DWORD* dst);
+	void           BindNumber(Symbol key, float* dst);
+	void           BindNumber(Symbol key, double* dst);
+	void           BindBool(Symbol key, bool* dst);
+	void           BindVec(Symbol key, Vec3* dst);
+	void           BindStruct(Symbol key, TermBinder* nested);
+
+	// file name for warnings, passed on to nested binders:
+	void           SetFilename(const char* filename);
+
+	// hooks for subclasses.  EndField is called for every key of the
+	// record, bound or not, after its value has been stored:
+	virtual void   BeginRecord() { }
+	virtual void   EndField(Symbol key) { }
+	virtual void   EndRecord() { }
+
+	// TermHandler:
+	virtual void   OnKey(Symbol key, const Text& name);
+	virtual void   OnKeyEnd();
+	virtual void   OnStructBegin();
+	virtual void   OnStructEnd();
+	virtual void   OnArrayBegin();
+	virtual void   OnArrayEnd();
+	virtual void   OnText(const Text& value, Symbol sym);
+	virtual void   OnNumber(double value);
+	virtual void   OnBool(bool value);
+
+protected:
+	enum KINDS { BIND_TEXT, BIND_INT, BIND_DWORD, BIND_FLOAT, BIND_DOUBLE,
+	             BIND_BOOL, BIND_VEC, BIND_STRUCT };
+
+	struct Binding {
+		static const char* TYPENAME() { return "TermBinder::Binding"; }
+
+		Symbol      key;
+		int         kind;
+		void*       dst;
+		TermBinder* nested;
+	};
+
+	void           Bind(Symbol key, int kind, void* dst, TermBinder* nested = 0);
+	Binding*       Find(Symbol key);
+	bool           InField() const { return depth == 0 && defs == 1 && !value; }
+	void           Invalid();
+	static const char* KindName(int kind);
+
+	List<Binding>  bindings;
+	const char*    filename;
+
+	Symbol         key;        // key of the current field
+	Text           key_name;
+	Binding*       field;      // its binding, if the key is bound
+	bool           value;      // a value was seen for the field
+	int            defs;       // nesting of definitions at depth zero
+	int            depth;      // nesting of skipped structs and arrays
+	TermBinder*    active;     // nested binder receiving the events
+
+	bool           in_vec;
+	int            vec_size;
+	double         vec[3];
+};
@@ -0,0 +1,457 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         TermCache.cpp
+	AUTHOR:       Carlos Bott
+*/
+
+
+#include "TermCache.h"
+#include "ParsedFile.h"
+#include "MappedFile.h"
+#include "Term.h"
+#include "TermArena.h"
+#include <stdio.h>
+#include <string.h>
+
+// +--------------------------------------------------------------------+
+// cache file layout:
+//
+//   header    TermCacheHeader
+//   path      header.path_len bytes, no terminator
+//   payload   header.count tagged terms, header.payload bytes
+//
+// every term starts with one tag byte:
+//
+//   TAG_NULL                                (missing def value)
+//   TAG_FALSE, TAG_TRUE
+//   TAG_NUMBER   double
+//   TAG_TEXT     int length, chars          (quoted string)
+//   TAG_IDENT    int length, chars          (interned identifier)
+//   TAG_DEF      name term, value term
+//   TAG_ARRAY    int count, terms
+//   TAG_STRUCT   int count, terms
+
+enum TERM_CACHE_TAGS {
+	TAG_NULL, TAG_FALSE, TAG_TRUE, TAG_NUMBER,
+	TAG_TEXT, TAG_IDENT, TAG_DEF, TAG_ARRAY, TAG_STRUCT
+};
+
+struct TermCacheHeader
+{
+	char        magic[4];
+	int         version;
+	int         endian;
+	int         path_len;
+	long long   source_size;
+	uint64      source_hash;
+	int         count;
+	int         payload;
+	unsigned    checksum;
+	int         reserved;
+};
+
+static const char  TERM_CACHE_MAGIC[4] = { 'S', 'S', 'W', 'T' };
+static const int   TERM_CACHE_ENDIAN   = 0x01020304;
+static const int   TERM_CACHE_DEPTH    = 256;
+
+// +--------------------------------------------------------------------+
+
+class TermCacheWriter
+{
+public:
+	TermCacheWriter() : data(0), size(0), extent(0) { }
+	~TermCacheWriter() { delete[] data; }
+
+	void  Write(const void* p, int n)
+	{
+		if (size + n > extent) {
+			int   grow = extent ? extent * 2 : 4096;
+			while (grow < size + n) grow *= 2;
+
+			char* d = new char[grow];
+			if (size) CopyMemory(d, data, size);
+			delete[] data;
+
+			data   = d;
+			extent = grow;
+		}
+
+		CopyMemory(data + size, p, n);
+		size += n;
+	}
+
+	void  Byte(int b)          { char c = (char)b; Write(&c, 1); }
+	void  Int(int i)           { Write(&i, sizeof(i)); }
+	void  Number(double d)     { Write(&d, sizeof(d)); }
+
+	void  String(int tag, const Text& t)
+	{
+		Byte(tag);
+		Int(t.length());
+		Write(t.data(), t.length());
+	}
+
+	void  Terms(TermList* list)
+	{
+		int n = list ? list->size() : 0;
+		Int(n);
+
+		for (int i = 0; i < n; i++)
+			Put(list->at(i));
+	}
+
+	void  Put(Term* term)
+	{
+		if (!term) {
+			Byte(TAG_NULL);
+		}
+		else if (term->isBool()) {
+			Byte(term->isBool()->value() ? TAG_TRUE : TAG_FALSE);
+		}
+		else if (term->isNumber()) {
+			Byte(TAG_NUMBER);
+			Number(term->isNumber()->value());
+		}
+		else if (term->isText()) {
+			TermText* t = term->isText();
+			String(t->isInterned() ? TAG_IDENT : TAG_TEXT, t->value());
+		}
+		else if (term->isDef()) {
+			Byte(TAG_DEF);
+			Put(term->isDef()->name());
+			Put(term->isDef()->term());
+		}
+		else if (term->isArray()) {
+			Byte(TAG_ARRAY);
+			Terms(term->isArray()->elements());
+		}
+		else if (term->isStruct()) {
+			Byte(TAG_STRUCT);
+			Terms(term->isStruct()->elements());
+		}
+		else {
+			Byte(TAG_NULL);
+		}
+	}
+
+	char* data;
+	int   size;
+	int   extent;
+};
+
+// +--------------------------------------------------------------------+
+
+class TermCacheReader
+{
+public:
+	TermCacheReader(const char* p, int n, TermArena* a)
+		: data(p), size(n), pos(0), failed(false), arena(a) { }
+
+	bool  Read(void* p, int n)
+	{
+		if (failed || n < 0 || n > size - pos) {
+			failed = true;
+			return false;
+		}
+
+		CopyMemory(p, data + pos, n);
+		pos += n;
+		return true;
+	}
+
+	int   Byte()               { unsigned char c = 0; Read(&c, 1); return c; }
+	int   Int()                { int i = 0; Read(&i, sizeof(i)); return i; }
+	double Number()            { double d = 0; Read(&d, sizeof(d)); return d; }
+
+	Text  String()
+	{
+		int n = Int();
+
+		if (failed || n < 0 || n > size - pos) {
+			failed = true;
+			return Text();
+		}
+
+		Text t(data + pos, n);
+		pos += n;
+		return t;
+	}
+
+	TermList* Terms(int depth)
+	{
+		int n = Int();
+
+		if (failed || n < 0 || n > size - pos) {
+			failed = true;
+			return 0;
+		}
+
+		TermList* list = arena ? arena->CreateList() : new TermList;
+		list->reserve(n);
+
+		for (int i = 0; i < n && !failed; i++) {
+			Term* t = Get(depth + 1);
+			if (t) list->append(t);
+		}
+
+		return list;
+	}
+
+	Term* Get(int depth = 0)
+	{
+		if (failed || depth > TERM_CACHE_DEPTH) {
+			failed = true;
+			return 0;
+		}
+
+		switch (Byte()) {
+		case TAG_NULL:    return 0;
+		case TAG_FALSE:   return new(arena) TermBool(false);
+		case TAG_TRUE:    return new(arena) TermBool(true);
+		case TAG_NUMBER:  return new(arena) TermNumber(Number());
+		case TAG_TEXT:    return new(arena) TermText(String());
+
+		case TAG_IDENT: {
+				Text s = String();
+				return new(arena) TermText(s, Symbol::Intern(s));
+			}
+
+		case TAG_DEF: {
+				Term* name = Get(depth + 1);
+				Term* val  = Get(depth + 1);
+
+				if (!name || !name->isText()) {
+					delete name;
+					delete val;
+					failed = true;
+					return 0;
+				}
+
+				return new(arena) TermDef(name->isText(), val);
+			}
+
+		case TAG_ARRAY: {
+				TermList* list = Terms(depth);
+				return list ? new(arena) TermArray(list) : 0;
+			}
+
+		case TAG_STRUCT: {
+				TermList* list = Terms(depth);
+				return list ? new(arena) TermStruct(list) : 0;
+			}
+		}
+
+		failed = true;
+		return 0;
+	}
+
+	const char* data;
+	int         size;
+	int         pos;
+	bool        failed;
+	TermArena*  arena;
+};
+
+// +--------------------------------------------------------------------+
+
+static unsigned
+Checksum(const char* p, int n)
+{
+	// FNV-1a, enough to catch torn or damaged cache files:
+	unsigned h = 2166136261u;
+
+	for (int i = 0; i < n; i++) {
+		h ^= (unsigned char)p[i];
+		h *= 16777619u;
+	}
+
+	return h;
+}
+
+// +--------------------------------------------------------------------+
+
+TermCache::TermCache()
+{ }
+
+TermCache::TermCache(const char* dir)
+{
+	SetDirectory(dir);
+}
+
+TermCache::~TermCache()
+{ }
+
+void
+TermCache::SetDirectory(const char* dir)
+{
+	directory = dir ? dir : "";
+
+	int len = directory.length();
+	if (len && directory[len - 1] != '/' && directory[len - 1] != '\\')
+		directory.append('/');
+}
+
+// +--------------------------------------------------------------------+
+
+uint64
+TermCache::Stamp(const char* text, int len)
+{
+	// 64 bit FNV-1a of the source text, so an edit is seen even when
+	// it keeps the file size and lands within the same second:
+	uint64 h = 14695981039346656037ull;
+
+	for (int i = 0; i < len; i++) {
+		h ^= (unsigned char)text[i];
+		h *= 1099511628211ull;
+	}
+
+	return h;
+}
+
+Text
+TermCache::CacheName(const char* source) const
+{
+	if (!IsEnabled() || !source)
+		return Text();
+
+	const char* base = source;
+	for (const char* p = source; *p; p++)
+		if (*p == '/' || *p == '\\')
+			base = p + 1;
+
+	char hash[16];
+	sprintf_s(hash, ".%08x.tc", Text::hashOf(source));
+
+	Text name = directory;
+	name.append(base);
+	name.append(hash);
+	return name;
+}
+
+// +--------------------------------------------------------------------+
+
+bool
+TermCache::Load(const char* source, const char* text, int len, ParsedFile& content) const
+{
+	content.Clear();
+
+	if (!IsEnabled() || !source || !text || len < 0)
+		return false;
+
+	Text        name = CacheName(source);
+	MappedFile  file;
+
+	if (!file.Open(name) || file.GetSize() < (int) sizeof(TermCacheHeader))
+		return false;
+
+	TermCacheHeader header;
+	CopyMemory(&header, file.GetData(), sizeof(header));
+
+	int path_len = (int) ::strlen(source);
+
+	if (memcmp(header.magic, TERM_CACHE_MAGIC, 4) ||
+			header.version     != VERSION           ||
+			header.endian      != TERM_CACHE_ENDIAN ||
+			header.source_size != len               ||
+			header.source_hash != Stamp(text, len)  ||
+			header.path_len    != path_len          ||
+			header.count        < 0                 ||
+			header.payload      < 0                 ||
+			header.payload     != file.GetSize() - (int) sizeof(header) - path_len)
+		return false;
+
+	const char* path    = file.GetData() + sizeof(header);
+	const char* payload = path + path_len;
+
+	if (memcmp(path, source, path_len) ||
+			Checksum(payload, header.payload) != header.checksum)
+		return false;
+
+	TermCacheReader reader(payload, header.payload, content.GetArena());
+
+	for (int i = 0; i < header.count && !reader.failed; i++) {
+		Term* term = reader.Get();
+
+		if (term)
+			content.AppendTerm(term);
+		else
+			reader.failed = true;
+	}
+
+	if (reader.failed || reader.pos != header.payload) {
+		content.Clear();
+		return false;
+	}
+
+	content.SetLoaded();
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+bool
+TermCache::Store(const char* source, const char* text, int len, const ParsedFile& content) const
+{
+	if (!IsEnabled() || !source || !text || len < 0 || !content.IsClean())
+		return false;
+
+	TermCacheWriter writer;
+
+	for (int i = 0; i < content.NumTerms(); i++)
+		writer.Put(content.GetTerm(i));
+
+	TermCacheHeader header;
+	ZeroMemory(&header, sizeof(header));
+	CopyMemory(header.magic, TERM_CACHE_MAGIC, 4);
+
+	header.version     = VERSION;
+	header.endian      = TERM_CACHE_ENDIAN;
+	header.path_len    = (int) ::strlen(source);
+	header.source_size = len;
+	header.source_hash = Stamp(text, len);
+	header.count       = content.NumTerms();
+	header.payload     = writer.size;
+	header.checksum    = Checksum(writer.data, writer.size);
+
+	// write a private temp file and rename it into place, so a reader
+	// never sees a half written cache:
+	Text name = CacheName(source);
+	Text temp = name + ".tmp";
+
+	FILE* f = 0;
+#if defined(_WIN32)
+	if (::fopen_s(&f, temp, "wb") != 0)
+		f = 0;
+#else
+	f = ::fopen(temp, "wb");
+#endif
+
+	if (!f)
+		return false;
+
+	bool ok = ::fwrite(&header, sizeof(header), 1, f) == 1 &&
+	          ::fwrite(source, 1, header.path_len, f) == (size_t) header.path_len &&
+	          (writer.size == 0 || ::fwrite(writer.data, 1, writer.size, f) == (size_t) writer.size);
+
+	ok = (::fclose(f) == 0) && ok;
+
+	if (ok) {
+		::remove(name);
+		ok = ::rename(temp, name) == 0;
+	}
+
+	if (!ok)
+		::remove(temp);
+
+	return ok;
+}
+
+void
+TermCache::Remove(const char* source) const
+{
+	if (IsEnabled() && source)
+		::remove(CacheName(source));
+}
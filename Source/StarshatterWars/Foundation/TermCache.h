@@ -0,0 +1,62 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         TermCache.h
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Binary cache of parsed definition files.  Each source file gets one
+	cache file holding its top level terms in a compact tagged format,
+	stamped with the source path, length and a 64 bit hash of the
+	source text.  The caller reads the text and hands it in; when the
+	stamp still matches, Load() rebuilds the terms straight from the
+	cache and the Scanner and Parser are skipped.  A stale, truncated or
+	corrupt cache file simply fails to load and the caller falls back to
+	parsing the text, then calls Store() to refresh it.  Only clean
+	parses are stored, so a file with a syntax error is parsed (and its
+	errors reported) every time.
+
+	Load() and Store() only touch the cache file for the source they
+	are given, so a TaskPool may call them for different files at once.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Types.h"
+#include "Text.h"
+
+// +--------------------------------------------------------------------+
+
+class ParsedFile;
+
+class STARSHATTERWARS_API TermCache
+{
+public:
+	static const char* TYPENAME() { return "TermCache"; }
+
+	enum { VERSION = 2 };
+
+	TermCache();
+	TermCache(const char* dir);
+	~TermCache();
+
+	void        SetDirectory(const char* dir);
+	const char* GetDirectory() const { return directory; }
+	bool        IsEnabled()    const { return directory.length() > 0; }
+
+	// text and len are the current contents of the source file:
+	bool        Load(const char* source, const char* text, int len, ParsedFile& content) const;
+	bool        Store(const char* source, const char* text, int len, const ParsedFile& content) const;
+	void        Remove(const char* source) const;
+
+	Text        CacheName(const char* source) const;
+
+	static uint64  Stamp(const char* text, int len);
+
+private:
+	Text        directory;
+};
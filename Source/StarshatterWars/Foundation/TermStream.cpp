@@ -0,0 +1,224 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         TermStream.cpp
+	AUTHOR:       Carlos Bott
+*/
+
+
+#include "TermStream.h"
+#include "Parser.h"
+#include "Reader.h"
+#include "Token.h"
+
+// +--------------------------------------------------------------------+
+
+TermStream::TermStream(Reader* r)
+	: failed(false)
+{
+	Parser::AddKeys();
+
+	reader = r ? r : new ConsoleReader;
+	lexer  = new Scanner(reader);
+}
+
+TermStream::~TermStream()
+{
+	delete lexer;
+	delete reader;
+}
+
+// +--------------------------------------------------------------------+
+
+bool
+TermStream::ParseTerm(TermHandler& handler)
+{
+	if (failed)
+		return false;
+
+	return ParseTerm(handler, IN_VALUE) > 0;
+}
+
+// +--------------------------------------------------------------------+
+
+class FileTypeHandler : public TermHandler
+{
+public:
+	FileTypeHandler() : events(0) { }
+
+	virtual void   OnKey(Symbol key, const Text& name) { events++; }
+	virtual void   OnStructBegin()                     { events++; }
+	virtual void   OnArrayBegin()                      { events++; }
+	virtual void   OnText(const Text& v, Symbol sym)   { events++; value = v; }
+	virtual void   OnNumber(double v)                  { events++; }
+	virtual void   OnBool(bool v)                      { events++; }
+
+	Text  value;
+	int   events;
+};
+
+bool
+TermStream::ParseFileType(const char* type)
+{
+	FileTypeHandler handler;
+
+	if (!ParseTerm(handler))
+		return false;
+
+	return handler.events == 1 && handler.value == type;
+}
+
+// +--------------------------------------------------------------------+
+
+int
+TermStream::ParseTerm(TermHandler& handler, int context)
+{
+	Token t = lexer->Get();
+
+	switch (t.type()) {
+	case Token::IntLiteral:
+	case Token::FloatLiteral:
+		if (context == IN_STRUCT)
+			return Error("non-definition term in struct");
+
+		handler.OnNumber(Parser::NumberValue(t));
+		return 1;
+
+	case Token::StringLiteral:
+		return ParseText(handler, context, t.symbol()(1, t.symbol().length() - 2), Symbol());
+
+	case Token::AlphaIdent:
+		return ParseText(handler, context, t.symbol(), t.sym());
+
+	case Token::Keyword:
+		switch (t.key()) {
+		case Parser::KEY_FALSE:
+		case Parser::KEY_TRUE:
+			if (context == IN_STRUCT)
+				return Error("non-definition term in struct");
+
+			handler.OnBool(t.key() == Parser::KEY_TRUE);
+			return 1;
+
+		case Parser::KEY_MINUS: {
+			Token next = lexer->Get();
+			if (next.type() != Token::IntLiteral && next.type() != Token::FloatLiteral) {
+				lexer->PutBack();
+				return Error("illegal token '-': number expected");
+			}
+
+			if (context == IN_STRUCT)
+				return Error("non-definition term in struct");
+
+			handler.OnNumber(Parser::NumberValue(next, true));
+			return 1;
+		}
+
+		default:
+			lexer->PutBack();
+			return 0;
+		}
+
+	case Token::LParen:
+		if (context == IN_STRUCT)
+			return Error("non-definition term in struct");
+
+		handler.OnArrayBegin();
+		if (ParseList(handler, IN_ARRAY) < 0)
+			return -1;
+
+		if (lexer->Get().type() != Token::RParen)
+			return Error("illegal token");
+
+		handler.OnArrayEnd();
+		return 1;
+
+	case Token::LBrace:
+		if (context == IN_STRUCT)
+			return Error("non-definition term in struct");
+
+		handler.OnStructBegin();
+		if (ParseList(handler, IN_STRUCT) < 0)
+			return -1;
+
+		if (lexer->Get().type() != Token::RBrace)
+			return Error("'}' missing in struct");
+
+		handler.OnStructEnd();
+		return 1;
+
+	case Token::CharLiteral:
+		UE_LOG(LogTemp, Log, TEXT("(Parse) illegal token"));
+
+	default:
+		lexer->PutBack();
+		return 0;
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+int
+TermStream::ParseText(TermHandler& handler, int context, const Text& first, Symbol sym)
+{
+	Text  value = first;
+	Token t     = lexer->Get();
+
+	// concatenate adjacent string literal tokens:
+	while (t.type() == Token::StringLiteral) {
+		value = value + t.symbol()(1, t.symbol().length() - 2);
+		sym   = Symbol();
+		t     = lexer->Get();
+	}
+
+	if (t.type() == Token::Keyword && t.key() == Parser::KEY_DEF) {
+		if (context == IN_ARRAY)
+			return Error("illegal definition in array");
+
+		handler.OnKey(sym ? sym : Symbol::Find(value), value);
+
+		if (ParseTerm(handler, IN_VALUE) < 0)
+			return -1;
+
+		handler.OnKeyEnd();
+		return 1;
+	}
+
+	lexer->PutBack();
+
+	if (context == IN_STRUCT)
+		return Error("non-definition term in struct");
+
+	handler.OnText(value, sym);
+	return 1;
+}
+
+// +--------------------------------------------------------------------+
+
+int
+TermStream::ParseList(TermHandler& handler, int context)
+{
+	int result = ParseTerm(handler, context);
+
+	while (result > 0) {
+		// comma separators are optional:
+		if (lexer->Get().type() != Token::Comma)
+			lexer->PutBack();
+
+		result = ParseTerm(handler, context);
+	}
+
+	return result;
+}
+
+// +--------------------------------------------------------------------+
+
+int
+TermStream::Error(const char* msg)
+{
+	UE_LOG(LogTemp, Log, TEXT("(Parse) %s near line %d"), *FString(msg), lexer->GetLine());
+	failed = true;
+	return -1;
+}
@@ -0,0 +1,93 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         TermStream.h
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Event driven alternative to the Parser.  TermStream reads the same
+	grammar straight from the Scanner, but instead of building a Term
+	tree it reports each key, value and bracket to a TermHandler as the
+	tokens go past.  Nothing is allocated for the structure of the file,
+	so a loader that only copies fields into its own records never pays
+	for a tree it throws away.
+
+	The events for a definition are OnKey, the events of its value,
+	then OnKeyEnd.  Structs and arrays are bracketed by their Begin and
+	End events.  Texts, numbers and booleans have the values the Parser
+	would have put in the matching TermText, TermNumber and TermBool.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Types.h"
+#include "Text.h"
+#include "Symbol.h"
+
+// +--------------------------------------------------------------------+
+
+class Reader;
+class Scanner;
+
+// +--------------------------------------------------------------------+
+
+class STARSHATTERWARS_API TermHandler
+{
+public:
+	static const char* TYPENAME() { return "TermHandler"; }
+
+	TermHandler() { }
+	virtual ~TermHandler() { }
+
+	virtual void   OnKey(Symbol key, const Text& name) { }
+	virtual void   OnKeyEnd() { }
+
+	virtual void   OnStructBegin() { }
+	virtual void   OnStructEnd() { }
+	virtual void   OnArrayBegin() { }
+	virtual void   OnArrayEnd() { }
+
+	// sym is only set for bare identifiers:
+	virtual void   OnText(const Text& value, Symbol sym) { }
+	virtual void   OnNumber(double value) { }
+	virtual void   OnBool(bool value) { }
+};
+
+// +--------------------------------------------------------------------+
+
+class STARSHATTERWARS_API TermStream
+{
+public:
+	static const char* TYPENAME() { return "TermStream"; }
+
+	// the stream takes ownership of the reader, as the Parser does:
+	TermStream(Reader* r);
+	~TermStream();
+
+	// reports the next top level term to the handler.  returns false
+	// at the end of the input or on a syntax error, which stops the
+	// stream partway through a term:
+	bool     ParseTerm(TermHandler& handler);
+
+	// reads the leading file type identifier and checks it:
+	bool     ParseFileType(const char* type);
+
+	bool     Failed() const { return failed; }
+
+private:
+	enum CONTEXT { IN_VALUE, IN_ARRAY, IN_STRUCT };
+
+	// one for a term, zero for no term, minus one for an error:
+	int      ParseTerm(TermHandler& handler, int context);
+	int      ParseText(TermHandler& handler, int context, const Text& first, Symbol sym);
+	int      ParseList(TermHandler& handler, int context);
+	int      Error(const char* msg);
+
+	Reader*  reader;
+	Scanner* lexer;
+	bool     failed;
+};
@@ -19,97 +19,127 @@
 
 TextRep        TextRep::nullrep;
 
-TextRep::TextRep()
-    : ref(1234567), data(0), length(0), hash(0), sensitive(true)
+#if WITH_DEV_AUTOMATION_TESTS
+static std::atomic<long> heap_blocks(0);
+#endif
+
+long
+TextRep::NumHeapBlocks()
 {
-    data = new char[4];
+#if WITH_DEV_AUTOMATION_TESTS
+    return heap_blocks.load(std::memory_order_relaxed);
+#else
+    return 0;
+#endif
+}
 
-    if (data)
-        ZeroMemory(data, 4);
+TextRep::TextRep()
+    : data(local), ref(1234567), length(0), hash(0), sensitive(true)
+{
+    ZeroMemory(local, sizeof(local));
 }
 
 // +-------------------------------------------------------------------+
 
-ThreadSync TextRep::sync;
-
-
 TextRep::TextRep(const char* s)
-    : ref(1), length(0), sensitive(true)
+    : data(0), ref(1), length(0), sensitive(true)
 {
     if (s) length = ::strlen(s);
 
-    data = new char[length + 1];
+    alloc(length);
 
-    if (data) {
-        if (s) ::strcpy(data, s);
-        else   data[length] = '\0';
+    if (s) ::CopyMemory(data, s, length);
+    data[length] = '\0';
 
-        dohash();
-    }
+    dohash();
 }
 
 TextRep::TextRep(const char* s, int len)
-    : ref(1), length(len), sensitive(true)
+    : data(0), ref(1), length(len), sensitive(true)
 {
     if (length < 0) length = 0;
 
-    data = new char[length + 1];
+    alloc(length);
 
-    if (data) {
-        ::CopyMemory(data, s, length);
-        data[length] = '\0';
-        dohash();
-    }
+    ::CopyMemory(data, s, length);
+    data[length] = '\0';
+    dohash();
+}
+
+TextRep::TextRep(const char* a, int alen, const char* b, int blen)
+    : data(0), ref(1), length(alen + blen), sensitive(true)
+{
+    alloc(length);
+
+    ::CopyMemory(data, a, alen);
+    ::CopyMemory(data + alen, b, blen);
+    data[length] = '\0';
+    dohash();
 }
 
 TextRep::TextRep(char c, int len)
-    : ref(1), length(len), sensitive(true)
+    : data(0), ref(1), length(len), sensitive(true)
 {
     if (length < 0) length = 0;
 
-    data = new char[length + 1];
+    alloc(length);
 
-    if (data) {
-        ::FillMemory(data, length, c);
-        data[length] = '\0';
-        dohash();
-    }
+    ::FillMemory(data, length, c);
+    data[length] = '\0';
+    dohash();
 }
 
 TextRep::TextRep(const TextRep* rep)
-    : ref(1)
+    : data(0), ref(1)
 {
     length = rep->length;
 
-    data = new char[length + 1];
+    alloc(length);
 
     hash = rep->hash;
     sensitive = rep->sensitive;
 
-    if (data)
-        ::strcpy(data, rep->data);
+    ::CopyMemory(data, rep->data, length + 1);
 }
 
 TextRep::~TextRep()
 {
-    delete[] data;
+    if (data != local)
+        delete[] data;
+}
+
+void
+TextRep::alloc(int len)
+{
+    if (len < LOCAL_SIZE)
+        data = local;
+    else
+        data = new char[len + 1];
+
+#if WITH_DEV_AUTOMATION_TESTS
+    // every rep but the null rep is on the heap, and calls this once:
+    heap_blocks.fetch_add(data == local ? 1 : 2, std::memory_order_relaxed);
+#endif
 }
 
+// The shared null rep is never freed, so it does not need to be
+// counted.  Skipping it keeps every empty Text from contending on
+// the same cache line.  All other reps use lock-free counts:
+
 void
 TextRep::addref()
 {
-    sync.acquire();
-    ref++;
-    sync.release();
+    if (this != &nullrep)
+        ref.fetch_add(1, std::memory_order_relaxed);
 }
 
 long
 TextRep::deref()
 {
-    sync.acquire();
-    long r = --ref;
-    sync.release();
-    return r;
+    if (this == &nullrep)
+        return 1;
+
+    return ref.fetch_sub(1, std::memory_order_acq_rel) - 1;
 }
 
 inline static void mash(unsigned& hash, unsigned chars)
@@ -119,25 +149,41 @@ inline static void mash(unsigned& hash, unsigned chars)
 
 void
 TextRep::dohash()
+{
+    hash = Text::hashOf(data, length);
+}
+
+unsigned
+Text::hashOf(const char* s)
+{
+    return s ? hashOf(s, (int) ::strlen(s)) : hashOf("", 0);
+}
+
+unsigned
+Text::hashOf(const char* s, int length)
 {
     unsigned hv = (unsigned)length; // Mix in the string length.
     unsigned i = length * sizeof(char) / sizeof(unsigned);
-    const unsigned* p = (const unsigned*)data;
+    const char* p = s;
 
-    while (i--)
-        mash(hv, *p++);			// XOR in the characters.
+    while (i--) {
+        unsigned chars;
+        ::CopyMemory(&chars, p, sizeof(unsigned));  // s need not be aligned
+        mash(hv, chars);			// XOR in the characters.
+        p += sizeof(unsigned);
+    }
 
     // XOR in any remaining characters:
     i = length * sizeof(char) % sizeof(unsigned);
     if (i) {
         unsigned h = 0;
-        const char* c = (const char*)p;
+        const char* c = p;
         while (i--)
             h = ((h << 8 * sizeof(char)) | *c++);
         mash(hv, h);
     }
 
-    hash = hv;
+    return hv;
 }
 
 // +-------------------------------------------------------------------+
@@ -240,56 +286,28 @@ Text::operator=(const Text& s)
 Text
 Text::operator+(char c)
 {
-    char* buf = new char[rep->length + 2];
-
-    if (buf) {
-        ::strcpy(buf, sym);
-        buf[rep->length] = c;
-        buf[rep->length + 1] = '\0';
-        Text retval(buf);
-        delete[] buf;
-        return retval;
-    }
-
-    else {
-        return *this;
-    }
+    Text retval;
+    retval.rep = new TextRep(sym, rep->length, &c, 1);
+    retval.sym = retval.rep->data;
+    return retval;
 }
 
 Text
 Text::operator+(const char* s)
 {
-    char* buf = new char[::strlen(s) + rep->length + 1];
-
-    if (buf) {
-        ::strcpy(buf, sym);
-        ::strcat(buf, s);
-        Text retval(buf);
-        delete[] buf;
-        return retval;
-    }
-
-    else {
-        return *this;
-    }
+    Text retval;
+    retval.rep = new TextRep(sym, rep->length, s, s ? ::strlen(s) : 0);
+    retval.sym = retval.rep->data;
+    return retval;
 }
 
 Text
 Text::operator+(const Text& s)
 {
-    char* buf = new char[s.rep->length + rep->length + 1];
-
-    if (buf) {
-        ::strcpy(buf, sym);
-        ::strcat(buf, s.sym);
-        Text retval(buf);
-        delete[] buf;
-        return retval;
-    }
-
-    else {
-        return *this;
-    }
+    Text retval;
+    retval.rep = new TextRep(sym, rep->length, s.sym, s.rep->length);
+    retval.sym = retval.rep->data;
+    return retval;
 }
 
 bool
@@ -301,28 +319,23 @@ Text::isSensitive() const
 void
 Text::setSensitive(bool s)
 {
-    rep->sensitive = s;
+    // the rep may be shared with other strings (or be an interned
+    // symbol), so take a private copy before changing it:
+    if (rep->sensitive != s) {
+        clone();
+        rep->sensitive = s;
+    }
 }
 
 Text&
 Text::append(char c)
 {
-    char* buf = new char[rep->length + 2];
-
-    if (buf) {
-        ::strcpy(buf, sym);
-        buf[rep->length] = c;
-        buf[rep->length + 1] = '\0';
-        if (rep->deref() == 0) delete rep;
-
-        rep = new TextRep(buf);
+    TextRep* t = new TextRep(sym, rep->length, &c, 1);
 
-        if (!rep)
-            rep = &TextRep::nullrep;
+    if (rep->deref() == 0) delete rep;
 
-        sym = rep->data;
-        delete[] buf;
-    }
+    rep = t;
+    sym = rep->data;
 
     return *this;
 }
@@ -330,21 +343,12 @@ Text::append(char c)
 Text&
 Text::append(const char* s)
 {
-    char* buf = new char[::strlen(s) + rep->length + 1];
-
-    if (buf) {
-        ::strcpy(buf, sym);
-        ::strcat(buf, s);
-        if (rep->deref() == 0) delete rep;
-
-        rep = new TextRep(buf);
+    TextRep* t = new TextRep(sym, rep->length, s, s ? ::strlen(s) : 0);
 
-        if (!rep)
-            rep = &TextRep::nullrep;
+    if (rep->deref() == 0) delete rep;
 
-        sym = rep->data;
-        delete[] buf;
-    }
+    rep = t;
+    sym = rep->data;
 
     return *this;
 }
@@ -352,26 +356,13 @@ Text::append(const char* s)
 Text&
 Text::append(const Text& s)
 {
-    char* buf = new char[s.rep->length + rep->length + 1];
-
-    if (buf) {
-        int lenA = rep->length;
-        int lenB = s.rep->length;
-
-        CopyMemory(buf, sym, lenA);
-        CopyMemory(buf + lenA, s.sym, lenB);
-        buf[lenA + lenB] = 0;
-
-        if (rep->deref() == 0) delete rep;
-
-        rep = new TextRep(buf);
+    // build the new rep before releasing the old one, in case s is *this:
+    TextRep* t = new TextRep(sym, rep->length, s.sym, s.rep->length);
 
-        if (!rep)
-            rep = &TextRep::nullrep;
+    if (rep->deref() == 0) delete rep;
 
-        sym = rep->data;
-        delete[] buf;
-    }
+    rep = t;
+    sym = rep->data;
 
     return *this;
 }
@@ -379,16 +370,14 @@ Text::append(const Text& s)
 void
 Text::clone()
 {
-    if (rep->ref > 1) {
-        rep->deref();
-
+    if (rep == &TextRep::nullrep || rep->ref.load(std::memory_order_acquire) > 1) {
+        // copy before releasing our reference, so that another owner
+        // can not free the rep out from under the copy:
         TextRep* t = new TextRep(rep);
 
-        rep = t;
-
-        if (!rep)
-            rep = &TextRep::nullrep;
+        if (rep->deref() == 0) delete rep;
 
+        rep = t;
         sym = rep->data;
     }
 }
@@ -600,11 +589,8 @@ Text::substring(int start, int length)
 
         const char* s = sym + start;
 
+        result.rep->deref();
         result.rep = new TextRep(s, length);
-
-        if (!result.rep)
-            result.rep = &TextRep::nullrep;
-
         result.sym = result.rep->data;
     }
 
@@ -11,8 +11,8 @@
 
 #include "CoreMinimal.h"
 #include <string.h>
+#include <atomic>
 #include <windows.h>
-#include "ThreadSync.h"
 
 /**
  * 
@@ -26,24 +26,34 @@ public:
 	TextRep();
 	~TextRep();
 
+	// heap blocks taken by reps and their buffers so far, for the
+	// allocation tests.  always zero in builds without them:
+	static long NumHeapBlocks();
+
 private:
 	TextRep(const char* s);
 	TextRep(const char* s, int len);
+	TextRep(const char* a, int alen, const char* b, int blen);
 	TextRep(char c, int len);
 	TextRep(const TextRep* rep);
 
+	void        alloc(int len);
 	void        addref();
 	long        deref();
 
 	void        dohash();
 
+	// strings shorter than LOCAL_SIZE (names, keys, callsigns) are
+	// stored in the rep itself, so they cost a single allocation:
+	enum { LOCAL_SIZE = 24 };
+
 	char* data;
-	long        ref;
+	std::atomic<long> ref;
 	int         length;
 	unsigned    hash;
 	bool        sensitive;
+	char        local[LOCAL_SIZE];
 
-	static ThreadSync sync;
 	static TextRep    nullrep;
 };
 
@@ -99,6 +109,10 @@ public:
 	int         length() const { return rep->length; }
 	unsigned    hash() const { return rep->hash; }
 
+	// same hash value that a Text built from s would cache:
+	static unsigned hashOf(const char* s);
+	static unsigned hashOf(const char* s, int len);
+
 	const char* data() const { return sym; }
 	operator const char* () const { return sym; }
 
@@ -18,34 +18,27 @@ Dictionary<int>   Token::keymap;
 // +-------------------------------------------------------------------+
 
 Token::Token()
-    : mType(Undefined), mKey(0), mLine(0), mColumn(0)
+    : mView(false), mType(Undefined), mKey(0), mLine(0), mColumn(0), mSym(0)
 {
     mLength = 0;
     mSymbol[0] = '\0';
 }
 
 Token::Token(const Token& rhs)
-    : mType(rhs.mType), mKey(rhs.mKey), mLine(rhs.mLine), mColumn(rhs.mColumn)
+    : mLength(0), mView(false)
 {
-    mLength = rhs.mLength;
-    if (mLength < 8) {
-        strcpy_s(mSymbol, rhs.mSymbol);
-    }
-    else {
-        mFullSymbol = new(char[mLength + 1]);
-        strcpy(mFullSymbol, rhs.mFullSymbol);
-    }
+    copy(rhs);
 }
 
 Token::Token(int t)
-    : mType(t), mKey(0), mLine(0), mColumn(0)
+    : mView(false), mType(t), mKey(0), mLine(0), mColumn(0), mSym(0)
 {
     mLength = 0;
     mSymbol[0] = '\0';
 }
 
 Token::Token(const char* s, int t, int k, int l, int c)
-    : mType(t), mKey(k), mLine(l), mColumn(c)
+    : mView(false), mType(t), mKey(k), mLine(l), mColumn(c), mSym(0)
 {
     mLength = strlen(s);
     if (mLength < 8) {
@@ -58,7 +51,7 @@ Token::Token(const char* s, int t, int k, int l, int c)
 }
 
 Token::Token(const Text& s, int t, int k, int l, int c)
-    : mType(t), mKey(k), mLine(l), mColumn(c)
+    : mView(false), mType(t), mKey(k), mLine(l), mColumn(c), mSym(0)
 {
     mLength = s.length();
     if (mLength < 8) {
@@ -70,41 +63,82 @@ Token::Token(const Text& s, int t, int k, int l, int c)
     }
 }
 
-Token::~Token()
+Token
+Token::view(const char* s, int len, int t, int l, int c)
 {
-    if (mLength >= 8)
-        delete[] mFullSymbol;
-}
+    Token token(t);
+    token.mLine = l;
+    token.mColumn = c;
+    token.mLength = len;
+
+    if (len < 8) {
+        CopyMemory(token.mSymbol, s, len);
+        token.mSymbol[len] = '\0';
+    }
+    else {
+        token.mFullSymbol = (char*)s;
+        token.mView = true;
+    }
 
-// +-------------------------------------------------------------------+
+    return token;
+}
 
-void
-Token::close()
+Token::~Token()
 {
-    keymap.Clear();
+    release();
 }
 
-// +-------------------------------------------------------------------+
-
-Token&
-Token::operator = (const Token& rhs)
+void
+Token::release()
 {
-    if (mLength >= 8)
+    if (mLength >= 8 && !mView)
         delete[] mFullSymbol;
 
+    mLength = 0;
+    mView = false;
+}
+
+void
+Token::copy(const Token& rhs)
+{
     mLength = rhs.mLength;
+    mView = rhs.mView;
+
     if (mLength < 8) {
-        strcpy_s(mSymbol, rhs.mSymbol);
+        CopyMemory(mSymbol, rhs.mSymbol, sizeof(mSymbol));
+    }
+    else if (mView) {
+        mFullSymbol = rhs.mFullSymbol;
     }
     else {
         mFullSymbol = new(char[mLength + 1]);
-        strcpy(mFullSymbol, rhs.mFullSymbol);
+        CopyMemory(mFullSymbol, rhs.mFullSymbol, mLength + 1);
     }
 
     mType = rhs.mType;
     mKey = rhs.mKey;
     mLine = rhs.mLine;
     mColumn = rhs.mColumn;
+    mSym = rhs.mSym;
+}
+
+// +-------------------------------------------------------------------+
+
+void
+Token::close()
+{
+    keymap.Clear();
+}
+
+// +-------------------------------------------------------------------+
+
+Token&
+Token::operator = (const Token& rhs)
+{
+    if (&rhs != this) {
+        release();
+        copy(rhs);
+    }
 
     return *this;
 }
@@ -119,14 +153,8 @@ Token::match(const Token& ref) const
             return true;                           // match!
 
         else if (mLength == ref.mLength) {        // else if symbols match
-            if (mLength < 8) {
-                if (!strcmp(mSymbol, ref.mSymbol))
-                    return true;                     // match!
-            }
-            else {
-                if (!strcmp(mFullSymbol, ref.mFullSymbol))
-                    return true;                     // match!
-            }
+            if (!memcmp(text(), ref.text(), mLength))
+                return true;                         // match!
         }
     }
 
@@ -138,10 +166,14 @@ Token::match(const Token& ref) const
 Text
 Token::symbol() const
 {
+    // interned identifiers share the canonical symbol text:
+    if (mSym)
+        return Symbol(mSym).GetText();
+
     if (mLength < 8)
-        return Text(mSymbol);
+        return Text(mSymbol, mLength);
     else
-        return Text(mFullSymbol);
+        return Text(mFullSymbol, mLength);
 }
 
 // +-------------------------------------------------------------------+
@@ -167,12 +199,13 @@ Token::addKeys(Dictionary<int>& keys)
 bool
 Token::findKey(const Text& k, int& v)
 {
-    if (keymap.Contains(k)) {
-        v = keymap.Find(k, 0);
-        return true;
-    }
-    else
-        return false;
+    return keymap.Lookup(k, v);
+}
+
+bool
+Token::findKey(const char* k, int& v)
+{
+    return keymap.Lookup(k, v);
 }
 
 // +-------------------------------------------------------------------+
@@ -275,7 +308,7 @@ Token::describe(const Text& tok)
 // +-------------------------------------------------------------------+
 
 Scanner::Scanner(Reader* r)
-    : reader(r), str(0), index(0), old_index(0),
+    : reader(r), str(0), buffer(0), index(0), old_index(0),
     length(0), line(0), old_line(0), lineStart(0)
 { }
 
@@ -284,21 +317,24 @@ Scanner::Scanner(const Scanner& rhs)
     reader(rhs.reader),
     line(rhs.line), old_line(0), lineStart(rhs.lineStart)
 {
-    str = new(char[strlen(rhs.str) + 1]);
-    strcpy(str, rhs.str);
+    buffer = new(char[length + 1]);
+    if (rhs.str) CopyMemory(buffer, rhs.str, length);
+    buffer[length] = '\0';
+    str = buffer;
 }
 
 Scanner::Scanner(const Text& s)
     : reader(0), index(0), old_index(0), length(s.length()), line(0),
     old_line(0), lineStart(0)
 {
-    str = new(char[s.length() + 1]);
-    strcpy(str, s.data());
+    buffer = new(char[s.length() + 1]);
+    strcpy(buffer, s.data());
+    str = buffer;
 }
 
 Scanner::~Scanner()
 {
-    delete[] str;
+    delete[] buffer;
 }
 
 // +-------------------------------------------------------------------+
@@ -306,9 +342,16 @@ Scanner::~Scanner()
 Scanner&
 Scanner::operator = (const Scanner& rhs)
 {
-    delete[] str;
-    str = new(char[strlen(rhs.str) + 1]);
-    strcpy(str, rhs.str);
+    if (&rhs == this)
+        return *this;
+
+    char* copy = new(char[rhs.length + 1]);
+    if (rhs.str) CopyMemory(copy, rhs.str, rhs.length);
+    copy[rhs.length] = '\0';
+
+    delete[] buffer;
+    buffer = copy;
+    str = buffer;
 
     index = rhs.index;
     old_index = rhs.old_index;
@@ -325,14 +368,32 @@ Scanner::operator = (const Scanner& rhs)
 void
 Scanner::Load(const Text& s)
 {
-    delete[] str;
-    str = new(char[s.length() + 1]);
-    strcpy(str, s.data());
+    delete[] buffer;
+    buffer = new(char[s.length() + 1]);
+    strcpy(buffer, s.data());
+
+    str = buffer;
+    length = s.length();
+    Rewind();
+}
+
+void
+Scanner::Attach(const char* s, size_t len)
+{
+    delete[] buffer;
+    buffer = 0;
 
+    str = s;
+    length = s ? len : 0;
+    Rewind();
+}
+
+void
+Scanner::Rewind()
+{
     index = 0;
     old_index = 0;
     best = Token();
-    length = s.length();
     line = 0;
     old_line = 0;
     lineStart = 0;
@@ -340,6 +401,22 @@ Scanner::Load(const Text& s)
 
 // +-------------------------------------------------------------------+
 
+void
+Scanner::More()
+{
+    // readers that already hold their input in memory are scanned
+    // in place; the rest are copied into the scanner's own buffer:
+    const char* block = 0;
+    int         len = reader->moreBlock(block);
+
+    if (len >= 0)
+        Attach(block, len);
+    else
+        Load(reader->more());
+}
+
+// +-------------------------------------------------------------------+
+
 Token
 Scanner::Get(Need need)
 {
@@ -352,7 +429,7 @@ Scanner::Get(Need need)
 
     if (p >= eos) {
         if (need == Demand && reader) {
-            Load(reader->more());
+            More();
             if (length > 0)
                 return Get(need);
         }
@@ -369,7 +446,7 @@ Scanner::Get(Need need)
 
     if (p >= eos) {
         if (need == Demand && reader) {
-            Load(reader->more());
+            More();
             if (length > 0)
                 return Get(need);
         }
@@ -453,12 +530,7 @@ Scanner::Get(Need need)
     int col = start - lineStart;
     if (line == 0) col++;
 
-    char* buf = new(char[extent + 1]);
-    strncpy(buf, str + start, extent);
-    buf[extent] = '\0';
-
     if (type == Token::Comment && Token::hidecom) {
-        delete[] buf;
         if (Token::comEnd(0) == '\n') {
             line++;
             lineStart = p - str;
@@ -466,21 +538,34 @@ Scanner::Get(Need need)
         return Get(need);
     }
 
+    // the token refers to the input block instead of copying it:
+    result = Token::view(str + start, (int)extent, type, line + 1, col);
+
     if (type == Token::AlphaIdent || // check for keyword
         type == Token::SymbolicIdent) {
+        char  local[64];
+        char* key = extent < sizeof(local) ? local : new(char[extent + 1]);
+
+        CopyMemory(key, str + start, extent);
+        key[extent] = '\0';
+
         int val;
-        if (Token::findKey(Text(buf), val))
-            result = Token(buf, Token::Keyword, val, line + 1, col);
-    }
+        if (Token::findKey(key, val)) {
+            result.mType = Token::Keyword;
+            result.mKey = val;
+        }
+        else if (type == Token::AlphaIdent) {
+            result.mSym = Symbol::Intern(key, (int)extent);
+        }
 
-    if (result.mType != Token::Keyword)
-        result = Token(buf, type, 0, line + 1, col);
+        if (key != local)
+            delete[] key;
+    }
 
     if (line + 1 > (size_t)best.mLine ||
         (line + 1 == (size_t)best.mLine && col > best.mColumn))
         best = result;
 
-    delete[] buf;
     return result;
 }
 
@@ -531,7 +616,7 @@ bool
 Scanner::IsSymbolic(char c)
 {
     const char* s = "+-*/\\<=>~!@#$%^&|:";
-    return strchr(s, c) ? true : false;
+    return (c && strchr(s, c)) ? true : false;
 }
 
 
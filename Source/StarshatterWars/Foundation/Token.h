@@ -10,6 +10,7 @@
 
 #include "Text.h"
 #include "Dictionary.h"
+#include "Symbol.h"
 
 #pragma warning( disable : 4237)
 
@@ -60,6 +61,7 @@ public:
     int      key()      const { return mKey; }
     int      line()     const { return mLine; }
     int      column()   const { return mColumn; }
+    Symbol   sym()      const { return Symbol(mSym); }
 
     Text     typestr()  const;
 
@@ -67,6 +69,7 @@ public:
     static void   addKey(const Text& k, int v);
     static void   addKeys(Dictionary<int>& keys);
     static bool   findKey(const Text& k, int& v);
+    static bool   findKey(const char* k, int& v);
     static void   comments(const Text& begin, const Text& end);
     static void   altComments(const Text& begin, const Text& end);
     static void   hideComments(bool hide = true) { hidecom = hide; }
@@ -79,15 +82,27 @@ public:
     static void   close();
 
 protected:
+    // tokens produced by the Scanner do not copy symbols of eight or
+    // more characters; they refer to the scanner's input block and
+    // are only valid until the scanner moves on to another block.
+    // symbol() materializes a Text when the value needs to be kept:
+    static Token view(const char* s, int len, int t, int l, int c);
+
+    void     copy(const Token& rhs);
+    void     release();
+    const char* text() const { return mLength < 8 ? mSymbol : mFullSymbol; }
+
     int      mLength;
     union {
         char  mSymbol[8];
         char* mFullSymbol;
     };
+    bool     mView;
     int      mType;
     int      mKey;
     int      mLine;
     int      mColumn;
+    int      mSym;
 
     static bool             hidecom;
     static char             combeg[3];
@@ -111,6 +126,10 @@ public:
 
     void           Load(const Text& s);
 
+    // scan a null terminated block in place, without copying it.
+    // the block must outlive the scan and any tokens taken from it:
+    void           Attach(const char* s, size_t len);
+
     enum Need { Demand, Request };
     virtual Token  Get(Need n = Demand);
 
@@ -125,8 +144,12 @@ protected:
     virtual bool   IsSymbolic(char c);
     virtual bool   IsAlpha(char c);
 
+    void           More();
+    void           Rewind();
+
     Reader* reader;
-    char* str;
+    const char* str;
+    char* buffer;   // owned copy of the input, when not attached
 
     const char* p;
     const char* eos;
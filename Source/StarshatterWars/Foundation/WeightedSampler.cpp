@@ -0,0 +1,111 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         WeightedSampler.cpp
+	AUTHOR:       Carlos Bott
+*/
+
+
+#include "WeightedSampler.h"
+#include <string.h>
+
+// +--------------------------------------------------------------------+
+
+WeightedSampler::WeightedSampler()
+	: tree(0), weight(0), size(0), extent(0), total(0)
+{ }
+
+WeightedSampler::~WeightedSampler()
+{
+	delete [] tree;
+	delete [] weight;
+}
+
+// +--------------------------------------------------------------------+
+
+void
+WeightedSampler::Reset(int n)
+{
+	if (n < 0) n = 0;
+
+	// keep the arrays from pass to pass, they only ever grow:
+	if (n > extent) {
+		delete [] tree;
+		delete [] weight;
+
+		extent = n;
+		tree   = new int[extent + 1];
+		weight = new int[extent];
+	}
+
+	size  = n;
+	total = 0;
+
+	if (extent > 0) {
+		memset(tree,   0, (size + 1) * sizeof(int));
+		memset(weight, 0, extent * sizeof(int));
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+void
+WeightedSampler::SetWeight(int slot, int w)
+{
+	if (slot < 0 || slot >= size)
+		return;
+
+	if (w < 0) w = 0;
+
+	int delta = w - weight[slot];
+	if (!delta)
+		return;
+
+	weight[slot] = w;
+	total += delta;
+
+	for (int i = slot + 1; i <= size; i += i & -i)
+		tree[i] += delta;
+}
+
+int
+WeightedSampler::GetWeight(int slot) const
+{
+	if (slot < 0 || slot >= size)
+		return 0;
+
+	return weight[slot];
+}
+
+// +--------------------------------------------------------------------+
+
+int
+WeightedSampler::Find(int point) const
+{
+	if (total <= 0)
+		return -1;
+
+	if (point < 0)      point = 0;
+	if (point >= total) point = total - 1;
+
+	// descend the tree for the last prefix sum not above point:
+	int pos  = 0;
+	int step = 1;
+
+	while (step * 2 <= size)
+		step *= 2;
+
+	for (; step > 0; step /= 2) {
+		int next = pos + step;
+
+		if (next <= size && tree[next] <= point) {
+			pos    = next;
+			point -= tree[next];
+		}
+	}
+
+	// pos slots lie wholly below the point, so it falls in the next:
+	return pos;
+}
@@ -0,0 +1,58 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Foundation
+	FILE:         WeightedSampler.h
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Weighted choice among a fixed number of slots.  Weights are kept in
+	a binary indexed (Fenwick) tree, so changing one weight and mapping
+	a point in [0, Total()) back to its slot both take O(log n) time.
+	A slot with zero weight is never chosen, which lets a caller strike
+	out entries that have gone stale without rebuilding the table.
+
+	The sampler only does the mapping.  The random point comes from the
+	caller, so the choice follows whichever random stream is current.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// +--------------------------------------------------------------------+
+
+class STARSHATTERWARS_API WeightedSampler
+{
+public:
+	static const char* TYPENAME() { return "WeightedSampler"; }
+
+	WeightedSampler();
+	~WeightedSampler();
+
+	// n slots, all with zero weight:
+	void        Reset(int n);
+	void        Clear() { Reset(0); }
+
+	void        SetWeight(int slot, int weight);
+	int         GetWeight(int slot) const;
+
+	int         Size()  const { return size; }
+	int         Total() const { return total; }
+
+	// the slot whose share of the total covers point, for a point in
+	// [0, Total()).  -1 when every weight is zero:
+	int         Find(int point) const;
+
+private:
+	WeightedSampler(const WeightedSampler&);
+	WeightedSampler& operator=(const WeightedSampler&);
+
+	int*        tree;        // 1-based Fenwick sums
+	int*        weight;
+	int         size;
+	int         extent;
+	int         total;
+};
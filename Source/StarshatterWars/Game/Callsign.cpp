@@ -13,6 +13,7 @@
 
 
 #include "Callsign.h"
+#include "../Foundation/Random.h"
 
 
 // +----------------------------------------------------------------------+
@@ -86,7 +87,7 @@ const char*
 Callsign::GetCallsign(int IFF)
 {
 	if (callsign_index < 0)
-		callsign_index = rand() / 1000;
+		callsign_index = RandomInt() / 1000;
 
 	if (callsign_index > 31)
 		callsign_index = 0;
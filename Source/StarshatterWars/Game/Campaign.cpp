@@ -47,6 +47,9 @@
 static List<UCampaign>   campaigns;
 static UCampaign* current_campaign = 0;
 
+static bool   virtual_clock = false;
+static double virtual_stardate = 0;
+
 UCampaign::UCampaign()
 {
 	
@@ -349,12 +352,34 @@ void UCampaign::Prep()
 
 void UCampaign::Start()
 {
+	Print("Campaign::Start()\n");
+
+	Prep();
+
+	// create planners:
+	CreatePlanners();
 
+	// link the scripted actions to the ones they wait on:
+	action_graph.Build(actions);
+
+	SetStatus(CAMPAIGN_ACTIVE);
 }
 
 void UCampaign::ExecFrame()
 {
+	time = Stardate() - startTime;
+
+	if (status < CAMPAIGN_ACTIVE)
+		return;
+
+	RandomScope random(RandomStream::CAMPAIGN);
 
+	for (int i = 0; i < planners.Num(); i++) {
+		if (planners[i])
+			planners[i]->ExecFrame();
+	}
+
+	CheckPlayerGroup();
 }
 
 void UCampaign::Unload()
@@ -378,6 +403,11 @@ void UCampaign::Unload()
 
 void UCampaign::Clear()
 {
+	action_graph.Clear();
+	zone_regions.Clear();
+	zone_regions_built = 0;
+	zone_regions_gen   = -1;
+
 	//missions.destroy();
 	//planners.destroy();
 	//combatants.destroy();
@@ -407,7 +437,28 @@ void UCampaign::CheckPlayerGroup()
 
 void UCampaign::CreatePlanners()
 {
+	planners.Empty();
+
+	// PLAN EVENT MUST BE FIRST PLANNER:
+	UCampaignPlan* p = NewObject<UCampaignPlanEvent>(this);
+	p->SetCampaign(this);
+	planners.Add(p);
+
+	p = NewObject<UCampaignPlanStrategic>(this);
+	p->SetCampaign(this);
+	planners.Add(p);
 
+	p = NewObject<UCampaignPlanAssignment>(this);
+	p->SetCampaign(this);
+	planners.Add(p);
+
+	p = NewObject<UCampaignPlanMovement>(this);
+	p->SetCampaign(this);
+	planners.Add(p);
+
+	p = NewObject<UCampaignPlanMission>(this);
+	p->SetCampaign(this);
+	planners.Add(p);
 }
 
 int UCampaign::GetPlayerTeamScore()
@@ -417,6 +468,7 @@ int UCampaign::GetPlayerTeamScore()
 
 void UCampaign::SetStatus(int s)
 {
+	status = s;
 }
 
 void UCampaign::Close()
@@ -431,6 +483,11 @@ UCampaign* UCampaign::GetCampaign()
 	return current_campaign;
 }
 
+void UCampaign::SetCurrentCampaign(UCampaign* c)
+{
+	current_campaign = c;
+}
+
 List<UCampaign>& UCampaign::GetAllCampaigns()
 {
 	return campaigns;
@@ -479,9 +536,33 @@ UCampaign* UCampaign::CreateCustomCampaign(const char* name, const char* path)
 
 double UCampaign::Stardate()
 {
+	if (virtual_clock)
+		return virtual_stardate;
+
 	return AStarSystem::GetStardate();
 }
 
+void UCampaign::SetVirtualClock(double stardate)
+{
+	virtual_clock = true;
+	virtual_stardate = stardate;
+}
+
+void UCampaign::AdvanceVirtualClock(double seconds)
+{
+	virtual_stardate += seconds;
+}
+
+void UCampaign::ClearVirtualClock()
+{
+	virtual_clock = false;
+}
+
+bool UCampaign::IsVirtualClock()
+{
+	return virtual_clock;
+}
+
 void UCampaign::LoadCampaign(FString n, bool full /*= false*/)
 {		
 	DataLoader* loader = DataLoader::GetLoader();
@@ -509,7 +590,16 @@ void UCampaign::LoadCampaign(FString n, bool full /*= false*/)
 
 CombatGroup* UCampaign::FindGroup(int iff, int type, int id)
 {
-	return nullptr;
+	CombatGroup* result = 0;
+
+	// each force keeps its own index, the iff picks the force:
+	ListIter<Combatant> combatant = combatants;
+	while (++combatant && !result) {
+		if (combatant->GetIFF() == iff)
+			result = combatant->FindGroup(type, id);
+	}
+
+	return result;
 }
 
 CombatGroup* UCampaign::FindGroup(int iff, int type, CombatGroup* near_group)
@@ -529,7 +619,29 @@ AStarSystem* UCampaign::GetSystem(const char* sys)
 
 CombatZone* UCampaign::GetZone(const char* rgn)
 {
-	return nullptr;
+	if (!rgn || !*rgn)
+		return 0;
+
+	// the zones tell the index when a region is added or a zone
+	// goes away; the count catches zones added to the list:
+	if (zone_regions_built != zones.size() || zone_regions_gen != CombatZone::Generation()) {
+		zone_regions.Clear();
+
+		ListIter<CombatZone> z = zones;
+		while (++z) {
+			ListIter<Text> r = z->GetRegions();
+			while (++r) {
+				// the first zone to list a region owns it:
+				if (!zone_regions.Contains(*r.value()))
+					zone_regions.Insert(*r.value(), z.value());
+			}
+		}
+
+		zone_regions_built = zones.size();
+		zone_regions_gen   = CombatZone::Generation();
+	}
+
+	return zone_regions.Find(rgn, (CombatZone*) 0);
 }
 
 bool UCampaign::IsDynamic() const
@@ -542,3 +654,15 @@ int UCampaign::GetPlayerIFF()
 {
 	return 0;
 }
+
+void UCampaign::SetPlayerGroup(CombatGroup* pg)
+{
+	if (player_group != pg) {
+		player_group = pg;
+		player_unit = 0;
+
+		// missions were planned for the old player group:
+		if (IsDynamic())
+			missions.destroy();
+	}
+}
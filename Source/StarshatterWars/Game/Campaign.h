@@ -19,7 +19,9 @@
 #include "../Foundation/Color.h"
 #include "../Foundation/Term.h"
 #include "../Foundation/List.h"
+#include "../Foundation/Dictionary.h"
 #include "../Foundation/DataLoader.h"
+#include "CombatActionGraph.h"
 #include "UObject/NoExportTypes.h"
 #include "Tickable.h"
 #include "../System/SSWGameInstance.h"
@@ -31,7 +33,7 @@
 // +--------------------------------------------------------------------+
 
 class UCampaign;
-class CampaignPlan;
+class UCampaignPlan;
 class Combatant;
 class CombatAction;
 class CombatEvent;
@@ -124,6 +126,7 @@ public:
 	List<CombatZone>& GetZones() { return zones; }
 	List<AStarSystem>& GetSystemList() { return systems; }
 	List<CombatAction>& GetActions() { return actions; }
+	CombatActionGraph& GetActionGraph() { return action_graph; }
 	List<CombatEvent>& GetEvents() { return events; }
 	CombatEvent* GetLastEvent();
 
@@ -188,12 +191,20 @@ public:
 	static void          Initialize();
 	static void          Close();
 	static UCampaign* GetCampaign();
+	static void          SetCurrentCampaign(UCampaign* c);
 	static List<UCampaign>&GetAllCampaigns();
 	static int           GetLastCampaignId();
 	static UCampaign* SelectCampaign(const char* name);
 	static UCampaign* CreateCustomCampaign(const char* name, const char* path);
 
 	static double        Stardate();
+
+	// headless runs step the planners on a virtual clock instead
+	// of the star system's real time stardate:
+	static void          SetVirtualClock(double stardate);
+	static void          AdvanceVirtualClock(double seconds);
+	static void          ClearVirtualClock();
+	static bool          IsVirtualClock();
 	AGameDataLoader* gl;
 
 protected:
@@ -225,10 +236,19 @@ protected:
 	List<Combatant>      combatants;
 	List<AStarSystem>    systems;
 	List<CombatZone>     zones;
-	List<CampaignPlan>   planners;
+	Dictionary<CombatZone*> zone_regions;   // region name to zone
+	int                  zone_regions_built;     // zone count when built
+	int                  zone_regions_gen;       // CombatZone::Generation() when built
+
+	// planners are UObjects made with NewObject, so they are held
+	// in a property where the garbage collector can see them:
+	UPROPERTY()
+	TArray<UCampaignPlan*> planners;
+
 	List<MissionInfo>    missions;
 	List<TemplateList>   templates;
 	List<CombatAction>   actions;
+	CombatActionGraph    action_graph;
 	List<CombatEvent>    events;
 	CombatGroup* player_group;
 	CombatUnit* player_unit;
@@ -125,6 +125,8 @@ CampaignMissionFighter::CreateMission(CampaignMissionRequest* req)
 	if (!campaign || !squadron || !req)
 		return;
 
+	RandomScope random(RandomStream::MISSION);
+
 	::Print("\n-----------------------------------------------\n");
 	if (req->Script().length())
 		::Print("CMF CreateMission() request: %s '%s'\n",
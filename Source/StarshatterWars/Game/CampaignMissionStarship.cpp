@@ -78,6 +78,8 @@ CampaignMissionStarship::CreateMission(CampaignMissionRequest* req)
 	if (!campaign || !req)
 		return;
 
+	RandomScope random(RandomStream::MISSION);
+
 	::Print("\n-----------------------------------------------\n");
 	if (req->Script().length())
 		::Print("CMS CreateMission() request: %s '%s'\n",
@@ -48,6 +48,9 @@ public:
 	virtual void      ExecFrame() { }
 	virtual void      SetLockout(int seconds) { }
 
+	// planners made with NewObject are attached to their campaign here:
+	virtual void      SetCampaign(UCampaign* c) { campaign = c; exec_time = -1e6; }
+
 	void Tick(float DeltaTime) override;
 	bool IsTickable() const override;
 	bool IsTickableInEditor() const override;
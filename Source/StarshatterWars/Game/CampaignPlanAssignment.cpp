@@ -23,12 +23,15 @@
 #include "CombatZone.h"
 #include "ZoneForce.h"
 #include "Mission.h"
+#include "../Foundation/Random.h"
 
 UCampaignPlanAssignment::UCampaignPlanAssignment()
+	: task_seed(0)
 {
 }
 
 UCampaignPlanAssignment::UCampaignPlanAssignment(UCampaign* c)
+	: task_seed(0)
 {
 	campaign = c;
 }
@@ -41,19 +44,66 @@ UCampaignPlanAssignment::ExecFrame()
 		if (UCampaign::Stardate() - exec_time < 300)
 			return;
 
-		ListIter<Combatant>  iter = campaign->GetCombatants();
-		while (++iter) {
-			ProcessCombatant(iter.value());
-		}
+		PrepareCombatants();
+
+		// the tasks draw from streams of their own, seeded
+		// from this one draw on the campaign stream:
+		task_seed = RandomStream::Current().Next();
+
+		// each combatant only rebuilds the assignments of its own
+		// force, so the results don't depend on the order the
+		// tasks run in:
+		pool.Run(campaign->GetCombatants().size(), ProcessCombatantTask, this);
+
+		exec_time = UCampaign::Stardate();
 	}
 }
 
 // +--------------------------------------------------------------------+
 
+void
+UCampaignPlanAssignment::PrepareCombatants()
+{
+	// everything the combatant tasks share must be settled before
+	// they start.  targets are read from the enemy forces, so every
+	// cached group value is brought up to date here, and the zone
+	// forces the tasks look up are created now rather than by the
+	// first task to ask for them:
+	ListIter<Combatant> iter = campaign->GetCombatants();
+	while (++iter) {
+		Combatant* c = iter.value();
+
+		if (c->GetForce())
+			c->GetForce()->CalcValue();
+
+		ListIter<CombatZone> zone = campaign->GetZones();
+		while (++zone)
+			zone->FindForce(c->GetIFF());
+	}
+}
+
+void
+UCampaignPlanAssignment::ProcessCombatantTask(void* param, int index)
+{
+	UCampaignPlanAssignment* plan = (UCampaignPlanAssignment*)param;
+
+	RandomStream stream(RandomStream::TaskSeed(plan->task_seed, index));
+	RandomScope  random(stream);
+
+	plan->ProcessCombatant(plan->campaign->GetCombatants().at(index));
+}
+
+// +--------------------------------------------------------------------+
+
 void
 UCampaignPlanAssignment::ProcessCombatant(Combatant* c)
 {
 	CombatGroup* force = c->GetForce();
+
+	// the candidates point into the assignments about to be deleted:
+	c->GetEventCandidates().clear();
+	c->GetEventWeights().Clear();
+
 	if (force) {
 		force->CalcValue();
 		force->ClearAssignments();
@@ -63,22 +113,45 @@ UCampaignPlanAssignment::ProcessCombatant(Combatant* c)
 	while (++zone) {
 		ProcessZone(c, zone.value());
 	}
+
+	BuildEventCandidates(c);
 }
 
 // +--------------------------------------------------------------------+
 
 void
-UCampaignPlanAssignment::BuildZoneList(CombatGroup* g, CombatZone* zone, List<CombatGroup>& groups)
+UCampaignPlanAssignment::BuildEventCandidates(Combatant* c)
+{
+	List<CombatAssignment>& candidates = c->GetEventCandidates();
+	WeightedSampler&        weights    = c->GetEventWeights();
+
+	FindEventCandidates(c->GetForce(), candidates);
+	weights.Reset(candidates.size());
+
+	// the values were brought up to date before the pass began:
+	for (int i = 0; i < candidates.size(); i++) {
+		CombatAssignment* a = candidates[i];
+		weights.SetWeight(i, a->GetResource()->Value() + a->GetObjective()->Value());
+	}
+}
+
+void
+UCampaignPlanAssignment::FindEventCandidates(CombatGroup* g, List<CombatAssignment>& list)
 {
 	if (!g)
 		return;
 
-	if (g->GetAssignedZone() == zone)
-		groups.append(g);
+	CombatGroup* player_group = campaign->GetPlayerGroup();
+
+	ListIter<CombatAssignment> a = g->GetAssignments();
+	while (++a) {
+		if (a->IsEventCandidate(player_group))
+			list.append(a.value());
+	}
 
 	ListIter<CombatGroup> iter = g->GetComponents();
 	while (++iter)
-		BuildZoneList(iter.value(), zone, groups);
+		FindEventCandidates(iter.value(), list);
 }
 
 // +--------------------------------------------------------------------+
@@ -107,11 +180,12 @@ UCampaignPlanAssignment::BuildAssetList(const int* pref,
 void
 UCampaignPlanAssignment::ProcessZone(Combatant* c, CombatZone* zone)
 {
-	List<CombatGroup> groups;
-	BuildZoneList(c->GetForce(), zone, groups);
-
 	ZoneForce* force = zone->FindForce(c->GetIFF());
 
+	// the zone keeps the groups assigned to it, so there is
+	// no need to search the whole force for them:
+	List<CombatGroup>& groups = force->GetAssignedGroups();
+
 	// defensive assignments:
 	ListIter<CombatGroup> def = force->GetDefendList();
 	while (++def) {
@@ -120,7 +194,7 @@ UCampaignPlanAssignment::ProcessZone(Combatant* c, CombatZone* zone)
 
 		ListIter<CombatGroup> g = assets;
 		while (++g) {
-			CombatAssignment* a = new CombatAssignment(Mission::TYPE::DEFEND,
+			CombatAssignment* a = new(&c->GetAssignmentPool()) CombatAssignment(Mission::TYPE::DEFEND,
 					def.value(),
 					g.value());
 
@@ -151,7 +225,7 @@ UCampaignPlanAssignment::ProcessZone(Combatant* c, CombatZone* zone)
 			else if (target->Type() == (int) CombatGroup::LCA_SQUADRON)
 				mtype = (int)Mission::INTERCEPT;
 
-			CombatAssignment* a = new CombatAssignment(mtype, target, asset);
+			CombatAssignment* a = new(&c->GetAssignmentPool()) CombatAssignment(mtype, target, asset);
 
 			if (a)
 				g->GetAssignments().append(a);
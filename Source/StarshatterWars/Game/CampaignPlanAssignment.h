@@ -19,11 +19,13 @@
 #include "CampaignPlan.h"
 #include "../Foundation/Types.h"
 #include "../Foundation/List.h"
+#include "../Foundation/TaskPool.h"
 #include "CampaignPlanAssignment.generated.h"
 
 // +--------------------------------------------------------------------+
 
 class Combatant;
+class CombatAssignment;
 class CombatGroup;
 class CombatUnit;
 class CombatZone;
@@ -49,10 +51,22 @@ public:
 	// operations:
 	virtual void   ExecFrame();
 
+	// combatants are planned concurrently, one task each, on this
+	// many threads (zero for one per core, one to plan serially):
+	int            GetThreads() const { return pool.GetThreads(); }
+	void           SetThreads(int n) { pool.SetThreads(n); }
+
 protected:
+	virtual void   PrepareCombatants();
 	virtual void   ProcessCombatant(Combatant* c);
 	virtual void   ProcessZone(Combatant* c, CombatZone* zone);
-	virtual void   BuildZoneList(CombatGroup* g, CombatZone* zone, List<CombatGroup>& list);
 	virtual void   BuildAssetList(const int* pref, List<CombatGroup>& avail, List<CombatGroup>& assets);
+	virtual void   BuildEventCandidates(Combatant* c);
+	virtual void   FindEventCandidates(CombatGroup* g, List<CombatAssignment>& list);
+
+	static void    ProcessCombatantTask(void* param, int index);
+
+	TaskPool       pool;          // kept between passes, workers sleep in between
+	uint64         task_seed;     // drawn from the campaign stream each pass
 	
 };
@@ -76,6 +76,17 @@ UCampaignPlanEvent::SetLockout(int seconds)
 	exec_time = UCampaign::Stardate() + seconds;
 }
 
+void
+UCampaignPlanEvent::SetCampaign(UCampaign* c)
+{
+	UCampaignPlan::SetCampaign(c);
+	event_time = 0;
+
+	if (campaign) {
+		event_time = (int)campaign->GetTime();
+	}
+}
+
 // +--------------------------------------------------------------------+
 
 bool
@@ -84,10 +95,11 @@ UCampaignPlanEvent::ExecScriptedEvents()
 	bool scripted_event = false;
 
 	if (campaign) {
-		ListIter<CombatAction> iter = campaign->GetActions();
-		while (++iter) {
-			CombatAction* action = iter.value();
+		// only the actions that can be available, in campaign order:
+		CombatActionGraph& graph  = campaign->GetActionGraph();
+		CombatAction*      action = 0;
 
+		while ((action = graph.NextReady(action)) != 0) {
 			if (action->IsAvailable()) {
 
 				switch (action->Type()) {
@@ -454,7 +466,7 @@ UCampaignPlanEvent::ExecStatisticalEvents()
 		ListIter<Combatant> iter = campaign->GetCombatants();
 		while (++iter && !result) {
 			Combatant* c = iter.value();
-			CombatAssignment* a = ChooseAssignment(c->GetForce());
+			CombatAssignment* a = ChooseAssignment(c);
 
 			// prefer assignments not in player's zone:
 			if (a) {
@@ -463,7 +475,7 @@ UCampaignPlanEvent::ExecStatisticalEvents()
 
 				if (objective && player &&
 					objective->GetCurrentZone() == player->GetCurrentZone())
-					a = ChooseAssignment(c->GetForce());
+					a = ChooseAssignment(c);
 			}
 
 			if (a) {
@@ -544,53 +556,32 @@ UCampaignPlanEvent::CreateEvent(CombatAssignment* a)
 
 // +--------------------------------------------------------------------+
 
-static void FindAssignments(CombatGroup* g, List<CombatAssignment>& alist)
-{
-	if (!g) return;
-
-	alist.append(g->GetAssignments());
-
-	ListIter<CombatGroup> iter = g->GetComponents();
-	while (++iter)
-		FindAssignments(iter.value(), alist);
-}
-
 CombatAssignment*
-UCampaignPlanEvent::ChooseAssignment(CombatGroup* g)
+UCampaignPlanEvent::ChooseAssignment(Combatant* c)
 {
-	List<CombatAssignment> alist;
-	FindAssignments(g, alist);
-
-	int tries = 5;
-
-	if (alist.size() > 0) {
-		while (tries-- > 0) {
-			int index = (int)RandomDouble(0, alist.size());
-
-			if (index >= alist.size())
-				index = 0;
-
-			CombatAssignment* a = alist[index];
-
-			if (!a) continue;
-
-			CombatGroup* resource = a->GetResource();
-			CombatGroup* objective = a->GetObjective();
-
-			if (!resource || !objective)
-				continue;
+	if (!c)
+		return 0;
 
-			if (resource->IsReserve() || objective->IsReserve())
-				continue;
+	// the assignment planner leaves the eligible assignments of each
+	// combatant in a weighted table, so one draw picks an assignment
+	// with odds in proportion to the value at stake:
+	List<CombatAssignment>& candidates = c->GetEventCandidates();
+	WeightedSampler&        weights    = c->GetEventWeights();
 
-			if (resource->CalcValue() < 50 || objective->CalcValue() < 50)
-				continue;
+	while (weights.Total() > 0) {
+		// the full width of the stream, since the total can run far
+		// past the 15 bits RandomDouble resolves:
+		uint64 point = RandomStream::Current().Next() % (uint64)weights.Total();
+		int    index = weights.Find((int)point);
 
-			if (resource == campaign->GetPlayerGroup() || objective == campaign->GetPlayerGroup())
-				continue;
+		CombatAssignment* a = candidates[index];
 
+		if (a->IsEventCandidate(campaign->GetPlayerGroup()))
 			return a;
-		}
+
+		// lost, out of reserve or taken over by the player since
+		// the last pass; strike it so it is not drawn again:
+		weights.SetWeight(index, 0);
 	}
 
 	return 0;
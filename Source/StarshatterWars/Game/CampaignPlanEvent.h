@@ -25,6 +25,7 @@
 // +--------------------------------------------------------------------+
 
 class CombatAction;
+class Combatant;
 class CombatAssignment;
 class CombatEvent;
 class CombatGroup;
@@ -51,6 +52,7 @@ class STARSHATTERWARS_API UCampaignPlanEvent : public UCampaignPlan
 	// operations:
 	virtual void   ExecFrame();
 	virtual void   SetLockout(int seconds);
+	virtual void   SetCampaign(UCampaign* c);
 
 	virtual bool   ExecScriptedEvents();
 	virtual bool   ExecStatisticalEvents();
@@ -58,7 +60,7 @@ class STARSHATTERWARS_API UCampaignPlanEvent : public UCampaignPlan
 protected:
 	virtual void   ProsecuteKills(CombatAction* action);
 
-	virtual CombatAssignment* ChooseAssignment(CombatGroup* c);
+	virtual CombatAssignment* ChooseAssignment(Combatant* c);
 	virtual bool   CreateEvent(CombatAssignment* a);
 
 	virtual CombatEvent* CreateEventDefend(CombatAssignment* a);
@@ -151,10 +151,10 @@ UCampaignPlanMission::PlanCampaignMission()
 {
 	CampaignMissionRequest* request = 0;
 
-	ListIter<CombatAction> iter = campaign->GetActions();
-	while (++iter && !request) {
-		CombatAction* action = iter.value();
+	CombatActionGraph& graph  = campaign->GetActionGraph();
+	CombatAction*      action = 0;
 
+	while (!request && (action = graph.NextReady(action)) != 0) {
 		if (action->Type() != CombatAction::MISSION_TEMPLATE)
 			continue;
 
@@ -0,0 +1,202 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Game
+	FILE:         CampaignRunner.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	CampaignRunner drives a dynamic campaign without the game
+	loop, for soak testing campaign balance.
+*/
+
+
+#include "CampaignRunner.h"
+#include "Campaign.h"
+#include "Combatant.h"
+#include "CombatGroup.h"
+#include "../Foundation/Random.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+// +--------------------------------------------------------------------+
+
+CampaignRunner::CampaignRunner(UCampaign* c, DWORD s)
+	: campaign(c), seed(s), sim_seconds(0), wall_seconds(0)
+{ }
+
+CampaignRunner::~CampaignRunner()
+{
+	days.destroy();
+}
+
+// +--------------------------------------------------------------------+
+
+void
+CampaignRunner::Run(int ndays, double step)
+{
+	days.destroy();
+	sim_seconds  = 0;
+	wall_seconds = 0;
+
+	if (!campaign || ndays < 1 || step <= 0)
+		return;
+
+	RandomStream::SeedAll(seed);
+
+	// actions check their times and requirements against the
+	// current campaign, so this one has to be it for the run:
+	UCampaign* previous = UCampaign::GetCampaign();
+	UCampaign::SetCurrentCampaign(campaign);
+
+	if (!campaign->IsActive())
+		campaign->Start();
+
+	// pick the campaign clock up where the campaign left off:
+	UCampaign::SetVirtualClock(campaign->GetStartTime() + campaign->GetTime());
+
+	int    steps_per_day = (int)(SECONDS_PER_DAY / step);
+	int    last_events   = campaign->GetEvents().size();
+	int    last_missions = campaign->GetMissionList().size();
+	int    last_released = campaign->GetActionGraph().NumReleased();
+	double wall_start    = FPlatformTime::Seconds();
+
+	if (steps_per_day < 1)
+		steps_per_day = 1;
+
+	days.reserve(ndays);
+
+	for (int d = 0; d < ndays && campaign->IsActive(); d++) {
+		CampaignDayStats* stats = new CampaignDayStats;
+		stats->day         = d + 1;
+		stats->events      = 0;
+		stats->assignments = 0;
+		stats->missions    = 0;
+		stats->released    = 0;
+
+		for (int n = 0; n < steps_per_day && campaign->IsActive(); n++) {
+			UCampaign::AdvanceVirtualClock(step);
+			sim_seconds += step;
+
+			campaign->ExecFrame();
+
+			// missions are dropped as they expire, so only count growth:
+			int nmissions = campaign->GetMissionList().size();
+			if (nmissions > last_missions)
+				stats->missions += nmissions - last_missions;
+			last_missions = nmissions;
+		}
+
+		// the ready queue belongs to the planners; only read the count:
+		int nreleased   = campaign->GetActionGraph().NumReleased();
+		stats->released = nreleased - last_released;
+		last_released   = nreleased;
+
+		int nevents = campaign->GetEvents().size();
+		stats->events = nevents - last_events;
+		last_events   = nevents;
+
+		ListIter<Combatant> iter = campaign->GetCombatants();
+		while (++iter)
+			stats->assignments += CountAssignments(iter->GetForce());
+
+		days.append(stats);
+	}
+
+	wall_seconds = FPlatformTime::Seconds() - wall_start;
+
+	UCampaign::ClearVirtualClock();
+	UCampaign::SetCurrentCampaign(previous);
+}
+
+// +--------------------------------------------------------------------+
+
+int
+CampaignRunner::CountAssignments(CombatGroup* g) const
+{
+	if (!g)
+		return 0;
+
+	int count = g->GetAssignments().size();
+
+	ListIter<CombatGroup> iter = g->GetComponents();
+	while (++iter)
+		count += CountAssignments(iter.value());
+
+	return count;
+}
+
+double
+CampaignRunner::SimHoursPerSecond() const
+{
+	if (wall_seconds <= 0)
+		return 0;
+
+	return sim_seconds / 3600.0 / wall_seconds;
+}
+
+// +--------------------------------------------------------------------+
+
+void
+CampaignRunner::Report() const
+{
+	UE_LOG(LogTemp, Log, TEXT("Campaign %d seed %u: %d days"),
+		campaign ? campaign->GetCampaignId() : 0, (unsigned)seed, days.size());
+
+	for (int i = 0; i < days.size(); i++) {
+		const CampaignDayStats* stats = days[i];
+
+		UE_LOG(LogTemp, Log, TEXT("  day %3d: %4d events %5d assignments %4d missions %4d released"),
+			stats->day, stats->events, stats->assignments, stats->missions, stats->released);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("  %.1f sim hours in %.3f s (%.1f sim hours per second)"),
+		sim_seconds / 3600.0, wall_seconds, SimHoursPerSecond());
+
+	if (!campaign)
+		return;
+
+	// assignment churn against the heap blocks it actually cost:
+	ListIter<Combatant> iter = campaign->GetCombatants();
+	while (++iter) {
+		ObjectPool& pool = iter->GetAssignmentPool();
+
+		UE_LOG(LogTemp, Log, TEXT("  %s: %d assignments allocated from %d pool blocks, %d live"),
+			*FString(iter->Name()), pool.NumAllocs(), pool.NumBlocks(), pool.NumLive());
+	}
+}
+
+// +--------------------------------------------------------------------+
+// console entry point:
+//
+//   ssw.CampaignSoak <days> [seed] [step]
+//
+// runs the current campaign headless for the given number of days
+// and writes the report to the log.
+
+static void
+CampaignSoak(const TArray<FString>& Args)
+{
+	UCampaign* campaign = UCampaign::GetCampaign();
+
+	if (!campaign) {
+		UE_LOG(LogTemp, Warning, TEXT("ssw.CampaignSoak: no campaign is loaded"));
+		return;
+	}
+
+	int    ndays = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 30;
+	DWORD  seed  = Args.Num() > 1 ? (DWORD)FCString::Strtoui64(*Args[1], 0, 10) : 1;
+	double step  = Args.Num() > 2 ? FCString::Atod(*Args[2]) : 60;
+
+	CampaignRunner runner(campaign, seed);
+	runner.Run(ndays, step);
+	runner.Report();
+}
+
+static FAutoConsoleCommand CampaignSoakCommand(
+	TEXT("ssw.CampaignSoak"),
+	TEXT("Runs the current campaign without the game loop: ssw.CampaignSoak <days> [seed] [step seconds]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&CampaignSoak));
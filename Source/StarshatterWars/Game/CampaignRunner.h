@@ -0,0 +1,78 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Game
+	FILE:         CampaignRunner.h
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	CampaignRunner drives a dynamic campaign without the game
+	loop.  The campaign's planners are stepped on a virtual
+	stardate as fast as they will run, from a fixed random
+	seed, and the events, assignments and missions they produce
+	are tallied for each simulated day.  Used for soak testing
+	campaign balance over many runs, from code or from the
+	console with ssw.CampaignSoak <days> [seed] [step].
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../Foundation/Types.h"
+#include "../Foundation/List.h"
+
+// +--------------------------------------------------------------------+
+
+class UCampaign;
+class CombatGroup;
+
+// +--------------------------------------------------------------------+
+
+struct STARSHATTERWARS_API CampaignDayStats
+{
+	static const char* TYPENAME() { return "CampaignDayStats"; }
+
+	int      day;
+	int      events;        // combat events generated that day
+	int      assignments;   // combat assignments at the end of the day
+	int      missions;      // missions generated that day
+	int      released;      // actions whose action requirements were met that day
+};
+
+// +--------------------------------------------------------------------+
+
+class STARSHATTERWARS_API CampaignRunner
+{
+public:
+	static const char* TYPENAME() { return "CampaignRunner"; }
+
+	enum CONSTANTS { SECONDS_PER_DAY = 86400 };
+
+	CampaignRunner(UCampaign* c, DWORD seed = 1);
+	~CampaignRunner();
+
+	// steps the planners for the given number of simulated days,
+	// advancing the virtual clock by step seconds each frame.
+	// stops early if the campaign is won or lost:
+	void                    Run(int days, double step = 60);
+
+	const List<CampaignDayStats>& GetDays() const { return days; }
+	DWORD                   GetSeed()           const { return seed; }
+	double                  GetSimSeconds()     const { return sim_seconds; }
+	double                  GetWallSeconds()    const { return wall_seconds; }
+	double                  SimHoursPerSecond() const;
+
+	// writes the per day tallies and throughput to the log:
+	void                    Report() const;
+
+protected:
+	int                     CountAssignments(CombatGroup* g) const;
+
+	UCampaign*              campaign;
+	DWORD                   seed;
+	List<CampaignDayStats>  days;
+	double                  sim_seconds;
+	double                  wall_seconds;
+};
@@ -0,0 +1,303 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Game
+	FILE:         CollisionGrid.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Uniform hash grid broad phase for region collisions
+*/
+
+
+#include "CollisionGrid.h"
+#include "Physical.h"
+#include <math.h>
+#include <string.h>
+
+// +--------------------------------------------------------------------+
+
+// objects spanning more cells than this along any axis are
+// too big to hash and are tested against everything instead:
+static const int MAX_SPAN = 8;
+
+// keep cell indices well inside the range of an int:
+static const double MAX_CELL = 1e9;
+
+template <class T>
+static void Reserve(T*& a, int n, int& extent)
+{
+	if (n <= extent)
+		return;
+
+	int size = extent ? extent : 256;
+	while (size < n)
+		size *= 2;
+
+	T* b = new T[size];
+
+	if (a && extent > 0)
+		memcpy(b, a, extent * sizeof(T));
+
+	delete [] a;
+	a      = b;
+	extent = size;
+}
+
+// +--------------------------------------------------------------------+
+
+CollisionGrid::CollisionGrid(double size)
+	: cell_size(size > 0 ? size : 2e3), built(false), tests(0),
+	  entries(0), num_entries(0), max_entries(0),
+	  refs(0), num_refs(0), max_refs(0),
+	  buckets(0), num_buckets(0),
+	  oversize(0), num_oversize(0), max_oversize(0)
+{ }
+
+CollisionGrid::~CollisionGrid()
+{
+	delete [] entries;
+	delete [] refs;
+	delete [] buckets;
+	delete [] oversize;
+}
+
+// +--------------------------------------------------------------------+
+
+void
+CollisionGrid::SetCellSize(double size)
+{
+	if (size > 0 && size != cell_size) {
+		cell_size = size;
+		Clear();
+	}
+}
+
+void
+CollisionGrid::Clear()
+{
+	num_entries  = 0;
+	num_refs     = 0;
+	num_oversize = 0;
+	built        = false;
+}
+
+// +--------------------------------------------------------------------+
+
+void
+CollisionGrid::Insert(UPhysical* obj, int group)
+{
+	if (obj)
+		Insert(obj, group, obj->Location(), obj->Radius());
+}
+
+void
+CollisionGrid::Insert(UPhysical* obj, int group, const Point& loc, double radius)
+{
+	if (!obj)
+		return;
+
+	Reserve(entries, num_entries + 1, max_entries);
+
+	Entry& e = entries[num_entries++];
+
+	e.obj   = obj;
+	e.group = group;
+	e.x     = loc.x;
+	e.y     = loc.y;
+	e.z     = loc.z;
+	e.r     = radius > 0 ? radius : 0;
+
+	e.x0 = Cell(e.x - e.r);   e.x1 = Cell(e.x + e.r);
+	e.y0 = Cell(e.y - e.r);   e.y1 = Cell(e.y + e.r);
+	e.z0 = Cell(e.z - e.r);   e.z1 = Cell(e.z + e.r);
+
+	e.oversize = e.x1 - e.x0 >= MAX_SPAN ||
+	             e.y1 - e.y0 >= MAX_SPAN ||
+	             e.z1 - e.z0 >= MAX_SPAN;
+
+	built = false;
+}
+
+// +--------------------------------------------------------------------+
+
+int
+CollisionGrid::Cell(double v) const
+{
+	double c = floor(v / cell_size);
+
+	if (c >  MAX_CELL) c =  MAX_CELL;
+	if (c < -MAX_CELL) c = -MAX_CELL;
+
+	return (int)c;
+}
+
+int
+CollisionGrid::Hash(int cx, int cy, int cz) const
+{
+	DWORD h = (DWORD)cx * 73856093u ^ (DWORD)cy * 19349663u ^ (DWORD)cz * 83492791u;
+	return (int)(h & (DWORD)(num_buckets - 1));
+}
+
+// +--------------------------------------------------------------------+
+
+void
+CollisionGrid::Build()
+{
+	num_refs     = 0;
+	num_oversize = 0;
+
+	for (int i = 0; i < num_entries; i++) {
+		const Entry& e = entries[i];
+
+		if (e.oversize) {
+			Reserve(oversize, num_oversize + 1, max_oversize);
+			oversize[num_oversize++] = i;
+			continue;
+		}
+
+		int n = (e.x1 - e.x0 + 1) * (e.y1 - e.y0 + 1) * (e.z1 - e.z0 + 1);
+		Reserve(refs, num_refs + n, max_refs);
+
+		for (int cx = e.x0; cx <= e.x1; cx++)
+		for (int cy = e.y0; cy <= e.y1; cy++)
+		for (int cz = e.z0; cz <= e.z1; cz++) {
+			Ref& r = refs[num_refs++];
+
+			r.cx    = cx;
+			r.cy    = cy;
+			r.cz    = cz;
+			r.entry = i;
+			r.next  = -1;
+		}
+	}
+
+	// at least twice as many buckets as references, to keep
+	// unrelated cells from sharing a chain:
+	int size = 64;
+	while (size < num_refs * 2)
+		size *= 2;
+
+	if (size > num_buckets) {
+		delete [] buckets;
+		buckets     = new int[size];
+		num_buckets = size;
+	}
+
+	memset(buckets, 0xff, num_buckets * sizeof(int));
+
+	for (int i = 0; i < num_refs; i++) {
+		Ref& r = refs[i];
+		int  b = Hash(r.cx, r.cy, r.cz);
+
+		r.next     = buckets[b];
+		buckets[b] = i;
+	}
+
+	built = true;
+}
+
+// +--------------------------------------------------------------------+
+
+bool
+CollisionGrid::Match(const Entry& a, const Entry& b, int group_a, int group_b) const
+{
+	return (a.group == group_a && b.group == group_b) ||
+	       (a.group == group_b && b.group == group_a);
+}
+
+bool
+CollisionGrid::Overlap(const Entry& a, const Entry& b)
+{
+	tests++;
+
+	double dx = a.x - b.x;
+	double dy = a.y - b.y;
+	double dz = a.z - b.z;
+	double r  = a.r + b.r;
+
+	return dx * dx + dy * dy + dz * dz <= r * r;
+}
+
+// +--------------------------------------------------------------------+
+
+int
+CollisionGrid::FindPairs(int group_a, int group_b, CollisionFunc func, void* param)
+{
+	tests = 0;
+
+	if (!func)
+		return 0;
+
+	if (!built)
+		Build();
+
+	int pairs = 0;
+
+	for (int b = 0; b < num_buckets; b++) {
+		for (int i = buckets[b]; i >= 0; i = refs[i].next) {
+			const Ref&   ri = refs[i];
+			const Entry& ei = entries[ri.entry];
+
+			if (ei.group != group_a && ei.group != group_b)
+				continue;
+
+			for (int j = ri.next; j >= 0; j = refs[j].next) {
+				const Ref& rj = refs[j];
+
+				if (rj.cx != ri.cx || rj.cy != ri.cy || rj.cz != ri.cz)
+					continue;
+
+				const Entry& ej = entries[rj.entry];
+
+				if (!Match(ei, ej, group_a, group_b))
+					continue;
+
+				// only the first cell the two boxes share reports the pair:
+				if (ri.cx != (ei.x0 > ej.x0 ? ei.x0 : ej.x0) ||
+				    ri.cy != (ei.y0 > ej.y0 ? ei.y0 : ej.y0) ||
+				    ri.cz != (ei.z0 > ej.z0 ? ei.z0 : ej.z0))
+					continue;
+
+				if (Overlap(ei, ej)) {
+					if (ei.group == group_a)
+						func(ei.obj, ej.obj, param);
+					else
+						func(ej.obj, ei.obj, param);
+
+					pairs++;
+				}
+			}
+		}
+	}
+
+	// objects too big for the grid meet everything the slow way:
+	for (int n = 0; n < num_oversize; n++) {
+		int          i  = oversize[n];
+		const Entry& ei = entries[i];
+
+		for (int j = 0; j < num_entries; j++) {
+			const Entry& ej = entries[j];
+
+			// each pair of big objects only once:
+			if (ej.oversize && j <= i)
+				continue;
+
+			if (!Match(ei, ej, group_a, group_b))
+				continue;
+
+			if (Overlap(ei, ej)) {
+				if (ei.group == group_a)
+					func(ei.obj, ej.obj, param);
+				else
+					func(ej.obj, ei.obj, param);
+
+				pairs++;
+			}
+		}
+	}
+
+	return pairs;
+}
@@ -0,0 +1,107 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Game
+	FILE:         CollisionGrid.h
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Broad phase for region collisions.  Objects are hashed into a
+	uniform grid of cubic cells by the bounding box of their bounding
+	sphere, and only objects sharing a cell are tested against each
+	other.  A pair that shares several cells is reported once, from
+	the first cell of the overlap of their boxes.  Objects too big for
+	the grid (stations, asteroids) are kept aside and tested against
+	everything.
+
+	The grid is rebuilt every frame: Clear(), Insert() each object
+	with the group (ships, shots, debris...) it belongs to, and then
+	FindPairs() for each pair of groups that can collide.  Pairs whose
+	bounding spheres overlap are passed to the callback, which runs
+	the narrow phase (CollidesWith) and the collision response.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../Foundation/Types.h"
+#include "../Foundation/Geometry.h"
+
+// +--------------------------------------------------------------------+
+
+class UPhysical;
+
+typedef void (*CollisionFunc)(UPhysical* a, UPhysical* b, void* param);
+
+// +--------------------------------------------------------------------+
+
+class STARSHATTERWARS_API CollisionGrid
+{
+public:
+	static const char* TYPENAME() { return "CollisionGrid"; }
+
+	CollisionGrid(double cell_size = 2e3);
+	~CollisionGrid();
+
+	void        SetCellSize(double size);
+	double      GetCellSize()           const { return cell_size; }
+
+	void        Clear();
+	void        Insert(UPhysical* obj, int group);
+	void        Insert(UPhysical* obj, int group, const Point& loc, double radius);
+
+	// calls func(a, b, param) for every pair with a in group_a and
+	// b in group_b whose bounding spheres overlap.  the groups may be
+	// the same, in which case each pair is reported once.  returns
+	// the number of pairs reported:
+	int         FindPairs(int group_a, int group_b, CollisionFunc func, void* param);
+
+	int         NumObjects()            const { return num_entries; }
+	int         NumTests()              const { return tests; }   // sphere tests, last FindPairs
+
+private:
+	CollisionGrid(const CollisionGrid&);
+	CollisionGrid& operator=(const CollisionGrid&);
+
+	struct Entry {
+		UPhysical*  obj;
+		int         group;
+		double      x, y, z, r;
+		int         x0, y0, z0;
+		int         x1, y1, z1;
+		bool        oversize;
+	};
+
+	struct Ref {
+		int         cx, cy, cz;
+		int         entry;
+		int         next;
+	};
+
+	void        Build();
+	int         Cell(double v) const;
+	int         Hash(int cx, int cy, int cz) const;
+	bool        Match(const Entry& a, const Entry& b, int group_a, int group_b) const;
+	bool        Overlap(const Entry& a, const Entry& b);
+
+	double      cell_size;
+	bool        built;
+	int         tests;
+
+	Entry*      entries;
+	int         num_entries;
+	int         max_entries;
+
+	Ref*        refs;
+	int         num_refs;
+	int         max_refs;
+
+	int*        buckets;
+	int         num_buckets;
+
+	int*        oversize;
+	int         num_oversize;
+	int         max_oversize;
+};
@@ -17,6 +17,7 @@
 #include "Campaign.h"
 #include "Combatant.h"
 #include "CombatActionReq.h"
+#include "CombatActionGraph.h"
 #include "PlayerData.h"
 #include "../Foundation/Random.h"
 
@@ -27,7 +28,9 @@ CombatAction::CombatAction(int n, int typ, int sub, int iff)
 	status(PENDING), count(0), rval(-1), source(0), time(0),
 	start_before((int)1e9), start_after(0),
 	min_rank(0), max_rank(100),
-	delay(0), probability(100), asset_type(0), target_type(0)
+	delay(0), probability(100), asset_type(0), target_type(0),
+	graph(0), deps_dirty(true), deps_met(false), in_ready(false),
+	released(false), graph_index(-1)
 { }
 
 CombatAction::~CombatAction()
@@ -48,7 +51,7 @@ CombatAction::IsAvailable() const
 		pThis->rval = (int)RandomDouble(0, 100);
 
 		if (rval > probability)
-			pThis->status = SKIPPED;
+			pThis->SetStatus(SKIPPED);
 	}
 
 	if (status != PENDING)
@@ -68,10 +71,16 @@ CombatAction::IsAvailable() const
 		}
 
 		if (campaign->GetTime() > start_before) {
-			pThis->status = FAILED; // too late!
+			pThis->SetStatus(FAILED); // too late!
 			return false;
 		}
 
+		// an action that is still waiting on another one can't pass
+		// the loop below.  once the delay has been armed, the loop has
+		// no other side effects, so it can be skipped outright:
+		if (graph && delay <= 0 && !DependenciesMet())
+			return false;
+
 		// check requirements against actions in current campaign:
 		ListIter<CombatActionReq> iter = pThis->requirements;
 		while (++iter) {
@@ -79,21 +88,8 @@ CombatAction::IsAvailable() const
 			bool             ok = false;
 
 			if (r->action > 0) {
-				ListIter<CombatAction> action = campaign->GetActions();
-				while (++action) {
-					CombatAction* a = action.value();
-
-					if (a->Identity() == r->action) {
-						if (r->notreq) {
-							if (a->Status() == r->stat)
-								return false;
-						}
-						else {
-							if (a->Status() != r->stat)
-								return false;
-						}
-					}
-				}
+				if (!ActionReqMet(r))
+					return false;
 			}
 
 			// group-based requirement
@@ -220,6 +216,85 @@ CombatAction::IsAvailable() const
 
 // +----------------------------------------------------------------------+
 
+bool
+CombatAction::ActionReqMet(const CombatActionReq* r) const
+{
+	if (r->resolved) {
+		ListIter<CombatAction> iter = ((CombatActionReq*)r)->targets;
+		while (++iter) {
+			if (r->notreq ? iter->Status() == r->stat : iter->Status() != r->stat)
+				return false;
+		}
+
+		return true;
+	}
+
+	UCampaign* campaign = UCampaign::GetCampaign();
+	if (campaign) {
+		ListIter<CombatAction> action = campaign->GetActions();
+		while (++action) {
+			CombatAction* a = action.value();
+
+			if (a->Identity() == r->action) {
+				if (r->notreq) {
+					if (a->Status() == r->stat)
+						return false;
+				}
+				else {
+					if (a->Status() != r->stat)
+						return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+bool
+CombatAction::DependenciesMet() const
+{
+	if (!deps_dirty)
+		return deps_met;
+
+	CombatAction* pThis = (CombatAction*)this;
+	pThis->deps_met   = true;
+	pThis->deps_dirty = false;
+
+	ListIter<CombatActionReq> iter = pThis->requirements;
+	while (++iter) {
+		CombatActionReq* r = iter.value();
+
+		if (r->action > 0) {
+			// requirements added since the graph was built have no
+			// edges to invalidate the result, so it can't be kept:
+			if (!r->resolved)
+				pThis->deps_dirty = true;
+
+			if (!ActionReqMet(r)) {
+				pThis->deps_met = false;
+				break;
+			}
+		}
+	}
+
+	return deps_met;
+}
+
+// +----------------------------------------------------------------------+
+
+void
+CombatAction::SetStatus(int s)
+{
+	if (status == (char)s)
+		return;
+
+	status = (char)s;
+
+	if (graph)
+		graph->StatusChanged(this);
+}
+
 void
 CombatAction::FireAction()
 {
@@ -231,7 +306,7 @@ CombatAction::FireAction()
 		count--;
 
 	if (count < 1)
-		status = COMPLETE;
+		SetStatus(COMPLETE);
 }
 
 void
@@ -242,7 +317,7 @@ CombatAction::FailAction()
 		time = (int)campaign->GetTime();
 
 	count = 0;
-	status = FAILED;
+	SetStatus(FAILED);
 }
 
 // +----------------------------------------------------------------------+
@@ -25,6 +25,7 @@
 class Combatant;
 class CombatAction;
 class CombatActionReq;
+class CombatActionGraph;
 
 // +--------------------------------------------------------------------+
 
@@ -64,6 +65,8 @@ public:
 	CombatAction(int id, int type, int subtype, int team);
 
 	int operator == (const CombatAction& a)  const { return id == a.id; }
+	int operator <  (const CombatAction& a)  const { return id <  a.id; }
+	int operator <= (const CombatAction& a)  const { return id <= a.id; }
 
 	bool                 IsAvailable()  const;
 	void                 FireAction();
@@ -74,6 +77,10 @@ public:
 	static int           TypeFromName(const char* n);
 	static int           StatusFromName(const char* n);
 
+	// true when every action-based requirement is satisfied.
+	// only tracked once the campaign's action graph is built:
+	bool                 DependenciesMet() const;
+
 	// accessors/mutators:
 	int                  Identity()     const { return id; }
 	int                  Type()         const { return type; }
@@ -109,7 +116,7 @@ public:
 	void                 SetSubtype(int s) { subtype = (char)s; }
 	void                 SetOpposingType(int t) { opp_type = (char)t; }
 	void                 SetIFF(int t) { team = (char)t; }
-	void                 SetStatus(int s) { status = (char)s; }
+	void                 SetStatus(int s);
 	void                 SetSource(int s) { source = s; }
 	void                 SetLocation(const Point& p) { loc = p; }
 	void                 SetSystem(Text sys) { system = sys; }
@@ -134,6 +141,8 @@ public:
 
 
 private:
+	bool                 ActionReqMet(const CombatActionReq* r) const;
+
 	int                  id;
 	char                 type;
 	char                 subtype;
@@ -167,4 +176,15 @@ private:
 	List<Text>           target_kills;
 
 	List<CombatActionReq> requirements;
+
+	// maintained by the CombatActionGraph:
+	CombatActionGraph*   graph;
+	List<CombatAction>   dependents;
+	bool                 deps_dirty;
+	bool                 deps_met;
+	bool                 in_ready;
+	bool                 released;
+	int                  graph_index;
+
+	friend class CombatActionGraph;
 };
@@ -0,0 +1,231 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Game
+	FILE:         CombatActionGraph.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Dependency graph over the scripted actions of a campaign
+*/
+
+
+#include "CombatActionGraph.h"
+#include "CombatAction.h"
+#include "CombatActionReq.h"
+
+// +--------------------------------------------------------------------+
+
+CombatActionGraph::CombatActionGraph()
+	: released(0), walking(false)
+{ }
+
+CombatActionGraph::~CombatActionGraph()
+{
+	Clear();
+}
+
+// +--------------------------------------------------------------------+
+
+void
+CombatActionGraph::Build(List<CombatAction>& list)
+{
+	Clear();
+
+	if (list.isEmpty())
+		return;
+
+	// sort a copy by identity, so each requirement can find the
+	// actions it names by binary search:
+	List<CombatAction> by_id;
+	by_id.reserve(list.size());
+
+	ListIter<CombatAction> iter = list;
+	while (++iter) {
+		CombatAction* a = iter.value();
+
+		a->graph       = this;
+		a->deps_dirty  = true;
+		a->in_ready    = false;
+		a->released    = false;
+		a->graph_index = actions.size();
+
+		actions.append(a);
+		by_id.append(a);
+	}
+
+	by_id.sort();
+
+	iter.reset();
+	while (++iter) {
+		CombatAction* a = iter.value();
+
+		ListIter<CombatActionReq> req = a->requirements;
+		while (++req) {
+			CombatActionReq* r = req.value();
+
+			if (r->action <= 0)
+				continue;
+
+			int lo = 0;
+			int hi = by_id.size();
+
+			while (lo < hi) {
+				int mid = (lo + hi) / 2;
+
+				if (by_id[mid]->Identity() < r->action)
+					lo = mid + 1;
+				else
+					hi = mid;
+			}
+
+			for (int i = lo; i < by_id.size() && by_id[i]->Identity() == r->action; i++) {
+				CombatAction* target = by_id[i];
+
+				r->targets.append(target);
+
+				// a is the latest dependent of anything it names twice:
+				if (target->dependents.isEmpty() || target->dependents.last() != a)
+					target->dependents.append(a);
+			}
+
+			r->resolved = true;
+		}
+	}
+
+	// everything that is not waiting on another action
+	// starts out released:
+	iter.reset();
+	while (++iter)
+		Update(iter.value());
+
+	walking = true;
+}
+
+void
+CombatActionGraph::Clear()
+{
+	ListIter<CombatAction> iter = actions;
+	while (++iter) {
+		CombatAction* a = iter.value();
+
+		a->graph       = 0;
+		a->deps_dirty  = true;
+		a->in_ready    = false;
+		a->released    = false;
+		a->graph_index = -1;
+		a->dependents.clear();
+
+		ListIter<CombatActionReq> req = a->requirements;
+		while (++req) {
+			req->targets.clear();
+			req->resolved = false;
+		}
+	}
+
+	actions.clear();
+	ready.clear();
+	released = 0;
+	walking  = false;
+}
+
+// +--------------------------------------------------------------------+
+
+void
+CombatActionGraph::StatusChanged(CombatAction* action)
+{
+	if (!action || action->graph != this)
+		return;
+
+	Update(action);
+
+	ListIter<CombatAction> iter = action->dependents;
+	while (++iter) {
+		CombatAction* a = iter.value();
+
+		a->deps_dirty = true;
+		Update(a);
+	}
+}
+
+void
+CombatActionGraph::Update(CombatAction* a)
+{
+	bool pending = a->Status() == CombatAction::PENDING;
+	bool met     = pending && a->DependenciesMet();
+
+	if (met && !a->released) {
+		a->released = true;
+		released++;
+	}
+	else if (!met) {
+		a->released = false;
+	}
+
+	// a deadline can fail the action while it is still waiting:
+	bool want = met || (pending && a->StartBefore() < (int)1e9);
+
+	if (want == a->in_ready)
+		return;
+
+	int n = FindReady(a->graph_index);
+
+	if (want)
+		ready.insert(a, n);
+	else
+		ready.removeIndex(n);
+
+	a->in_ready = want;
+}
+
+// +--------------------------------------------------------------------+
+
+int
+CombatActionGraph::FindReady(int index) const
+{
+	// the first slot in the ready set at or after the index:
+	int lo = 0;
+	int hi = ready.size();
+
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
+
+		if (ready[mid]->graph_index < index)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	return lo;
+}
+
+bool
+CombatActionGraph::AllDrawn() const
+{
+	for (int i = 0; i < actions.size(); i++)
+		if (actions[i]->rval < 0)
+			return false;
+
+	return true;
+}
+
+CombatAction*
+CombatActionGraph::NextReady(CombatAction* after)
+{
+	int index = (after && after->graph == this) ? after->graph_index + 1 : 0;
+
+	if (walking) {
+		if (index < actions.size())
+			return actions[index];
+
+		// the walk is over; once it has drawn every roll the
+		// set is enough from then on:
+		walking = !AllDrawn();
+		return 0;
+	}
+
+	int n = FindReady(index);
+	return n < ready.size() ? ready[n] : 0;
+}
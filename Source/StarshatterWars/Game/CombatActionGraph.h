@@ -0,0 +1,80 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Game
+	FILE:         CombatActionGraph.h
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Dependency graph over the scripted actions of a campaign.  Build
+	resolves every action-based requirement to the actions it names,
+	and gives each named action the list of actions that wait on it.
+	From then on an action only rechecks its action requirements when
+	one of those actions changes status, instead of searching the
+	whole action list on every evaluation.
+
+	The graph also keeps the ready set: every pending action whose
+	action requirements are all met, plus every pending action with
+	a deadline, since IsAvailable fails those whether or not they are
+	waiting.  The planners walk the ready set in campaign order with
+	NextReady instead of polling every action.  Time, rank, score and
+	group requirements are not events, so IsAvailable still has the
+	final word on every action in the set.
+
+	Until every action has drawn its probability roll, NextReady walks
+	the whole list, so the rolls are taken in the same order as they
+	always were and a seeded campaign plays out the same.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../Foundation/Types.h"
+#include "../Foundation/List.h"
+
+// +--------------------------------------------------------------------+
+
+class CombatAction;
+
+// +--------------------------------------------------------------------+
+
+class STARSHATTERWARS_API CombatActionGraph
+{
+public:
+	static const char* TYPENAME() { return "CombatActionGraph"; }
+
+	CombatActionGraph();
+	~CombatActionGraph();
+
+	// links the actions; they must stay alive until Clear:
+	void           Build(List<CombatAction>& actions);
+	void           Clear();
+
+	// called by an action whose status has just changed:
+	void           StatusChanged(CombatAction* action);
+
+	// the next action in the ready set after the given one, in the
+	// order of the campaign's action list, or the first when after is
+	// null.  actions may enter or leave the set while it is walked,
+	// as they fire or fail:
+	CombatAction*  NextReady(CombatAction* after = 0);
+
+	int            NumReady()    const { return ready.size(); }
+	int            NumActions()  const { return actions.size(); }
+
+	// every release since Build, whether or not a planner has seen
+	// it, so an observer can count releases without touching the set:
+	int            NumReleased() const { return released; }
+
+private:
+	void           Update(CombatAction* action);
+	int            FindReady(int index) const;
+	bool           AllDrawn() const;
+
+	List<CombatAction>   actions;
+	List<CombatAction>   ready;      // sorted by graph_index
+	int                  released;
+	bool                 walking;
+};
@@ -14,9 +14,11 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "../Foundation/List.h"
 #include "../System/SSWGameInstance.h"
 
 class Combatant;
+class CombatAction;
 /**
  * 
  */
@@ -27,15 +29,16 @@ public:
 	static const char* TYPENAME() { return "CombatActionReq"; }
 
 	CombatActionReq(int a, int s, bool n = false)
-		: action(a), stat(s), notreq(n), c1(0), c2(0), comp(0), score(0), intel(0) { }
+		: action(a), stat(s), notreq(n), c1(0), c2(0), comp(0), score(0), intel(0),
+		resolved(false) { }
 
 	CombatActionReq(Combatant* a1, Combatant* a2, int comparison, int value)
 		: action(0), stat(0), notreq(0), c1(a1), c2(a2), group_type(0), group_id(0),
-		comp(comparison), score(value), intel(0) { }
+		comp(comparison), score(value), intel(0), resolved(false) { }
 
 	CombatActionReq(Combatant* a1, int gtype, int gid, int comparison, int value, int intel_level = 0)
 		: action(0), stat(0), notreq(0), c1(a1), c2(0), group_type(gtype), group_id(gid),
-		comp(comparison), score(value), intel(intel_level) { }
+		comp(comparison), score(value), intel(intel_level), resolved(false) { }
 
 	static int CompFromName(const char* sym);
 
@@ -50,4 +53,9 @@ public:
 	int         intel;
 	int         group_type;
 	int         group_id;
+
+	// the actions named by an action requirement, once the
+	// campaign's CombatActionGraph has been built:
+	List<CombatAction> targets;
+	bool        resolved;
 };
@@ -53,6 +53,26 @@ CombatAssignment::operator < (const CombatAssignment& a) const
 
 // +--------------------------------------------------------------------+
 
+bool
+CombatAssignment::IsEventCandidate(CombatGroup* player_group)
+{
+	if (!resource || !objective)
+		return false;
+
+	if (resource->IsReserve() || objective->IsReserve())
+		return false;
+
+	if (resource->CalcValue() < 50 || objective->CalcValue() < 50)
+		return false;
+
+	if (resource == player_group || objective == player_group)
+		return false;
+
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
 const char*
 CombatAssignment::GetDescription() const
 {
@@ -16,6 +16,7 @@
 #include "CoreMinimal.h"
 #include "../Foundation/Types.h"
 #include "../Foundation/List.h"
+#include "../Foundation/ObjectPool.h"
 
 // +--------------------------------------------------------------------+
 
@@ -37,6 +38,13 @@ public:
 
 	CombatAssignment(int t, CombatGroup* obj, CombatGroup* rsc = 0);
 
+	// the planner rebuilds every assignment on each pass, so they
+	// are normally made in the pool of the combatant that owns them:
+	static void* operator new(size_t size) { return ObjectPool::New(0, size); }
+	static void* operator new(size_t size, ObjectPool* pool) { return ObjectPool::New(pool, size); }
+	static void  operator delete(void* p) { ObjectPool::Delete(p); }
+	static void  operator delete(void* p, ObjectPool*) { ObjectPool::Delete(p); }
+
 	int operator < (const CombatAssignment& a) const;
 
 	// operations:
@@ -51,6 +59,11 @@ public:
 	const char* GetDescription()  const;
 	bool                 IsActive()  const { return resource != 0; }
 
+	// whether the assignment may be resolved as a statistical event:
+	// both sides present, out of reserve, worth at least 50 points
+	// and neither of them the player's group:
+	bool                 IsEventCandidate(CombatGroup* player_group);
+
 private:
 	int                  type;
 	CombatGroup* objective;
@@ -16,22 +16,30 @@
 #include "CombatGroup.h"
 #include "CombatUnit.h"
 #include "CombatZone.h"
+#include "ZoneForce.h"
 #include "Combatant.h"
 #include "CombatAssignment.h"
+#include "CombatGroupIndex.h"
 #include "Campaign.h"
+#include "Intel.h"
 //#include "ShipDesign.h"
 #include "Ship.h"
 
 #include "../System/Game.h"
 #include "../Foundation/DataLoader.h"
 #include "../Foundation/ParseUtil.h"
+#include "../Foundation/Random.h"
+#include "../Foundation/MappedFile.h"
+#include "../Foundation/Reader.h"
+#include "../Foundation/TermStream.h"
+#include "../Foundation/TermBinder.h"
 
 // +----------------------------------------------------------------------+
 
 CombatGroup::CombatGroup(int t, int n, const char* s, int iff_code, int e, CombatGroup* p)
 	: type(t), id(n), name(s), iff(iff_code), enemy_intel(e),
 	parent(p), value(0), plan_value(0), unit_index(0), combatant(0),
-	expanded(false), sorties(0), kills(0), points(0),
+	unit_count(0), value_dirty(true), count_dirty(true), group_index(0), expanded(false), sorties(0), kills(0), points(0),
 	current_zone(0), assigned_zone(0), zone_lock(false)
 {
 	if (parent)
@@ -40,6 +48,19 @@ CombatGroup::CombatGroup(int t, int n, const char* s, int iff_code, int e, Comba
 
 CombatGroup::~CombatGroup()
 {
+	if (group_index) {
+		// the whole tree is going, don't maintain the index:
+		delete group_index;
+		group_index = 0;
+	}
+	else if (parent) {
+		CombatGroupIndex* tree_index = GetIndex(false);
+		if (tree_index)
+			tree_index->RemoveBranch(this);
+	}
+
+	ChangeAssignedZone(0);
+
 	assignments.destroy();
 	components.destroy();
 	units.destroy();
@@ -47,9 +68,273 @@ CombatGroup::~CombatGroup()
 
 // +--------------------------------------------------------------------+
 
-CombatGroup* CombatGroup::LoadOrderOfBattle(const char* fname, int iff, Combatant* combatant)
+// Order of battle files are streamed rather than parsed into terms.
+// The group binder collects one group struct at a time, and its unit
+// binder builds each CombatUnit as its struct closes:
+
+class OOBUnitBinder : public TermBinder
+{
+public:
+	OOBUnitBinder(const int& group_iff)
+		: iff(group_iff), keep(false)
+	{
+		BindText(SYM_NAME,       &name);
+		BindText(SYM_REGNUM,     &regnum);
+		BindText(SYM_REGION,     &region);
+		BindVec(SYM_LOC,         &loc);
+		BindText(SYM_TYPE,       &type);
+		BindText(SYM_DESIGN,     &design);
+		BindText(SYM_SKIN,       &skin);
+		BindNumber(SYM_COUNT,    &count);
+		BindNumber(SYM_DEAD_COUNT, &dead);
+		BindNumber(SYM_DAMAGE,   &damage);
+		BindNumber(SYM_HEADING,  &heading);
+	}
+
+	virtual void BeginRecord()
+	{
+		// name, regnum, design and skin carry over from the previous
+		// unit of the group, as they did in the tree loader:
+		region  = "";
+		loc     = Vec3(1.0e9f, 0.0f, 0.0f);
+		count   = 1;
+		dead    = 0;
+		damage  = 0;
+		heading = 0;
+	}
+
+	virtual void EndRecord()
+	{
+		if (!keep)
+			return;
+
+		CombatUnit* cu = new CombatUnit(name, regnum, UShip::ClassForName(type), design, count, iff);
+		cu->SetRegion(region);
+		cu->SetSkin(skin);
+		cu->MoveTo(loc);
+		cu->Kill(dead);
+		cu->SetSustainedDamage(damage);
+		cu->SetHeading(heading * DEGREES);
+		units.append(cu);
+	}
+
+	const int&        iff;
+	bool              keep;       // the unit belongs to the loaded team
+	List<CombatUnit>  units;
+
+	Text  name;
+	Text  regnum;
+	Text  region;
+	Text  type;
+	Text  design;
+	Text  skin;
+	int   count;
+	int   dead;
+	int   damage;
+	int   heading;
+	Vec3  loc;
+};
+
+class OOBGroupBinder : public TermBinder
 {
-	return nullptr;
+public:
+	OOBGroupBinder(int load_team)
+		: team(load_team), default_iff(-1), unit_binder(iff), complete(false)
+	{
+		BindText(SYM_NAME,        &name);
+		BindText(SYM_TYPE,        &type);
+		BindText(SYM_INTEL,       &intel);
+		BindText(SYM_REGION,      &region);
+		BindText(SYM_SYSTEM,      &system);
+		BindVec(SYM_LOC,          &loc);
+		BindText(SYM_PARENT_TYPE, &parent_type);
+		BindNumber(SYM_PARENT_ID, &parent_id);
+		BindNumber(SYM_IFF,       &iff);
+		BindNumber(SYM_ID,        &id);
+		BindNumber(SYM_UNIT_INDEX, &unit_index);
+		BindStruct(SYM_UNIT,      &unit_binder);
+	}
+
+	virtual ~OOBGroupBinder()
+	{
+		unit_binder.units.destroy();
+	}
+
+	virtual void BeginRecord()
+	{
+		name        = "";
+		type        = "";
+		intel       = "KNOWN";
+		region      = "";
+		system      = "";
+		parent_type = "";
+		parent_id   = 0;
+		id          = 0;
+		unit_index  = 0;
+		loc         = Vec3(1.0e9f, 0.0f, 0.0f);
+
+		// all groups in this OOB default to the IFF of the main force:
+		iff = default_iff;
+
+		unit_binder.keep   = team < 0 || iff == team;
+		unit_binder.name   = "";
+		unit_binder.regnum = "";
+		unit_binder.design = "";
+		unit_binder.skin   = "";
+		unit_binder.units.destroy();
+
+		complete = false;
+	}
+
+	virtual void EndField(Symbol key)
+	{
+		// units are only built for the team being loaded, judged by
+		// the iff the group has when the unit is read:
+		if (key != SYM_UNIT)
+			unit_binder.keep = team < 0 || iff == team;
+	}
+
+	virtual void EndRecord()
+	{
+		complete = true;
+	}
+
+	bool Accepted() const
+	{
+		return iff >= 0 && (iff == team || team < 0);
+	}
+
+	int            team;
+	int            default_iff;
+	OOBUnitBinder  unit_binder;
+	bool           complete;
+
+	Text  name;
+	Text  type;
+	Text  intel;
+	Text  region;
+	Text  system;
+	Text  parent_type;
+	int   parent_id;
+	int   iff;
+	int   id;
+	int   unit_index;
+	Vec3  loc;
+};
+
+// +--------------------------------------------------------------------+
+
+CombatGroup*
+CombatGroup::LoadOrderOfBattle(const char* filename, int team, Combatant* owner)
+{
+	CombatGroup* force = 0;
+
+	MappedFile file;
+	if (!filename || !file.Open(filename)) {
+		UE_LOG(LogTemp, Log, TEXT("ERROR: could not load order of battle '%s'"), *FString(filename));
+		return 0;
+	}
+
+	TermStream stream(new BlockReader(file.GetData(), file.GetSize()));
+
+	if (!stream.ParseFileType("ORDER_OF_BATTLE")) {
+		UE_LOG(LogTemp, Log, TEXT("ERROR: invalid Order of Battle file '%s'"), *FString(filename));
+		return 0;
+	}
+
+	OOBGroupBinder group(team);
+	TermBinder     oob(filename);
+
+	oob.BindStruct(SYM_GROUP, &group);
+
+	while (stream.ParseTerm(oob)) {
+		if (!group.complete)
+			continue;
+
+		group.complete = false;
+
+		if (!group.Accepted())
+			continue;
+
+		CombatGroup* parent_group = 0;
+
+		if (force) {
+			parent_group = force->FindGroup(TypeFromName(group.parent_type), group.parent_id);
+
+			// nothing could ever reach a group outside the force:
+			if (!parent_group) {
+				UE_LOG(LogTemp, Log, TEXT("WARNING: no parent for group '%s' in '%s'"), *FString(group.name.data()), *FString(filename));
+				continue;
+			}
+		}
+
+		CombatGroup* g = new CombatGroup(TypeFromName(group.type), group.id, group.name,
+			group.iff, Intel::IntelFromName(group.intel), parent_group);
+
+		g->region     = group.region;
+		g->combatant  = owner;
+		g->unit_index = group.unit_index;
+
+		if (group.loc.x >= 1e9) {
+			if (parent_group)
+				g->location = parent_group->location;
+			else
+				g->location = Vec3(0, 0, 0);
+		}
+		else {
+			g->location = group.loc;
+		}
+
+		List<CombatUnit>& unit_list = group.unit_binder.units;
+
+		if (unit_list.size()) {
+			unit_list[0]->SetLeader(true);
+
+			ListIter<CombatUnit> u = unit_list;
+			while (++u) {
+				u->SetCombatGroup(g);
+
+				if (u->GetRegion().length() < 1) {
+					u->SetRegion(g->GetRegion());
+					u->MoveTo(g->Location());
+				}
+
+				if (parent_group &&
+					(u->Type() == UShip::FIGHTER ||
+						u->Type() == UShip::ATTACK)) {
+
+					CombatUnit*  carrier = 0;
+					CombatGroup* p       = parent_group;
+
+					while (p && !carrier) {
+						if (p->units.size() && p->units[0]->Type() == UShip::CARRIER) {
+							carrier = p->units[0];
+							u->SetCarrier(carrier);
+							u->SetRegion(carrier->GetRegion());
+						}
+
+						p = p->parent;
+					}
+				}
+			}
+
+			g->units.append(unit_list);
+			unit_list.clear();
+		}
+
+		if (!force) {
+			force = g;
+			group.default_iff = g->GetIFF();
+		}
+	}
+
+	if (stream.Failed())
+		UE_LOG(LogTemp, Log, TEXT("WARNING: order of battle '%s' stopped at a syntax error"), *FString(filename));
+
+	if (force)
+		force->CalcValue();
+
+	return force;
 }
 
 void
@@ -58,6 +343,21 @@ CombatGroup::AddComponent(CombatGroup* g)
 	if (g) {
 		g->parent = this;
 		components.append(g);
+
+		// a former root gives up its own index to the tree's:
+		if (g->group_index) {
+			delete g->group_index;
+			g->group_index = 0;
+		}
+
+		CombatGroupIndex* tree_index = GetIndex(false);
+		if (tree_index)
+			tree_index->AddBranch(g);
+
+		// the new branch may sit under a reserve group, or lift
+		// this one out of reserve:
+		g->InvalidateCounts();
+		Invalidate();
 	}
 }
 
@@ -199,54 +499,78 @@ CombatGroup::IsReserve() const
 const int*
 CombatGroup::PreferredAttacker(int type)
 {
-	static int p[8];
-
-	ZeroMemory(p, sizeof(p));
+	// one read-only table per type, so planners on different
+	// threads can ask at once:
+	static const int none[8] = { 0 };
 
 	switch (type) {
 		//case FLEET:
 	case (int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON:   
-		p[0] = (int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON;
-		p[1] = (int)ECOMBATGROUP_TYPE::BATTLE_GROUP;
-		p[2] = (int)ECOMBATGROUP_TYPE::CARRIER_GROUP;
-		p[3] = (int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::BATTLE_GROUP,
+				(int)ECOMBATGROUP_TYPE::CARRIER_GROUP,
+				(int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON
+			};
+			return p;
+		}
 
 	case (int)ECOMBATGROUP_TYPE::BATTLE_GROUP:         
-		p[0] = BATTLE_GROUP;
-		p[1] = (int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON;
-		p[2] = (int)ECOMBATGROUP_TYPE::CARRIER_GROUP;
-		p[3] = (int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::BATTLE_GROUP,
+				(int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::CARRIER_GROUP,
+				(int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON
+			};
+			return p;
+		}
 
 	case (int)ECOMBATGROUP_TYPE::CARRIER_GROUP:  
-		p[0] = (int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON;
-		p[1] = (int)ECOMBATGROUP_TYPE::BATTLE_GROUP;
-		p[2] = (int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON;
-		p[3] = (int)ECOMBATGROUP_TYPE::CARRIER_GROUP;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::BATTLE_GROUP,
+				(int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::CARRIER_GROUP
+			};
+			return p;
+		}
 
 		//case WING:
 	case (int)ECOMBATGROUP_TYPE::LCA_SQUADRON:
 	case (int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON:
 	case (int)ECOMBATGROUP_TYPE::INTERCEPT_SQUADRON:
 	case (int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON:   
-		p[0] = (int)ECOMBATGROUP_TYPE::INTERCEPT_SQUADRON;
-		p[1] = (int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::INTERCEPT_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON
+			};
+			return p;
+		}
 
 		//case BATTALION:
 	case (int)ECOMBATGROUP_TYPE::STATION:       
-		p[0] = (int)ECOMBATGROUP_TYPE::BATTLE_GROUP;
-		p[1] = (int)ECOMBATGROUP_TYPE::CARRIER_GROUP;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::BATTLE_GROUP,
+				(int)ECOMBATGROUP_TYPE::CARRIER_GROUP
+			};
+			return p;
+		}
 
 	case (int)ECOMBATGROUP_TYPE::STARBASE:
 	case (int)ECOMBATGROUP_TYPE::BATTERY:
 	case (int)ECOMBATGROUP_TYPE::MISSILE:    
-		p[0] = (int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON;
-		p[1] = (int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON
+			};
+			return p;
+		}
 
 		//case C3I:
 	case (int)ECOMBATGROUP_TYPE::MINEFIELD:
@@ -254,20 +578,28 @@ CombatGroup::PreferredAttacker(int type)
 	case (int)ECOMBATGROUP_TYPE::EARLY_WARNING:
 	case (int)ECOMBATGROUP_TYPE::FWD_CONTROL_CTR:
 	case (int)ECOMBATGROUP_TYPE::ECM:       
-		p[0] = (int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON;
-		p[1] = (int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON;
-		p[2] = (int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON
+			};
+			return p;
+		}
 
 		//case SUPPORT:
 	case (int)ECOMBATGROUP_TYPE::COURIER:
 	case (int)ECOMBATGROUP_TYPE::MEDICAL:
 	case (int)ECOMBATGROUP_TYPE::SUPPLY:
 	case (int)ECOMBATGROUP_TYPE::REPAIR:   
-		p[0] = (int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON;
-		p[1] = (int)ECOMBATGROUP_TYPE::BATTLE_GROUP;
-		p[2] = (int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::BATTLE_GROUP,
+				(int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON
+			};
+			return p;
+		}
 
 		//case CIVILIAN:
 
@@ -275,29 +607,41 @@ CombatGroup::PreferredAttacker(int type)
 	case (int)ECOMBATGROUP_TYPE::FACTORY:
 	case (int)ECOMBATGROUP_TYPE::REFINERY:
 	case (int)ECOMBATGROUP_TYPE::RESOURCE:   
-		p[0] = (int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON;
-		p[1] = (int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON
+			};
+			return p;
+		}
 
 		//case INFRASTRUCTURE:
 	case (int)ECOMBATGROUP_TYPE::TRANSPORT:
 	case (int)ECOMBATGROUP_TYPE::NETWORK:
 	case (int)ECOMBATGROUP_TYPE::HABITAT:
 	case (int)ECOMBATGROUP_TYPE::STORAGE:   
-		p[0] = (int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON;
-		p[1] = (int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON
+			};
+			return p;
+		}
 
 		//case NON_COM:
 	case (int)ECOMBATGROUP_TYPE::FREIGHT:
 	case (int)ECOMBATGROUP_TYPE::PASSENGER:
 	case (int)ECOMBATGROUP_TYPE::PRIVATE:  
-		p[0] = (int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON;
-		p[1] = (int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON
+			};
+			return p;
+		}
 	}
 
-	return p;
+	return none;
 }
 
 // +--------------------------------------------------------------------+
@@ -305,9 +649,9 @@ CombatGroup::PreferredAttacker(int type)
 const int*
 CombatGroup::PreferredDefender(int type)
 {
-	static int p[8];
-
-	ZeroMemory(p, sizeof(p));
+	// one read-only table per type, so planners on different
+	// threads can ask at once:
+	static const int none[8] = { 0 };
 
 	switch (type) {
 		//case FLEET:
@@ -319,40 +663,56 @@ CombatGroup::PreferredDefender(int type)
 	case (int)ECOMBATGROUP_TYPE::LCA_SQUADRON:
 	case (int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON:
 	case (int)ECOMBATGROUP_TYPE::INTERCEPT_SQUADRON:
-	case (int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON:     break;
+	case (int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON:     return none;
 
 		//case BATTALION:
 	case (int)ECOMBATGROUP_TYPE::STATION:   
-		p[0] = (int)ECOMBATGROUP_TYPE::BATTLE_GROUP;
-		p[1] = (int)ECOMBATGROUP_TYPE::CARRIER_GROUP;
-		p[2] = (int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::BATTLE_GROUP,
+				(int)ECOMBATGROUP_TYPE::CARRIER_GROUP,
+				(int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON
+			};
+			return p;
+		}
 	case (int)ECOMBATGROUP_TYPE::STARBASE:
 	case (int)ECOMBATGROUP_TYPE::MINEFIELD:
 	case (int)ECOMBATGROUP_TYPE::BATTERY:
 	case (int)ECOMBATGROUP_TYPE::MISSILE:     
-		p[0] = (int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON;
-		p[1] = (int)ECOMBATGROUP_TYPE::INTERCEPT_SQUADRON;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::INTERCEPT_SQUADRON
+			};
+			return p;
+		}
 
 		//case C3I:
 	case (int)ECOMBATGROUP_TYPE::COMM_RELAY:
 	case (int)ECOMBATGROUP_TYPE::EARLY_WARNING:
 	case (int)ECOMBATGROUP_TYPE::FWD_CONTROL_CTR:
 	case (int)ECOMBATGROUP_TYPE::ECM:   
-		p[0] = (int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON;
-		p[1] = (int)ECOMBATGROUP_TYPE::INTERCEPT_SQUADRON;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::INTERCEPT_SQUADRON
+			};
+			return p;
+		}
 
 		//case SUPPORT:
 	case (int)ECOMBATGROUP_TYPE::COURIER:
 	case (int)ECOMBATGROUP_TYPE::MEDICAL:
 	case (int)ECOMBATGROUP_TYPE::SUPPLY:
 	case (int)ECOMBATGROUP_TYPE::REPAIR:   
-		p[0] = (int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON;
-		p[1] = (int)ECOMBATGROUP_TYPE::BATTLE_GROUP;
-		p[2] = (int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::BATTLE_GROUP,
+				(int)ECOMBATGROUP_TYPE::ATTACK_SQUADRON
+			};
+			return p;
+		}
 
 		//case CIVILIAN:
 
@@ -360,29 +720,41 @@ CombatGroup::PreferredDefender(int type)
 	case (int)ECOMBATGROUP_TYPE::FACTORY:
 	case (int)ECOMBATGROUP_TYPE::REFINERY:
 	case (int)ECOMBATGROUP_TYPE::RESOURCE:   
-		p[0] = (int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON;
-		p[1] = (int)ECOMBATGROUP_TYPE::INTERCEPT_SQUADRON;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::INTERCEPT_SQUADRON
+			};
+			return p;
+		}
 
 		//case INFRASTRUCTURE:
 	case (int)ECOMBATGROUP_TYPE::TRANSPORT:
 	case (int)ECOMBATGROUP_TYPE::NETWORK:
 	case (int)ECOMBATGROUP_TYPE::HABITAT:
 	case (int)ECOMBATGROUP_TYPE::STORAGE:    
-		p[0] = (int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON;
-		p[1] = (int)ECOMBATGROUP_TYPE::INTERCEPT_SQUADRON;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::FIGHTER_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::INTERCEPT_SQUADRON
+			};
+			return p;
+		}
 
 		//case NON_COM:
 	case (int)ECOMBATGROUP_TYPE::FREIGHT:
 	case (int)ECOMBATGROUP_TYPE::PASSENGER:
 	case (int)ECOMBATGROUP_TYPE::PRIVATE:    
-		p[0] = (int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON;
-		p[1] = (int)ECOMBATGROUP_TYPE::BATTLE_GROUP;
-		break;
+		{
+			static const int p[8] = {
+				(int)ECOMBATGROUP_TYPE::DESTROYER_SQUADRON,
+				(int)ECOMBATGROUP_TYPE::BATTLE_GROUP
+			};
+			return p;
+		}
 	}
 
-	return p;
+	return none;
 }
 
 // +--------------------------------------------------------------------+
@@ -390,6 +762,15 @@ CombatGroup::PreferredDefender(int type)
 CombatGroup*
 CombatGroup::FindGroup(int t, int n)
 {
+	if (n >= 0) {
+		// every group in the tree is indexed, so a miss is final.  a
+		// hit outside this branch may hide a duplicate inside it:
+		CombatGroup* g = GetIndex()->FindGroup(t, n);
+
+		if (!g || Contains(g))
+			return g;
+	}
+
 	CombatGroup* result = 0;
 
 	if (type == t && (n < 0 || id == n))
@@ -405,6 +786,40 @@ CombatGroup::FindGroup(int t, int n)
 
 // +--------------------------------------------------------------------+
 
+CombatGroup*
+CombatGroup::GetRoot()
+{
+	CombatGroup* root = this;
+	while (root->parent)
+		root = root->parent;
+
+	return root;
+}
+
+bool
+CombatGroup::Contains(const CombatGroup* g) const
+{
+	while (g && g != this)
+		g = g->parent;
+
+	return g == this;
+}
+
+CombatGroupIndex*
+CombatGroup::GetIndex(bool build)
+{
+	CombatGroup* root = GetRoot();
+
+	if (!root->group_index && build) {
+		root->group_index = new CombatGroupIndex;
+		root->group_index->AddBranch(root);
+	}
+
+	return root->group_index;
+}
+
+// +--------------------------------------------------------------------+
+
 CombatGroup*
 CombatGroup::Clone(bool deep)
 {
@@ -422,6 +837,8 @@ CombatGroup::Clone(bool deep)
 		clone->units.append(u);
 	}
 
+	clone->Invalidate();
+
 	if (deep) {
 		for (int i = 0; i < components.size(); i++) {
 			CombatGroup* g = components[i]->Clone(deep);
@@ -807,7 +1224,7 @@ CombatGroup::SetAssignedSystem(const char* s)
 void
 CombatGroup::SetAssignedZone(CombatZone* z)
 {
-	assigned_zone = z;
+	ChangeAssignedZone(z);
 
 	if (!assigned_zone)
 		zone_lock = false;
@@ -823,7 +1240,7 @@ void
 CombatGroup::ClearUnlockedZones()
 {
 	if (!zone_lock)
-		assigned_zone = 0;
+		ChangeAssignedZone(0);
 
 	ListIter<CombatGroup> iter = components;
 	while (++iter) {
@@ -832,6 +1249,34 @@ CombatGroup::ClearUnlockedZones()
 	}
 }
 
+void
+CombatGroup::ChangeAssignedZone(CombatZone* z)
+{
+	if (z == assigned_zone)
+		return;
+
+	// keep the zone's per-force list of assigned groups in step:
+	if (assigned_zone)
+		assigned_zone->FindForce(iff)->RemoveAssigned(this);
+
+	assigned_zone = z;
+
+	if (assigned_zone)
+		assigned_zone->FindForce(iff)->AddAssigned(this);
+}
+
+void
+CombatGroup::DropZone(CombatZone* z)
+{
+	if (assigned_zone == z) {
+		assigned_zone = 0;
+		zone_lock = false;
+	}
+
+	if (current_zone == z)
+		current_zone = 0;
+}
+
 void
 CombatGroup::SetZoneLock(bool lock)
 {
@@ -873,6 +1318,36 @@ CombatGroup::SetIntelLevel(int n)
 			p = p->parent;
 		}
 	}
+
+	// reserve status is inherited, so a change of intel anywhere
+	// in the chain can alter the live counts of the whole tree:
+	CombatGroup* root = this;
+	while (root->parent)
+		root = root->parent;
+
+	root->InvalidateCounts();
+}
+
+// +--------------------------------------------------------------------+
+
+void
+CombatGroup::Invalidate()
+{
+	// the OOB tree is only a few levels deep:
+	for (CombatGroup* g = this; g; g = g->parent) {
+		g->value_dirty = true;
+		g->count_dirty = true;
+	}
+}
+
+void
+CombatGroup::InvalidateCounts()
+{
+	count_dirty = true;
+
+	ListIter<CombatGroup> iter = components;
+	while (++iter)
+		iter->InvalidateCounts();
 }
 
 // +--------------------------------------------------------------------+
@@ -880,6 +1355,9 @@ CombatGroup::SetIntelLevel(int n)
 int
 CombatGroup::CalcValue()
 {
+	if (!value_dirty)
+		return value;
+
 	int val = 0;
 
 	ListIter<CombatUnit> unit = units;
@@ -890,13 +1368,17 @@ CombatGroup::CalcValue()
 	while (++comp)
 		val += comp->CalcValue();
 
-	value = val;
+	value       = val;
+	value_dirty = false;
 	return value;
 }
 
 int
 CombatGroup::CountUnits() const
 {
+	if (!count_dirty)
+		return unit_count;
+
 	int n = 0;
 
 	CombatGroup* g = (CombatGroup*)this;
@@ -912,14 +1394,16 @@ CombatGroup::CountUnits() const
 		CombatGroup* comp = iter.value();
 
 		if (!comp->IsReserve()) {
-			int unit_count = comp->CountUnits();
-			if (unit_count > 0)
+			int comp_units = comp->CountUnits();
+			if (comp_units > 0)
 				pThis->live_comp.append(comp);
 
-			n += unit_count;
+			n += comp_units;
 		}
 	}
 
+	pThis->unit_count  = n;
+	pThis->count_dirty = false;
 	return n;
 }
 
@@ -969,7 +1453,7 @@ CombatGroup::GetRandomUnit()
 	if (live.size() > 0) {
 		int ntries = 5;
 		while (!result && ntries-- > 0) {
-			int index = rand() % live.size();
+			int index = RandomInt() % live.size();
 			result = live[index];
 
 			int ship_class = result->GetShipClass();
@@ -1029,6 +1513,17 @@ CombatGroup::GetNextUnit()
 CombatUnit*
 CombatGroup::FindUnit(const char* unitname)
 {
+	CombatUnit* indexed = GetIndex()->FindUnit(unitname);
+
+	if (indexed && indexed->GetCombatGroup() == this && indexed->Name() == unitname) {
+		if (indexed->Count() - indexed->DeadCount() > 0)
+			return indexed;
+		else
+			return 0;
+	}
+
+	// units not yet handed to a group, or sharing a name
+	// with a unit elsewhere in the tree:
 	if (units.size() > 0) {
 		ListIter<CombatUnit> iter = units;
 		while (++iter) {
@@ -1138,7 +1633,7 @@ CombatGroup::NameFromType(int type)
 #define GET_DEF_VEC(n)  if (pdef->name()->value()==(#n)) GetDefVec((n),    pdef, filename)
 
 /*CombatGroup*
-CombatGroup::LoadOrderOfBattle(const char* filename, int team, Combatant* combatant)
+CombatGroup::LoadOrderOfBattle(const char* filename, int team, Combatant* owner)
 {
 	CombatGroup* force = 0;
 	DataLoader* loader = DataLoader::GetLoader();
@@ -29,6 +29,7 @@ class CombatGroup;
 class CombatUnit;
 class CombatZone;
 class CombatAssignment;
+class CombatGroupIndex;
 
 // +--------------------------------------------------------------------+
 
@@ -180,6 +181,9 @@ public:
 	void           ClearUnlockedZones();
 	bool           IsZoneLocked()   const { return assigned_zone && zone_lock; }
 	void           SetZoneLock(bool lock = true);
+
+	// called by a zone that is going away:
+	void           DropZone(CombatZone* z);
 	bool           IsSystemLocked()              const { return assigned_system.length() > 0; }
 
 	const Text& GetStrategicDirection()       const { return strategic_direction; }
@@ -188,6 +192,16 @@ public:
 	void           SetIntelLevel(int n);
 	int            CalcValue();
 
+	// CalcValue and CountUnits keep their results until something
+	// below this group changes.  Anything that kills, adds or moves
+	// units must call Invalidate on the group that owns them, which
+	// marks it and every group above it for a recount:
+	void           Invalidate();
+
+	// the lookup tables of the whole tree, built on first use
+	// unless build is false:
+	CombatGroupIndex* GetIndex(bool build = true);
+
 	List<CombatAssignment>& GetAssignments() { return assignments; }
 	void                    ClearAssignments();
 
@@ -196,6 +210,10 @@ public:
 
 private:
 	const char* GetOrdinal()               const;
+	void           InvalidateCounts();
+	CombatGroup*   GetRoot();
+	void           ChangeAssignedZone(CombatZone* z);
+	bool           Contains(const CombatGroup* g) const;
 
 	// attributes:
 	int                  type;
@@ -215,6 +233,10 @@ private:
 	Point                location;
 	int                  value;
 	int                  unit_index;
+	int                  unit_count;
+	bool                 value_dirty;
+	bool                 count_dirty;
+	CombatGroupIndex*    group_index;   // root only
 
 	int                  sorties;
 	int                  kills;
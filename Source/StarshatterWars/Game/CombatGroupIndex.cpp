@@ -0,0 +1,219 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Game
+	FILE:         CombatGroupIndex.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Lookup tables for one order of battle
+*/
+
+
+#include "CombatGroupIndex.h"
+#include "CombatGroup.h"
+#include "CombatUnit.h"
+
+#include <stdio.h>
+
+// +--------------------------------------------------------------------+
+
+CombatGroupIndex::CombatGroupIndex()
+{ }
+
+CombatGroupIndex::~CombatGroupIndex()
+{ }
+
+// +--------------------------------------------------------------------+
+
+void
+CombatGroupIndex::GroupKey(char* key, int type, int id)
+{
+	sprintf_s(key, 32, "%d:%d", type, id);
+}
+
+// +--------------------------------------------------------------------+
+
+void
+CombatGroupIndex::AddBranch(CombatGroup* g)
+{
+	if (!g)
+		return;
+
+	char key[32];
+	GroupKey(key, g->Type(), g->GetID());
+
+	if (group_count[key]++ == 0)
+		groups.Insert(key, g);
+
+	ListIter<CombatUnit> unit = g->GetUnits();
+	while (++unit)
+		AddUnit(unit.value());
+
+	ListIter<CombatGroup> comp = g->GetComponents();
+	while (++comp)
+		AddBranch(comp.value());
+}
+
+void
+CombatGroupIndex::RemoveBranch(CombatGroup* g)
+{
+	if (!g)
+		return;
+
+	List<Text> lost_groups;
+	List<Text> lost_units;
+
+	DropBranch(g, lost_groups, lost_units);
+
+	// keys whose holder went with the branch but that are still
+	// held elsewhere in the tree:
+	if (lost_groups.size() || lost_units.size())
+		Refill(g->GetRoot(), g, 0, lost_groups, lost_units);
+
+	lost_groups.destroy();
+	lost_units.destroy();
+}
+
+void
+CombatGroupIndex::DropBranch(CombatGroup* g, List<Text>& lost_groups, List<Text>& lost_units)
+{
+	char key[32];
+	GroupKey(key, g->Type(), g->GetID());
+
+	int remaining = --group_count[key];
+
+	if (remaining < 1)
+		group_count.Remove(key);
+
+	if (groups.Find(key, (CombatGroup*) 0) == g) {
+		groups.Remove(key);
+
+		if (remaining > 0)
+			lost_groups.append(new Text(key));
+	}
+
+	ListIter<CombatUnit> unit = g->GetUnits();
+	while (++unit) {
+		if (DropUnit(unit.value()))
+			lost_units.append(new Text(unit->Name()));
+	}
+
+	ListIter<CombatGroup> comp = g->GetComponents();
+	while (++comp)
+		DropBranch(comp.value(), lost_groups, lost_units);
+}
+
+// +--------------------------------------------------------------------+
+
+void
+CombatGroupIndex::AddUnit(CombatUnit* u)
+{
+	if (u && u->Name().length() && unit_count[u->Name()]++ == 0)
+		units.Insert(u->Name(), u);
+}
+
+void
+CombatGroupIndex::RemoveUnit(CombatUnit* u)
+{
+	if (!u || !DropUnit(u))
+		return;
+
+	CombatGroup* g = u->GetCombatGroup();
+
+	if (g) {
+		List<Text> lost_groups;
+		List<Text> lost_units;
+
+		lost_units.append(new Text(u->Name()));
+		Refill(g->GetRoot(), 0, u, lost_groups, lost_units);
+		lost_units.destroy();
+	}
+}
+
+// drops one holder of the unit's name, and returns true if the unit
+// was the one indexed while the name is still held elsewhere:
+
+bool
+CombatGroupIndex::DropUnit(CombatUnit* u)
+{
+	if (!u || !u->Name().length() || !unit_count.Contains(u->Name()))
+		return false;
+
+	int remaining = --unit_count[u->Name()];
+
+	if (remaining < 1)
+		unit_count.Remove(u->Name());
+
+	if (units.Find(u->Name(), (CombatUnit*) 0) != u)
+		return false;
+
+	units.Remove(u->Name());
+	return remaining > 0;
+}
+
+// +--------------------------------------------------------------------+
+
+void
+CombatGroupIndex::Refill(CombatGroup* g, CombatGroup* skip_group, CombatUnit* skip_unit,
+                         List<Text>& lost_groups, List<Text>& lost_units)
+{
+	// depth first, like the search the index stands in for:
+	if (!g || g == skip_group)
+		return;
+
+	if (lost_groups.size()) {
+		char key[32];
+		GroupKey(key, g->Type(), g->GetID());
+
+		for (int i = 0; i < lost_groups.size(); i++) {
+			if (*lost_groups[i] == key) {
+				groups.Insert(key, g);
+				delete lost_groups.removeIndex(i);
+				break;
+			}
+		}
+	}
+
+	if (lost_units.size()) {
+		ListIter<CombatUnit> unit = g->GetUnits();
+		while (++unit) {
+			if (unit.value() == skip_unit)
+				continue;
+
+			for (int i = 0; i < lost_units.size(); i++) {
+				if (*lost_units[i] == unit->Name()) {
+					units.Insert(unit->Name(), unit.value());
+					delete lost_units.removeIndex(i);
+					break;
+				}
+			}
+		}
+	}
+
+	ListIter<CombatGroup> comp = g->GetComponents();
+	while (++comp && (lost_groups.size() || lost_units.size()))
+		Refill(comp.value(), skip_group, skip_unit, lost_groups, lost_units);
+}
+
+// +--------------------------------------------------------------------+
+
+CombatGroup*
+CombatGroupIndex::FindGroup(int type, int id) const
+{
+	char key[32];
+	GroupKey(key, type, id);
+
+	return groups.Find(key, (CombatGroup*) 0);
+}
+
+CombatUnit*
+CombatGroupIndex::FindUnit(const char* name) const
+{
+	if (!name || !*name)
+		return 0;
+
+	return units.Find(name, (CombatUnit*) 0);
+}
@@ -0,0 +1,73 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Game
+	FILE:         CombatGroupIndex.h
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Lookup tables for one order of battle.  The root group of a force
+	builds an index the first time it is searched, and the tree keeps
+	it current from then on: groups are entered as they are attached
+	and dropped as they are destroyed, units as they change hands.
+
+	Groups are keyed by type and id, units by name.  When a key occurs
+	more than once, the index holds the first one entered, which for a
+	tree entered top down is the one a depth-first search finds first.
+	The index counts how many holders each key has, and when the one it
+	holds is dropped while others remain, the tree is searched once for
+	the next holder, so a lookup never misses a group or unit that is
+	still in the tree.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../Foundation/Types.h"
+#include "../Foundation/Dictionary.h"
+#include "../Foundation/List.h"
+#include "../Foundation/Text.h"
+
+// +--------------------------------------------------------------------+
+
+class CombatGroup;
+class CombatUnit;
+
+// +--------------------------------------------------------------------+
+
+class STARSHATTERWARS_API CombatGroupIndex
+{
+public:
+	static const char* TYPENAME() { return "CombatGroupIndex"; }
+
+	CombatGroupIndex();
+	~CombatGroupIndex();
+
+	// enter or drop a group together with its components and units:
+	void           AddBranch(CombatGroup* g);
+	void           RemoveBranch(CombatGroup* g);
+
+	void           AddUnit(CombatUnit* u);
+	void           RemoveUnit(CombatUnit* u);
+
+	CombatGroup*   FindGroup(int type, int id) const;
+	CombatUnit*    FindUnit(const char* name) const;
+
+	int            NumGroups() const { return groups.Size(); }
+	int            NumUnits()  const { return units.Size(); }
+
+private:
+	static void    GroupKey(char* key, int type, int id);
+
+	void           DropBranch(CombatGroup* g, List<Text>& lost_groups, List<Text>& lost_units);
+	bool           DropUnit(CombatUnit* u);
+	void           Refill(CombatGroup* g, CombatGroup* skip_group, CombatUnit* skip_unit,
+	                      List<Text>& lost_groups, List<Text>& lost_units);
+
+	Dictionary<CombatGroup*>   groups;
+	Dictionary<CombatUnit*>    units;
+	Dictionary<int>            group_count;   // holders of each key in the tree
+	Dictionary<int>            unit_count;
+};
@@ -4,11 +4,13 @@
 #include "CombatUnit.h"
 #include "CombatUnit.h"
 #include "CombatGroup.h"
+#include "CombatGroupIndex.h"
 #include "Campaign.h"
 #include "ShipDesign.h"
 #include "Ship.h"
 
 #include "../System/Game.h"
+#include "../Foundation/Random.h"
 
 CombatUnit::CombatUnit()
 {
@@ -20,7 +22,7 @@ CombatUnit::~CombatUnit()
 
 // +----------------------------------------------------------------------+
 
-inline double random() { return (double)rand() / (double)RAND_MAX; }
+inline double random() { return (double)RandomInt() / 32767.0; }
 
 // +----------------------------------------------------------------------+
 
@@ -52,6 +54,38 @@ CombatUnit::GetDesign()
 	return design;
 }
 
+void
+CombatUnit::SetDeadCount(int n)
+{
+	dead_count = n;
+
+	if (group)
+		group->Invalidate();
+}
+
+void
+CombatUnit::SetCombatGroup(CombatGroup* g)
+{
+	// a transfer changes the totals of both branches:
+	if (group) {
+		group->Invalidate();
+
+		CombatGroupIndex* index = group->GetIndex(false);
+		if (index) index->RemoveUnit(this);
+	}
+
+	group = g;
+
+	if (group) {
+		group->Invalidate();
+
+		CombatGroupIndex* index = group->GetIndex(false);
+		if (index) index->AddUnit(this);
+	}
+}
+
+// +----------------------------------------------------------------------+
+
 int
 CombatUnit::GetShipClass() const
 {
@@ -70,8 +104,7 @@ CombatUnit::GetValue() const
 int
 CombatUnit::GetSingleValue() const
 {
-	//return Ship::Value(GetShipClass());
-	return 0;
+	return UShip::Value(GetShipClass());
 }
 
 // +----------------------------------------------------------------------+
@@ -363,6 +396,9 @@ CombatUnit::Kill(int n)
 
 	dead_count += killed;
 
+	if (killed && group)
+		group->Invalidate();
+
 	int value_killed = killed * GetSingleValue();
 
 	if (killed) {
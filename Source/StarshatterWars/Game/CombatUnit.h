@@ -71,7 +71,7 @@ public:
 	int            Count()                       const { return count; }
 	int            LiveCount()                   const { return count - dead_count; }
 	int            DeadCount()                   const { return dead_count; }
-	void           SetDeadCount(int n) { dead_count = n; }
+	void           SetDeadCount(int n);
 	int            Kill(int n);
 	int            Available()                   const { return available; }
 	int            GetIFF()                      const { return iff; }
@@ -82,7 +82,7 @@ public:
 	Text           GetRegion()                   const { return region; }
 	void           SetRegion(Text rgn) { region = rgn; }
 	CombatGroup* GetCombatGroup()        const { return group; }
-	void           SetCombatGroup(CombatGroup* g) { group = g; }
+	void           SetCombatGroup(CombatGroup* g);
 
 	Color          MarkerColor()                 const;
 	bool           IsGroundUnit()                const;
@@ -28,14 +28,18 @@
 #include "../Foundation/DataLoader.h"
 #include "../Foundation/ParseUtil.h"
 
+int CombatZone::generation = 0;
+
 CombatZone::CombatZone()
 {
 }
 
 CombatZone::~CombatZone()
 {
+	DetachGroups();
 	regions.destroy();
 	forces.destroy();
+	generation++;
 }
 
 // +--------------------------------------------------------------------+
@@ -43,7 +47,26 @@ CombatZone::~CombatZone()
 void
 CombatZone::Clear()
 {
+	DetachGroups();
 	forces.destroy();
+	generation++;
+}
+
+void
+CombatZone::DetachGroups()
+{
+	// groups outlive the zones of an unloaded campaign, so they
+	// must not be left pointing at them:
+	ListIter<ZoneForce> f = forces;
+	while (++f) {
+		ListIter<CombatGroup> g = f->GetGroups();
+		while (++g)
+			g->DropZone(this);
+
+		g.attach(f->GetAssignedGroups());
+		while (++g)
+			g->DropZone(this);
+	}
 }
 
 // +--------------------------------------------------------------------+
@@ -73,13 +96,9 @@ CombatZone::RemoveGroup(CombatGroup* group)
 bool
 CombatZone::HasGroup(CombatGroup* group)
 {
-	if (group) {
-		int iff = group->GetIFF();
-		ZoneForce* f = FindForce(iff);
-		return f->HasGroup(group);
-	}
-
-	return false;
+	// AddGroup and RemoveGroup keep the current zone of
+	// each group in step with the force lists:
+	return group && group->GetCurrentZone() == this;
 }
 
 // +--------------------------------------------------------------------+
@@ -89,6 +108,7 @@ CombatZone::AddRegion(const char* rgn)
 {
 	if (rgn && *rgn) {
 		regions.append(new Text(rgn));
+		generation++;
 
 		if (name.length() < 1)
 			name = rgn;
@@ -100,9 +120,10 @@ CombatZone::AddRegion(const char* rgn)
 bool
 CombatZone::HasRegion(const char* rgn)
 {
-	if (rgn && *rgn && regions.size()) {
-		Text test(rgn);
-		return regions.contains(&test);
+	if (rgn && *rgn) {
+		for (int i = 0; i < regions.size(); i++)
+			if (*regions[i] == rgn)
+				return true;
 	}
 
 	return false;
@@ -63,10 +63,18 @@ public:
 	static List<CombatZone>&
 		Load(const char* filename);
 
+	// bumped whenever any zone gains a region, is cleared or is
+	// destroyed, so an index over zone regions knows to rebuild:
+	static int           Generation() { return generation; }
+
 private:
+	void                 DetachGroups();
+
 	// attributes:
 	Text                 name;
 	Text                 system;
 	List<Text>           regions;
 	List<ZoneForce>      forces;
+
+	static int           generation;
 };
@@ -15,6 +15,7 @@
 
 #include "Combatant.h"
 #include "CombatGroup.h"
+#include "CombatAssignment.h"
 #include "Mission.h"
 
 #include "../System/Game.h"
@@ -35,7 +36,8 @@ static void SetCombatant(CombatGroup* g, Combatant* c)
 // +--------------------------------------------------------------------+
 
 Combatant::Combatant(const char* com_name, const char* fname, int team)
-	: name(com_name), iff(team), score(0), force(0)
+	: name(com_name), iff(team), score(0), force(0),
+	assignment_pool(sizeof(CombatAssignment))
 {
 	for (int i = 0; i < 6; i++)
 		target_factor[i] = 1;
@@ -47,7 +49,8 @@ Combatant::Combatant(const char* com_name, const char* fname, int team)
 }
 
 Combatant::Combatant(const char* com_name, CombatGroup* f)
-	: name(com_name), iff(0), score(0), force(f)
+	: name(com_name), iff(0), score(0), force(f),
+	assignment_pool(sizeof(CombatAssignment))
 {
 	for (int i = 0; i < 6; i++)
 		target_factor[i] = 1;
@@ -67,6 +70,7 @@ Combatant::~Combatant()
 	mission_list.clear();
 	target_list.clear();
 	defend_list.clear();
+	event_candidates.clear();
 	delete force;
 }
 
@@ -19,6 +19,8 @@
 #include "../Foundation/Geometry.h"
 #include "../Foundation/Text.h"
 #include "../Foundation/List.h"
+#include "../Foundation/ObjectPool.h"
+#include "../Foundation/WeightedSampler.h"
 #include "../System/SSWGameInstance.h"
 
 // +--------------------------------------------------------------------+
@@ -27,6 +29,7 @@ class UCampaign;
 class CombatGroup;
 class CombatUnit;
 class Mission;
+class CombatAssignment;
 
 // +--------------------------------------------------------------------+
 
@@ -55,6 +58,12 @@ public:
 	List<CombatGroup>& GetTargetList() { return target_list; }
 	List<CombatGroup>& GetDefendList() { return defend_list; }
 	List<Mission>& GetMissionList() { return mission_list; }
+	ObjectPool& GetAssignmentPool() { return assignment_pool; }
+
+	// assignments eligible for statistical events, weighted by the
+	// value at stake.  rebuilt with the assignments on every pass:
+	List<CombatAssignment>& GetEventCandidates() { return event_candidates; }
+	WeightedSampler&        GetEventWeights() { return event_weights; }
 
 	void                    AddMission(Mission* m);
 	void                    SetScore(int points) { score = points; }
@@ -72,7 +81,13 @@ private:
 	List<CombatGroup>       target_list;
 	List<CombatGroup>       defend_list;
 	List<Mission>           mission_list;
+	List<CombatAssignment>  event_candidates;
+	WeightedSampler         event_weights;
 
 	double                  target_factor[8];
 
+	// the force and its assignments are deleted in the destructor
+	// body, before any member is destroyed, so the pool outlives them:
+	ObjectPool              assignment_pool;
+
 };
@@ -69,6 +69,18 @@ AGameDataLoader::AGameDataLoader()
 	PrimaryActorTick.bCanEverTick = true;
 	UE_LOG(LogTemp, Log, TEXT("AGameDataLoader::AGameDataLoader()"));
 
+	VerboseContentDump = FParse::Param(FCommandLine::Get(), TEXT("SSWDumpContent"));
+
+	LoadThreads = 0;
+	FParse::Value(FCommandLine::Get(), TEXT("SSWLoadThreads="), LoadThreads);
+	LoadPool.SetThreads(LoadThreads);
+
+	if (!FParse::Param(FCommandLine::Get(), TEXT("SSWNoContentCache"))) {
+		FString CachePath = FPaths::ProjectSavedDir();
+		CachePath.Append(TEXT("ContentCache/"));
+		ContentCache.SetDirectory(TCHAR_TO_ANSI(*CachePath));
+	}
+
 	static ConstructorHelpers::FObjectFinder<UDataTable> CampaignDataTableObject(TEXT("DataTable'/Game/Game/DT_Campaign.DT_Campaign'"));
 
 	if (CampaignDataTableObject.Succeeded())
@@ -183,6 +195,10 @@ void AGameDataLoader::BeginPlay()
 {
 	Super::BeginPlay();
 	GetSSWInstance();
+
+	if (ContentCache.IsEnabled())
+		IFileManager::Get().MakeDirectory(ANSI_TO_TCHAR(ContentCache.GetDirectory()), true);
+
 	LoadContentBundle();
 	LoadForms();
 	LoadGalaxyMap();
@@ -237,22 +253,13 @@ void AGameDataLoader::LoadCampaignData(const char* FileName, bool full)
 	SSWInstance->loader->SetDataPath(FileName);
 
 	FString fs = FString(ANSI_TO_TCHAR(FileName));
-	FString FileString;
-	BYTE* block = 0;
+	ParsedFile content;
 
-	SSWInstance->loader->LoadBuffer(FileName, block, true);
+	LoadParsedFile(FileName, content);
 
 	UE_LOG(LogTemp, Log, TEXT("Loading Campaign Data: %s"), *fs);
 
-	if (FFileHelper::LoadFileToString(FileString, *fs, FFileHelper::EHashOptions::None))
-	{
-		UE_LOG(LogTemp, Log, TEXT("%s"), *FileString);
-
-		const char* result = TCHAR_TO_ANSI(*FileString);
-	}
-
-	Parser parser(new BlockReader((const char*)block));
-	Term* term = parser.ParseTerm();
+	Term* term = content.ParseTerm();
 
 	if (!term) {
 		UE_LOG(LogTemp, Log, TEXT("WARNING: could not parse '%s'"), *fs);
@@ -274,53 +281,54 @@ void AGameDataLoader::LoadCampaignData(const char* FileName, bool full)
 
 	do {
 		delete term; 
-		term = parser.ParseTerm();
+		term = content.ParseTerm();
 
 		if (term) {
 			TermDef* def = term->isDef();
 			if (def) {
 
-				if (def->name()->value() == "name") {
+				switch (def->name()->symbol()) {
+				case SYM_NAME:
 						GetDefText(name, def, filename);
 						NewCampaignData.Name = FString(name);
-				}
-				else if (def->name()->value() == "desc") {
+						break;
+				case SYM_DESC:
 						GetDefText(description, def, filename);
 						NewCampaignData.Description = FString(description);
-				}
-				else if (def->name()->value() == "situation") {
+						break;
+				case SYM_SITUATION:
 						GetDefText(situation, def, filename);
 						NewCampaignData.Situation = FString(situation);
-				}
-				else if (def->name()->value() == "orders") {
+						break;
+				case SYM_ORDERS:
 						GetDefText(orders, def, filename);
 						OrdersArray.Add(FString(orders));
 						NewCampaignData.Orders = OrdersArray;
-				}
-				else if (def->name()->value() == "scripted") {
+						break;
+				case SYM_SCRIPTED:
 					if (def->term() && def->term()->isBool()) {
 						scripted = def->term()->isBool()->value();
 						NewCampaignData.Scripted = scripted;
 					}
-				}
-				else if (def->name()->value() == "sequential") {
+					break;
+				case SYM_SEQUENTIAL:
 					if (def->term() && def->term()->isBool()) {
 						sequential = def->term()->isBool()->value();
 						NewCampaignData.Sequential = sequential;
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "combatant_groups") {
+				case SYM_COMBATANT_GROUPS:
 					GetDefNumber(CombatantSize, def, filename);
 					NewCampaignData.CombatantSize = CombatantSize;
-				}
+					break;
 	
-				else if (def->name()->value() == "action_groups") {
+				case SYM_ACTION_GROUPS:
 					GetDefNumber(ActionSize, def, filename);
 					NewCampaignData.ActionSize = ActionSize;
-				}
+					break;
 
-				else if (def->name()->value() == "action") {
+				case SYM_ACTION: {
 					
 					TermStruct* ActionTerm = def->term()->isStruct();
 
@@ -364,18 +372,19 @@ void AGameDataLoader::LoadCampaignData(const char* FileName, bool full)
 						{
 							TermDef* pdef = ActionTerm->elements()->at(ActionIdx)->isDef();
 
-							if (pdef->name()->value() == "id") {
+							switch (pdef->name()->symbol()) {
+							case SYM_ID:
 								GetDefNumber(ActionId, pdef, filename);
 								NewCampaignAction.Id = ActionId;
 								UE_LOG(LogTemp, Log, TEXT("action id: '%d'"), ActionId);
-							}
-							else if (pdef->name()->value() == "type") {
+								break;
+							case SYM_TYPE:
 								GetDefText(ActionType, pdef, filename);
 								//type = CombatAction::TypeFromName(txt);
 								NewCampaignAction.Type = FString(ActionType);
 								UE_LOG(LogTemp, Log, TEXT("action type: '%s'"), *FString(ActionType));
-							}
-							else if (pdef->name()->value() == "subtype") {
+								break;
+							case SYM_SUBTYPE:
 								if (pdef->term()->isNumber()) {
 									GetDefNumber(ActionSubtype, pdef, filename);
 									NewCampaignAction.Subtype = ActionSubtype;
@@ -396,8 +405,8 @@ void AGameDataLoader::LoadCampaignData(const char* FileName, bool full)
 									NewCampaignAction.Subtype = ActionSubtype;
 								}
 
-							}
-							else if (pdef->name()->value() == "opp_type") {
+								break;
+							case SYM_OPP_TYPE:
 								if (pdef->term()->isNumber()) {
 									GetDefNumber(OppType, pdef, filename);
 									NewCampaignAction.OppType = OppType;
@@ -410,47 +419,25 @@ void AGameDataLoader::LoadCampaignData(const char* FileName, bool full)
 										opp_type = Mission::TypeFromName(txt);
 									}
 								}*/
-							}
-							else if (pdef->name()->value() == "source") {
+								break;
+							case SYM_SOURCE:
 								GetDefText(ActionSource, pdef, filename);
 								//source = CombatEvent::SourceFromName(txt);
 								NewCampaignAction.Source = FString(ActionSource);
-							}
-							else if (pdef->name()->value() == "team") {
+								break;
+							case SYM_TEAM:
 								GetDefNumber(ActionTeam, pdef, filename);
 								NewCampaignAction.Team = ActionTeam;
-							}
-							else if (pdef->name()->value() == "iff") {
+								break;
+							case SYM_IFF:
 								GetDefNumber(ActionTeam, pdef, filename);
 								NewCampaignAction.Iff = ActionTeam;
-							}
-							else if (pdef->name()->value() == "count") {
+								break;
+							case SYM_COUNT:
 								GetDefNumber(ActionCount, pdef, filename);
 								NewCampaignAction.Count = ActionCount;
-							}
-							else if (pdef->name()->value().contains("before")) {
-								if (pdef->term()->isNumber()) {
-									GetDefNumber(StartBefore, pdef, filename);
-									NewCampaignAction.StartBefore = StartBefore;
-								}
-								else {
-									GetDefTime(StartBefore, pdef, filename);
-									StartBefore -= Game::ONE_DAY;
-									NewCampaignAction.StartBefore = StartBefore;
-								}
-							}
-							else if (pdef->name()->value().contains("after")) {
-								if (pdef->term()->isNumber()) {
-									GetDefNumber(StartAfter, pdef, filename);
-									NewCampaignAction.StartAfter = StartAfter;
-								}
-								else {
-									GetDefTime(StartAfter, pdef, filename);
-									StartAfter -= Game::ONE_DAY;
-									NewCampaignAction.StartAfter = StartAfter;
-								}
-							}
-							else if (pdef->name()->value() == "min_rank") {
+								break;
+							case SYM_MIN_RANK:
 								if (pdef->term()->isNumber()) {
 									GetDefNumber(MinRank, pdef, filename);
 									NewCampaignAction.MinRank = MinRank;
@@ -461,8 +448,8 @@ void AGameDataLoader::LoadCampaignData(const char* FileName, bool full)
 									MinRank = PlayerData::RankFromName(rank_name);
 									NewCampaignAction.MinRank = MinRank;
 								}
-							}
-							else if (pdef->name()->value() == "max_rank") {
+								break;
+							case SYM_MAX_RANK:
 								if (pdef->term()->isNumber()) {
 									GetDefNumber(MaxRank, pdef, filename);
 									NewCampaignAction.MaxRank = MaxRank;
@@ -473,83 +460,83 @@ void AGameDataLoader::LoadCampaignData(const char* FileName, bool full)
 									MaxRank = PlayerData::RankFromName(rank_name);
 									NewCampaignAction.MaxRank = MaxRank;
 								}
-							}
-							else if (pdef->name()->value() == "delay") {
+								break;
+							case SYM_DELAY:
 								GetDefNumber(Delay, pdef, filename);
 								NewCampaignAction.Delay = Delay;
-							}
-							else if (pdef->name()->value() == "probability") {
+								break;
+							case SYM_PROBABILITY:
 								GetDefNumber(Probability, pdef, filename);
 								NewCampaignAction.Probability = Probability;
-							}
-							else if (pdef->name()->value() == "asset_type") {
+								break;
+							case SYM_ASSET_TYPE:
 								GetDefText(AssetType, pdef, filename);
 								//asset_type = CombatGroup::TypeFromName(type_name);
 								NewCampaignAction.AssetType = FString(AssetType);
-							}
-							else if (pdef->name()->value() == "target_type") {
+								break;
+							case SYM_TARGET_TYPE:
 								GetDefText(TargetType, pdef, filename);
 								NewCampaignAction.TargetType = FString(TargetType);
 								//target_type = CombatGroup::TypeFromName(type_name);
-							}
-							else if (pdef->name()->value() == "location" ||
-								pdef->name()->value() == "loc") {
+								break;
+							case SYM_LOCATION:
+							case SYM_LOC:
 								GetDefVec(ActionLocation, pdef, filename);
 								NewCampaignAction.Location.X = ActionLocation.x;
 								NewCampaignAction.Location.Y = ActionLocation.y;
 								NewCampaignAction.Location.Z = ActionLocation.z;
 
-							}
-							else if (pdef->name()->value() == "system" ||
-								pdef->name()->value() == "sys") {
+								break;
+							case SYM_SYSTEM:
+							case SYM_SYS:
 								GetDefText(ActionSystem, pdef, filename);
 								NewCampaignAction.System = FString(ActionSystem);
-							}
-							else if (pdef->name()->value() == "region" ||
-								pdef->name()->value() == "rgn" ||
-								pdef->name()->value() == "zone") {
+								break;
+							case SYM_REGION:
+							case SYM_RGN:
+							case SYM_ZONE:
 								GetDefText(ActionRegion, pdef, filename);
 								NewCampaignAction.Region = FString(ActionRegion);
-							}
-							else if (pdef->name()->value() == "file") {
+								break;
+							case SYM_FILE:
 								GetDefText(ActionFile, pdef, filename);
 								NewCampaignAction.File = FString(ActionFile);
-							}
-							else if (pdef->name()->value() == "image") {
+								break;
+							case SYM_IMAGE:
 								GetDefText(ActionImage, pdef, filename);
 								NewCampaignAction.Image = FString(ActionImage);
-							}
-							else if (pdef->name()->value() == "scene") {
+								break;
+							case SYM_SCENE:
 								GetDefText(ActionScene, pdef, filename);
 								NewCampaignAction.Scene = FString(ActionScene);
-							}
-							else if (pdef->name()->value() == "text") {
+								break;
+							case SYM_TEXT:
 								GetDefText(ActionText, pdef, filename);
 								NewCampaignAction.Text = FString(ActionText);
-							}
-							else if (pdef->name()->value() == "asset_id") {
+								break;
+							case SYM_ASSET_ID:
 								GetDefNumber(AssetId, pdef, filename);
 								NewCampaignAction.AssetId = AssetId;
-							}
-							else if (pdef->name()->value() == "target_id") {
+								break;
+							case SYM_TARGET_ID:
 								GetDefNumber(TargetId, pdef, filename);
 								NewCampaignAction.TargetId = TargetId;
-							}
+								break;
 
-							else if (pdef->name()->value() == "target_iff") {
+							case SYM_TARGET_IFF:
 								GetDefNumber(TargetIff, pdef, filename);
 								NewCampaignAction.TargetIff = TargetIff;
-							}
-							else if (pdef->name()->value() == "asset_kill") {
+								break;
+							case SYM_ASSET_KILL:
 								GetDefText(AssetKill, pdef, filename);
 								NewCampaignAction.AssetKill = FString(AssetKill);
-							}
+								break;
 
-							else if (pdef->name()->value() == "target_kill") {
+							case SYM_TARGET_KILL:
 								GetDefText(TargetKill, pdef, filename);
 								NewCampaignAction.TargetKill = FString(TargetKill);
-							}
-							else if (pdef->name()->value() == "req") {
+								break;
+							case SYM_REQ: {
 								TermStruct* val2 = pdef->term()->isStruct();
 								CampaignActionReqArray.Empty();
 								Action = 0;
@@ -571,45 +558,48 @@ void AGameDataLoader::LoadCampaignData(const char* FileName, bool full)
 									TermDef* pdef2 = val2->elements()->at(index)->isDef();
 									
 									if (pdef2) {
-										if (pdef2->name()->value() == "action") {
+										switch (pdef2->name()->symbol()) {
+										case SYM_ACTION:
 											GetDefNumber(Action, pdef2, filename);
 											NewCampaignReq.Action = Action;
-										}
-										else if (pdef2->name()->value() == "status") {
+											break;
+										case SYM_STATUS: {
 											char txt[64];
 											GetDefText(txt, pdef2, filename);
 											ActionStatus = CombatAction::StatusFromName(txt);
 											NewCampaignReq.Status = FString(ActionStatus);
 
+											break;
 										}
-										else if (pdef2->name()->value() == "not") {
+										case SYM_NOT:
 											GetDefBool(NotAction, pdef2, filename);
 											NewCampaignReq.NotAction = NotAction;
-										}
+											break;
 
-										else if (pdef2->name()->value() == "c1") {
+										case SYM_C1:
 											GetDefText(Combatant1, pdef2, filename);
 											NewCampaignReq.Combatant1 = FString(Combatant1);
 											//c1 = GetCombatant(txt);
-										}
-										else if (pdef2->name()->value() == "c2") {
+											break;
+										case SYM_C2:
 											GetDefText(Combatant2, pdef2, filename);
 											NewCampaignReq.Combatant2 = FString(Combatant2);
 											//c2 = GetCombatant(txt);
-										}
-										else if (pdef2->name()->value() == "comp") {
+											break;
+										case SYM_COMP: {
 											char txt[64];
 											GetDefText(txt, pdef2, filename);
 											comp = CombatActionReq::CompFromName(txt);
 											NewCampaignReq.Comp = comp;
 
+											break;
 										}
-										else if (pdef2->name()->value() == "score") {
+										case SYM_SCORE:
 											GetDefNumber(score, pdef2, filename);
 											NewCampaignReq.Score = score;
 
-										}
-										else if (pdef2->name()->value() == "intel") {
+											break;
+										case SYM_INTEL:
 											if (pdef2->term()->isNumber()) {
 												GetDefNumber(intel, pdef2, filename);
 												NewCampaignReq.Intel = intel;
@@ -622,21 +612,49 @@ void AGameDataLoader::LoadCampaignData(const char* FileName, bool full)
 												NewCampaignReq.Intel = intel;
 
 											}
-										}
-										else if (pdef2->name()->value() == "group_type") {
+											break;
+										case SYM_GROUP_TYPE: {
 											char type_name[64];
 											GetDefText(type_name, pdef2, filename);
 											gtype = CombatGroup::TypeFromName(type_name);
 											NewCampaignReq.GroupType = gtype;
 
+											break;
 										}
-										else if (pdef2->name()->value() == "group_id") {
+										case SYM_GROUP_ID:
 											GetDefNumber(gid, pdef2, filename);
 											NewCampaignReq.GroupId = gid;
+											break;
 										}
 									}
 								}
 								CampaignActionReqArray.Add(NewCampaignReq);
+								break;
+							}
+							default:
+								if (pdef->name()->value().contains("before")) {
+									if (pdef->term()->isNumber()) {
+										GetDefNumber(StartBefore, pdef, filename);
+										NewCampaignAction.StartBefore = StartBefore;
+									}
+									else {
+										GetDefTime(StartBefore, pdef, filename);
+										StartBefore -= Game::ONE_DAY;
+										NewCampaignAction.StartBefore = StartBefore;
+									}
+								}
+								else if (pdef->name()->value().contains("after")) {
+									if (pdef->term()->isNumber()) {
+										GetDefNumber(StartAfter, pdef, filename);
+										NewCampaignAction.StartAfter = StartAfter;
+									}
+									else {
+										GetDefTime(StartAfter, pdef, filename);
+										StartAfter -= Game::ONE_DAY;
+										NewCampaignAction.StartAfter = StartAfter;
+									}
+								}
+								break;
 							}
 						}
 						NewCampaignAction.Requirement = CampaignActionReqArray;
@@ -644,9 +662,10 @@ void AGameDataLoader::LoadCampaignData(const char* FileName, bool full)
 						CampaignActionArray.Add(NewCampaignAction);
 					}
 					NewCampaignData.Action = CampaignActionArray;
+					break;
 				}
 
-				else if (def->name()->value() == "combatant") {
+				case SYM_COMBATANT: {
 					
 					TermStruct* CombatantTerm = def->term()->isStruct();
 
@@ -664,13 +683,13 @@ void AGameDataLoader::LoadCampaignData(const char* FileName, bool full)
 						{	
 							def = CombatantTerm->elements()->at(UnitIdx)->isDef();
 
-							if (def->name()->value() == "name") {
+							if (def->name()->symbol() == SYM_NAME) {
 								GetDefText(CombatantName, def, filename);
 								NewCombatUnit.Name = FString(CombatantName);
-							} else if (def->name()->value() == "size") {
+							} else if (def->name()->symbol() == SYM_SIZE) {
 								GetDefNumber(CombatantSize, def, filename);
 								NewCombatUnit.Size = CombatantSize;
-							} else if (def->name()->value() == "group") {
+							} else if (def->name()->symbol() == SYM_GROUP) {
 								//ParseGroup(def->term()->isStruct(), filename);
 								TermStruct* GroupTerm = def->term()->isStruct();
 
@@ -680,21 +699,24 @@ void AGameDataLoader::LoadCampaignData(const char* FileName, bool full)
 								for (int i = 0; i < GroupTerm->elements()->size(); i++) {
 
 									TermDef* pdef = GroupTerm->elements()->at(i)->isDef();
-									if (pdef->name()->value() == "type") {
+									switch (pdef->name()->symbol()) {
+									case SYM_TYPE:
 										GetDefText(CombatantType, pdef, filename);
 										NewGroupUnit.Type = FString(CombatantType);
 										UE_LOG(LogTemp, Log, TEXT("%s:  %s"), *FString(pdef->name()->value()), *FString(CombatantType));
 										//type = CombatGroup::TypeFromName(type_name);
-									}
+										break;
 
-									else if (pdef->name()->value() == "id") {
+									case SYM_ID:
 										GetDefNumber(CombatantId, pdef, filename);
 										NewGroupUnit.Id = CombatantId;
 										UE_LOG(LogTemp, Log, TEXT("%s: %d"), *FString(pdef->name()->value()), CombatantId);
-									}
-									else if (pdef->name()->value() == "req") {
+										break;
+									case SYM_REQ: {
 										
 										TermStruct* val2 = pdef->term()->isStruct();			
+										break;
+									}
 									}
 								}
 								NewCombatUnit.Group.Add(NewGroupUnit);
@@ -703,6 +725,8 @@ void AGameDataLoader::LoadCampaignData(const char* FileName, bool full)
 						CombatantArray.Add(NewCombatUnit);
 					}
 					NewCampaignData.Combatant = CombatantArray;	
+					break;
+				}
 				}
 			}
 		}
@@ -728,7 +752,6 @@ void AGameDataLoader::LoadCampaignData(const char* FileName, bool full)
 	CampaignDataTable->AddRow(RowName, NewCampaignData);
 	CampaignData = NewCampaignData;
 
-	SSWInstance->loader->ReleaseBuffer(block);
 }
 
 void AGameDataLoader::LoadZones(FString Path)
@@ -745,12 +768,11 @@ void AGameDataLoader::LoadZones(FString Path)
 	SSWInstance->loader->GetLoader();
 	SSWInstance->loader->SetDataPath(fn);
 
-	BYTE* block = 0;
+	ParsedFile content;
 
-	SSWInstance->loader->LoadBuffer(fn, block, true);
+	LoadParsedFile(fn, content);
 
-	Parser parser(new BlockReader((const char*)block));
-	Term* term = parser.ParseTerm();
+	Term* term = content.ParseTerm();
 
 	ZoneArray.Empty();
 
@@ -767,11 +789,11 @@ void AGameDataLoader::LoadZones(FString Path)
 
 	do {
 		delete term;
-		term = parser.ParseTerm();
+		term = content.ParseTerm();
 
 		if (term) {
 			TermDef* def = term->isDef();
-			if (def->name()->value() == "zone") {
+			if (def->name()->symbol() == SYM_ZONE) {
 				if (!def->term() || !def->term()->isStruct()) {
 					UE_LOG(LogTemp, Log, TEXT("WARNING: zone struct missing in '%s'"), *FString(filename));
 				}
@@ -783,12 +805,12 @@ void AGameDataLoader::LoadZones(FString Path)
 					for (int i = 0; i < val->elements()->size(); i++) {
 						TermDef* pdef = val->elements()->at(i)->isDef();
 						if (pdef) {
-							if (pdef->name()->value() == "region") {
+							if (pdef->name()->symbol() == SYM_REGION) {
 								GetDefText(ZoneRegion, pdef, fn);
 								NewCampaignZone.Region = FString(ZoneRegion);
 								//zone->AddRegion(rgn);
 							}
-							else if (pdef->name()->value() == "system") {
+							else if (pdef->name()->symbol() == SYM_SYSTEM) {
 								GetDefText(ZoneSystem, pdef, fn);
 								NewCampaignZone.System = FString(ZoneSystem);
 								//zone->system = rgn;
@@ -802,7 +824,6 @@ void AGameDataLoader::LoadZones(FString Path)
 
 	} while (term);
 
-	SSWInstance->loader->ReleaseBuffer(block);
 }
 
 // +--------------------------------------------------------------------+
@@ -829,12 +850,11 @@ AGameDataLoader::LoadMissionList(FString Path)
 	SSWInstance->loader->GetLoader();
 	SSWInstance->loader->SetDataPath(fn);
 
-	BYTE* block = 0;
+	ParsedFile content;
 
-	SSWInstance->loader->LoadBuffer(fn, block, true);
+	LoadParsedFile(fn, content);
 
-	Parser parser(new BlockReader((const char*)block));
-	Term* term = parser.ParseTerm();
+	Term* term = content.ParseTerm();
 
 	if (!term) {
 		return;
@@ -849,11 +869,11 @@ AGameDataLoader::LoadMissionList(FString Path)
 
 	do {
 		delete term; term = 0;
-		term = parser.ParseTerm();
+		term = content.ParseTerm();
 
 		if (term) {
 			TermDef* def = term->isDef();
-			if (def->name()->value() == "mission") {
+			if (def->name()->symbol() == SYM_MISSION) {
 				if (!def->term() || !def->term()->isStruct()) {
 					UE_LOG(LogTemp, Log, TEXT("WARNING: zone struct missing in '%s'"), *FString(fn));
 				}
@@ -873,39 +893,42 @@ AGameDataLoader::LoadMissionList(FString Path)
 
 					for (int i = 0; i < val->elements()->size(); i++) {
 						TermDef* pdef = val->elements()->at(i)->isDef();
-						if (pdef->name()->value() == "id") {
+						switch (pdef->name()->symbol()) {
+						case SYM_ID:
 							GetDefNumber(MissionId, pdef, fn);
 							NewMissionList.Id = MissionId;
-						}
-						else if (pdef->name()->value() == "name") {
+							break;
+						case SYM_NAME:
 							GetDefText(MLName, pdef, fn);
 							NewMissionList.Name = FString(MLName);
-						}
-						else if (pdef->name()->value() == "desc") {
+							break;
+						case SYM_DESC:
 							GetDefText(Desc, pdef, fn);
 							NewMissionList.Description = FString(Desc);
-						}
-						else if (pdef->name()->value() == "start") {
+							break;
+						case SYM_START:
 							GetDefTime(Start, pdef, fn);
 							NewMissionList.Description = FString(Desc);
-						}
-						else if (pdef->name()->value() == "system") {
+							break;
+						case SYM_SYSTEM:
 							GetDefText(System, pdef, fn);
 							NewMissionList.System = FString(System);
-						}
-						else if (pdef->name()->value() == "region") {
+							break;
+						case SYM_REGION:
 							GetDefText(Region, pdef, fn);
 							NewMissionList.Region = FString(Region);
-						}
-						else if (pdef->name()->value() == "script") {
+							break;
+						case SYM_SCRIPT:
 							GetDefText(Script, pdef, fn);
 							NewMissionList.Script = FString(Script);
-						}
-						else if (pdef->name()->value() == "type") {
+							break;
+						case SYM_TYPE: {
 							char typestr[64];
 							GetDefText(typestr, pdef, fn);
 							Type = Mission::TypeFromName(typestr);
 							NewMissionList.Type = Type;
+							break;
+						}
 						}
 					}
 					MissionListArray.Add(NewMissionList);
@@ -914,7 +937,6 @@ AGameDataLoader::LoadMissionList(FString Path)
 		}
 	} while (term);
 
-	SSWInstance->loader->ReleaseBuffer(block);
 }
 
 // +--------------------------------------------------------------------+
@@ -941,12 +963,11 @@ AGameDataLoader::LoadTemplateList(FString Path)
 	SSWInstance->loader->GetLoader();
 	SSWInstance->loader->SetDataPath(fn);
 
-	BYTE* block = 0;
+	ParsedFile content;
 
-	SSWInstance->loader->LoadBuffer(fn, block, true);
+	LoadParsedFile(fn, content);
 
-	Parser parser(new BlockReader((const char*)block));
-	Term* term = parser.ParseTerm();
+	Term* term = content.ParseTerm();
 
 	if (!term) {
 		return;
@@ -961,11 +982,11 @@ AGameDataLoader::LoadTemplateList(FString Path)
 
 	do {
 		delete term; 
-		term = parser.ParseTerm();
+		term = content.ParseTerm();
 
 		if (term) {
 			TermDef* def = term->isDef();
-			if (def->name()->value() == "mission") {
+			if (def->name()->symbol() == SYM_MISSION) {
 				if (!def->term() || !def->term()->isStruct()) {
 					UE_LOG(LogTemp, Log, TEXT("WARNING: mission struct missing in '%s'"), *FString(fn));
 				}
@@ -991,77 +1012,84 @@ AGameDataLoader::LoadTemplateList(FString Path)
 
 					for (int i = 0; i < val->elements()->size(); i++) {
 					TermDef* pdef = val->elements()->at(i)->isDef();
-						if (pdef->name()->value() == "id") {
+						switch (pdef->name()->symbol()) {
+						case SYM_ID:
 							GetDefNumber(id, pdef, fn);
 							NewTemplateList.Id = id;
-						}
-						else if (pdef->name()->value() == "name") {
+							break;
+						case SYM_NAME:
 							GetDefText(TLName, pdef, fn);
 							NewTemplateList.Name = FString(TLName);
-						}
-						else if (pdef->name()->value() == "script") {
+							break;
+						case SYM_SCRIPT:
 							GetDefText(Script, pdef, fn);
 							NewTemplateList.Script = FString(Script);
-						}
-						else if (pdef->name()->value() == "rgn" || pdef->name()->value() == "region") {
+							break;
+						case SYM_RGN:
+						case SYM_REGION:
 							GetDefText(Region, pdef, fn);
 							NewTemplateList.Region = FString(Region);
-						}
-						else if (pdef->name()->value() == "type") {
+							break;
+						case SYM_TYPE: {
 							char typestr[64];
 							GetDefText(typestr, pdef, fn);
 							msn_type = Mission::TypeFromName(typestr);
 							NewTemplateList.MissionType = msn_type;
+							break;
 						}
 
-						else if (pdef->name()->value() == "group") {
+						case SYM_GROUP: {
 							char typestr[64];
 							GetDefText(typestr, pdef, fn);
 							grp_type = CombatGroup::TypeFromName(typestr);
 							NewTemplateList.GroupType = grp_type;
+							break;
 						}
 
-						else if (pdef->name()->value() == "min_rank") {
+						case SYM_MIN_RANK:
 							GetDefNumber(min_rank, pdef, fn);
 							NewTemplateList.MinRank = min_rank;
-						}
-						else if (pdef->name()->value() == "max_rank") {
+							break;
+						case SYM_MAX_RANK:
 							GetDefNumber(max_rank, pdef, fn);
 							NewTemplateList.MaxRank = max_rank;
-						}
-						else if (pdef->name()->value() == "action_id") {
+							break;
+						case SYM_ACTION_ID:
 							GetDefNumber(action_id, pdef, fn);
 							NewTemplateList.ActionId = action_id;
-						}
-						else if (pdef->name()->value() == "action_status") {
+							break;
+						case SYM_ACTION_STATUS:
 							GetDefNumber(action_status, pdef, fn);
 							NewTemplateList.ActionStatus = action_status;
-						}
-						else if (pdef->name()->value() == "exec_once") {
+							break;
+						case SYM_EXEC_ONCE:
 							GetDefNumber(exec_once, pdef, fn);
 							NewTemplateList.ExecOnce = exec_once;
-						}
-						else if (pdef->name()->value().contains("before")) {
-							if (pdef->term()->isNumber()) {
-								GetDefNumber(start_before, pdef, fn);
-								NewTemplateList.StartBefore = start_before;
-							}
-							else {
-								GetDefTime(start_before, pdef, fn);
-								start_before -= Game::ONE_DAY;
-								NewTemplateList.StartBefore = start_before;
-							}
-						}
-						else if (pdef->name()->value().contains("after")) {
-							if (pdef->term()->isNumber()) {
-								GetDefNumber(start_after, pdef, fn);
-								NewTemplateList.StartAfter = start_after;
+							break;
+						default:
+							if (pdef->name()->value().contains("before")) {
+								if (pdef->term()->isNumber()) {
+									GetDefNumber(start_before, pdef, fn);
+									NewTemplateList.StartBefore = start_before;
+								}
+								else {
+									GetDefTime(start_before, pdef, fn);
+									start_before -= Game::ONE_DAY;
+									NewTemplateList.StartBefore = start_before;
+								}
 							}
-							else {
-								GetDefTime(start_after, pdef, fn);
-								start_after -= Game::ONE_DAY;
-								NewTemplateList.StartAfter = start_after;
+							else if (pdef->name()->value().contains("after")) {
+								if (pdef->term()->isNumber()) {
+									GetDefNumber(start_after, pdef, fn);
+									NewTemplateList.StartAfter = start_after;
+								}
+								else {
+									GetDefTime(start_after, pdef, fn);
+									start_after -= Game::ONE_DAY;
+									NewTemplateList.StartAfter = start_after;
+								}
 							}
+							break;
 						}
 					}
 					TemplateListArray.Add(NewTemplateList);
@@ -1070,7 +1098,6 @@ AGameDataLoader::LoadTemplateList(FString Path)
 		}
 	} while (term);
 
-	SSWInstance->loader->ReleaseBuffer(block);
 }
 
 // +--------------------------------------------------------------------+
@@ -1158,24 +1185,16 @@ AGameDataLoader::ParseMission(const char* fn)
 	SSWInstance->loader->GetLoader();
 	SSWInstance->loader->SetDataPath(fn);
 
-	BYTE* block = 0;
-	SSWInstance->loader->LoadBuffer(fn, block, true);
+	ParsedFile content;
+	LoadParsedFile(fn, content);
 
-	Parser parser(new BlockReader((const char*)block));
-	Term* term = parser.ParseTerm();
+	Term* term = content.ParseTerm();
 	
 	FString fs = FString(ANSI_TO_TCHAR(fn));
-	FString FileString;
 
 	MissionElementArray.Empty();
 	MissionEventArray.Empty();
 
-	if (FFileHelper::LoadFileToString(FileString, *fs, FFileHelper::EHashOptions::None))
-	{
-		UE_LOG(LogTemp, Log, TEXT("%s"), *FileString);
-
-		const char* result = TCHAR_TO_ANSI(*FileString);
-	}
 	if (!term) {
 		UE_LOG(LogTemp, Log, TEXT("WARNING: could not parse '%s'"), *FString(fn));
 		return;
@@ -1209,102 +1228,104 @@ AGameDataLoader::ParseMission(const char* fn)
 
 	do {
 		delete term;
-		term = parser.ParseTerm();
+		term = content.ParseTerm();
 
 		if (term) {
 			TermDef* def = term->isDef();
 			if (def) {
-				if (def->name()->value() == "name") {
+				switch (def->name()->symbol()) {
+				case SYM_NAME:
 					GetDefText(Name, def, fn);
 					NewMission.Name = FString(Name);
 					UE_LOG(LogTemp, Log, TEXT("mission name '%s'"), *FString(Name));
-				}
+					break;
 		
-				else if (def->name()->value() == "scene") {
+				case SYM_SCENE:
 					GetDefText(Scene, def, fn);
 					NewMission.Scene = FString(Scene);
 
-				}
-				else if (def->name()->value() == "desc") {
+					break;
+				case SYM_DESC:
 					GetDefText(Desc, def, fn);
 					if (Desc.length() > 0 && Desc.length() < 32) {
 						NewMission.Desc = FString(Desc);
 					}
-				}
-				else if (def->name()->value() == "type") {
+					break;
+				case SYM_TYPE: {
 					char typestr[64];
 					GetDefText(typestr, def, fn);
 					Type = Mission::TypeFromName(typestr);
 					NewMission.Type = Type;
+					break;
 				}
-				else if (def->name()->value() == "system") {
+				case SYM_SYSTEM:
 					GetDefText(System, def, fn);
 					NewMission.System = FString(System);
-				}
-				else if (def->name()->value() == "region") {
+					break;
+				case SYM_REGION:
 					GetDefText(Region, def, fn);
 					NewMission.Region = FString(Region);
-				}
-				else if (def->name()->value() == "degrees") {
+					break;
+				case SYM_DEGREES:
 					GetDefBool(Degrees, def, fn);
 					NewMission.Degrees = Degrees;
-				}
-				else if (def->name()->value() == "objective") {
+					break;
+				case SYM_OBJECTIVE:
 					GetDefText(Objective, def, fn);
 					if (Objective.length() > 0 && Objective.length() < 32) {
 						NewMission.Objective = FString(Objective);
 					}
-				}
-				else if (def->name()->value() == "sitrep") {
+					break;
+				case SYM_SITREP:
 					GetDefText(Sitrep, def, fn);
 					if (Sitrep.length() > 0 && Sitrep.length() < 32) {
 						NewMission.Sitrep = FString(Sitrep);
 					}
-				}
-				else if (def->name()->value() == "subtitles") {
+					break;
+				case SYM_SUBTITLES:
 					GetDefText(Subtitles, def, fn);
 					NewMission.Subtitles = FString(Subtitles);
 				
-				}
-				else if (def->name()->value() == "start") {
+					break;
+				case SYM_START:
 					GetDefText(Start, def, fn);
 					NewMission.StartTime = FString(Start);
 					//GetDefTime(start, def, fn);
 
-				}
-				else if (def->name()->value() == "stardate") {
+					break;
+				case SYM_STARDATE:
 					GetDefNumber(Stardate, def, fn);
 					NewMission.Stardate = Stardate;
-				}
-				else if (def->name()->value() == "team") {
+					break;
+				case SYM_TEAM:
 					GetDefNumber(Team, def, fn);
 					NewMission.Team = Team;
-				}
-				else if (def->name()->value() == "target") {
+					break;
+				case SYM_TARGET:
 					GetDefText(TargetName, def, fn);
 					NewMission.TargetName = FString(TargetName);
-				}
-				else if (def->name()->value() == "ward") {
+					break;
+				case SYM_WARD:
 					GetDefText(WardName, def, filename);
 					NewMission.WardName = FString(WardName);
-				}
-				else if (def->name()->value() == "event") {
+					break;
+				case SYM_EVENT:
 					ParseEvent(def->term()->isStruct(), fn);
 					NewMission.Event = MissionEventArray;
-				}
+					break;
 
-				else if ((def->name()->value() == "element") ||
-					(def->name()->value() == "ship") ||
-					(def->name()->value() == "station")) {
+				case SYM_ELEMENT:
+				case SYM_SHIP:
+				case SYM_STATION:
 					 
 					 ParseElement(def->term()->isStruct(), fn);
 					 NewMission.Element = MissionElementArray;
-				}	
+					 break;
+				}
 			}
 		}        // term
 	} while (term); 
 
-	SSWInstance->loader->ReleaseBuffer(block);
 	MissionArray.Add(NewMission);
 }
 
@@ -1336,51 +1357,52 @@ AGameDataLoader::ParseNavpoint(TermStruct* val, const char* fn)
 	for (int i = 0; i < val->elements()->size(); i++) {
 		TermDef* pdef = val->elements()->at(i)->isDef();
 		if (pdef) {
-			if (pdef->name()->value() == "cmd") {
+			switch (pdef->name()->symbol()) {
+			case SYM_CMD:
 				GetDefText(order_name, pdef, fn);
 				NewMissionInstruction.OrderName = FString(order_name);
-			}
+				break;
 
-			else if (pdef->name()->value() == "status") {
+			case SYM_STATUS:
 				GetDefText(status_name, pdef, fn);
 				NewMissionInstruction.StatusName = FString(status_name);
-			}
+				break;
 
-			else if (pdef->name()->value() == "loc") {
+			case SYM_LOC:
 				GetDefVec(loc, pdef, fn);
 				NewMissionInstruction.Location.X = loc.x;
 				NewMissionInstruction.Location.Y = loc.y;
 				NewMissionInstruction.Location.Z = loc.z;
-			}
+				break;
 
-			else if (pdef->name()->value() == "rloc") {
+			case SYM_RLOC:
 				if (pdef->term()->isStruct()) {
 					ParseRLoc(pdef->term()->isStruct(), fn);
 					NewMissionInstruction.RLoc = MissionRLocArray;
 				}
-			}
+				break;
 
-			else if (pdef->name()->value() == "rgn") {
+			case SYM_RGN:
 				GetDefText(order_rgn_name, pdef, fn);
 				NewMissionInstruction.OrderRegionName = FString(order_rgn_name);
-			}
-			else if (pdef->name()->value() == "speed") {
+				break;
+			case SYM_SPEED:
 				GetDefNumber(speed, pdef, fn);
 				NewMissionInstruction.Speed = speed;
-			}
-			else if (pdef->name()->value() == "formation") {
+				break;
+			case SYM_FORMATION:
 				GetDefNumber(formation, pdef, fn);
 				NewMissionInstruction.Formation = formation;
-			}
-			else if (pdef->name()->value() == "emcon") {
+				break;
+			case SYM_EMCON:
 				GetDefNumber(emcon, pdef, fn);
 				NewMissionInstruction.EMCON = emcon;
-			}
-			else if (pdef->name()->value() == "priority") {
+				break;
+			case SYM_PRIORITY:
 				GetDefNumber(priority, pdef, fn);
 				NewMissionInstruction.Priority = priority;
-			}
-			else if (pdef->name()->value() == "farcast") {
+				break;
+			case SYM_FARCAST:
 				if (pdef->term()->isBool()) {
 					bool f = false;
 					GetDefBool(f, pdef, fn);
@@ -1394,18 +1416,21 @@ AGameDataLoader::ParseNavpoint(TermStruct* val, const char* fn)
 					GetDefNumber(farcast, pdef, fn);
 					NewMissionInstruction.Farcast = farcast;
 				}
-			}
-			else if (pdef->name()->value() == "tgt") {
+				break;
+			case SYM_TGT:
 				GetDefText(tgt_name, pdef, fn);
 				NewMissionInstruction.TargetName = FString(tgt_name);
-			}
-			else if (pdef->name()->value() == "tgt_desc") {
+				break;
+			case SYM_TGT_DESC:
 				GetDefText(tgt_desc, pdef, fn);
 				NewMissionInstruction.TargetDesc = FString(tgt_desc);
-			}
-			else if (pdef->name()->value().indexOf("hold") == 0) {
-				GetDefNumber(hold, pdef, fn);
-				NewMissionInstruction.Hold = hold;
+				break;
+			default:
+				if (pdef->name()->value().indexOf("hold") == 0) {
+					GetDefNumber(hold, pdef, fn);
+					NewMissionInstruction.Hold = hold;
+				}
+				break;
 			}
 		}
 	}
@@ -1440,51 +1465,52 @@ AGameDataLoader::ParseObjective(TermStruct* val, const char* fn)
 	for (int i = 0; i < val->elements()->size(); i++) {
 		TermDef* pdef = val->elements()->at(i)->isDef();
 		if (pdef) {
-			if (pdef->name()->value() == "cmd") {
+			switch (pdef->name()->symbol()) {
+			case SYM_CMD:
 				GetDefText(order_name, pdef, fn);
 				NewMissionObjective.OrderName = FString(order_name);
-			}
+				break;
 
-			else if (pdef->name()->value() == "status") {
+			case SYM_STATUS:
 				GetDefText(status_name, pdef, fn);
 				NewMissionObjective.StatusName = FString(status_name);
-			}
+				break;
 
-			else if (pdef->name()->value() == "loc") {
+			case SYM_LOC:
 				GetDefVec(loc, pdef, fn);
 				NewMissionObjective.Location.X = loc.x;
 				NewMissionObjective.Location.Y = loc.y;
 				NewMissionObjective.Location.Z = loc.z;
-			}
+				break;
 
-			else if (pdef->name()->value() == "rloc") {
+			case SYM_RLOC:
 				if (pdef->term()->isStruct()) {
 					ParseRLoc(pdef->term()->isStruct(), fn);
 					NewMissionObjective.RLoc = MissionRLocArray;
 				}
-			}
+				break;
 
-			else if (pdef->name()->value() == "rgn") {
+			case SYM_RGN:
 				GetDefText(order_rgn_name, pdef, fn);
 				NewMissionObjective.OrderRegionName = FString(order_rgn_name);
-			}
-			else if (pdef->name()->value() == "speed") {
+				break;
+			case SYM_SPEED:
 				GetDefNumber(speed, pdef, fn);
 				NewMissionObjective.Speed = speed;
-			}
-			else if (pdef->name()->value() == "formation") {
+				break;
+			case SYM_FORMATION:
 				GetDefNumber(formation, pdef, fn);
 				NewMissionObjective.Formation = formation;
-			}
-			else if (pdef->name()->value() == "emcon") {
+				break;
+			case SYM_EMCON:
 				GetDefNumber(emcon, pdef, fn);
 				NewMissionObjective.EMCON = emcon;
-			}
-			else if (pdef->name()->value() == "priority") {
+				break;
+			case SYM_PRIORITY:
 				GetDefNumber(priority, pdef, fn);
 				NewMissionObjective.Priority = priority;
-			}
-			else if (pdef->name()->value() == "farcast") {
+				break;
+			case SYM_FARCAST:
 				if (pdef->term()->isBool()) {
 					bool f = false;
 					GetDefBool(f, pdef, fn);
@@ -1498,18 +1524,21 @@ AGameDataLoader::ParseObjective(TermStruct* val, const char* fn)
 					GetDefNumber(farcast, pdef, fn);
 					NewMissionObjective.Farcast = farcast;
 				}
-			}
-			else if (pdef->name()->value() == "tgt") {
+				break;
+			case SYM_TGT:
 				GetDefText(tgt_name, pdef, fn);
 				NewMissionObjective.TargetName = FString(tgt_name);
-			}
-			else if (pdef->name()->value() == "tgt_desc") {
+				break;
+			case SYM_TGT_DESC:
 				GetDefText(tgt_desc, pdef, fn);
 				NewMissionObjective.TargetDesc = FString(tgt_desc);
-			}
-			else if (pdef->name()->value().indexOf("hold") == 0) {
-				GetDefNumber(hold, pdef, fn);
-				NewMissionObjective.Hold = hold;
+				break;
+			default:
+				if (pdef->name()->value().indexOf("hold") == 0) {
+					GetDefNumber(hold, pdef, fn);
+					NewMissionObjective.Hold = hold;
+				}
+				break;
 			}
 		}
 	}
@@ -1544,51 +1573,52 @@ AGameDataLoader::ParseInstruction(TermStruct* val, const char* fn)
 	for (int i = 0; i < val->elements()->size(); i++) {
 		TermDef* pdef = val->elements()->at(i)->isDef();
 		if (pdef) {
-			if (pdef->name()->value() == "cmd") {
+			switch (pdef->name()->symbol()) {
+			case SYM_CMD:
 				GetDefText(order_name, pdef, fn);
 				NewMissionInstruction.OrderName = FString(order_name);
-			}
+				break;
 
-			else if (pdef->name()->value() == "status") {
+			case SYM_STATUS:
 				GetDefText(status_name, pdef, fn);
 				NewMissionInstruction.StatusName = FString(status_name);
-			}
+				break;
 
-			else if (pdef->name()->value() == "loc") {
+			case SYM_LOC:
 				GetDefVec(loc, pdef, fn);
 				NewMissionInstruction.Location.X = loc.x;
 				NewMissionInstruction.Location.Y = loc.y;
 				NewMissionInstruction.Location.Z = loc.z;
-			}
+				break;
 
-			else if (pdef->name()->value() == "rloc") {
+			case SYM_RLOC:
 				if (pdef->term()->isStruct()) {
 					ParseRLoc(pdef->term()->isStruct(), fn);
 					NewMissionInstruction.RLoc = MissionRLocArray;
 				}
-			}
+				break;
 
-			else if (pdef->name()->value() == "rgn") {
+			case SYM_RGN:
 				GetDefText(order_rgn_name, pdef, fn);
 				NewMissionInstruction.OrderRegionName = FString(order_rgn_name);
-			}
-			else if (pdef->name()->value() == "speed") {
+				break;
+			case SYM_SPEED:
 				GetDefNumber(speed, pdef, fn);
 				NewMissionInstruction.Speed = speed;
-			}
-			else if (pdef->name()->value() == "formation") {
+				break;
+			case SYM_FORMATION:
 				GetDefNumber(formation, pdef, fn);
 				NewMissionInstruction.Formation = formation;
-			}
-			else if (pdef->name()->value() == "emcon") {
+				break;
+			case SYM_EMCON:
 				GetDefNumber(emcon, pdef, fn);
 				NewMissionInstruction.EMCON = emcon;
-			}
-			else if (pdef->name()->value() == "priority") {
+				break;
+			case SYM_PRIORITY:
 				GetDefNumber(priority, pdef, fn);
 				NewMissionInstruction.Priority = priority;
-			}
-			else if (pdef->name()->value() == "farcast") {
+				break;
+			case SYM_FARCAST:
 				if (pdef->term()->isBool()) {
 					bool f = false;
 					GetDefBool(f, pdef, fn);
@@ -1602,18 +1632,21 @@ AGameDataLoader::ParseInstruction(TermStruct* val, const char* fn)
 					GetDefNumber(farcast, pdef, fn);
 					NewMissionInstruction.Farcast = farcast;
 				}
-			}
-			else if (pdef->name()->value() == "tgt") {
+				break;
+			case SYM_TGT:
 				GetDefText(tgt_name, pdef, fn);
 				NewMissionInstruction.TargetName = FString(tgt_name);
-			}
-			else if (pdef->name()->value() == "tgt_desc") {
+				break;
+			case SYM_TGT_DESC:
 				GetDefText(tgt_desc, pdef, fn);
 				NewMissionInstruction.TargetDesc = FString(tgt_desc);
-			}
-			else if (pdef->name()->value().indexOf("hold") == 0) {
-				GetDefNumber(hold, pdef, fn);
-				NewMissionInstruction.Hold = hold;
+				break;
+			default:
+				if (pdef->name()->value().indexOf("hold") == 0) {
+					GetDefNumber(hold, pdef, fn);
+					NewMissionInstruction.Hold = hold;
+				}
+				break;
 			}
 		}
 	}
@@ -1653,66 +1686,68 @@ AGameDataLoader::ParseShip(TermStruct* val, const char* fn)
 	for (index = 0; index < val->elements()->size(); index++) {
 		TermDef* pdef = val->elements()->at(index)->isDef();
 		if (pdef) {
-			if (pdef->name()->value() == "name") {
+			switch (pdef->name()->symbol()) {
+			case SYM_NAME:
 				GetDefText(ShipName, pdef, fn);
 				NewMissionShip.ShipName = FString(ShipName);
-			}
-			else if (pdef->name()->value() == "skin") {
+				break;
+			case SYM_SKIN:
 				GetDefText(SkinName, pdef, fn);
 				NewMissionShip.SkinName = FString(SkinName);
-			}
+				break;
 
-			else if (pdef->name()->value() == "regnum") {
+			case SYM_REGNUM:
 				GetDefText(RegNum, pdef, fn);
 				NewMissionShip.RegNum = FString(RegNum);
-			}
-			else if (pdef->name()->value() == "region") {
+				break;
+			case SYM_REGION:
 				GetDefText(Region, pdef, fn);
 				NewMissionShip.Region = FString(Region);
-			}
-			else if (pdef->name()->value() == "loc") {
+				break;
+			case SYM_LOC:
 				GetDefVec(Location, pdef, fn);
 				NewMissionShip.Location.X = Location.x;
 				NewMissionShip.Location.Y = Location.y;
 				NewMissionShip.Location.Z = Location.z;
 			
-			}
-			else if (pdef->name()->value() == "velocity") {
+				break;
+			case SYM_VELOCITY:
 				GetDefVec(Velocity, pdef, fn);
 				NewMissionShip.Velocity.X = Velocity.x;
 				NewMissionShip.Velocity.Y = Velocity.y;
 				NewMissionShip.Velocity.Z = Velocity.z;
-			}
+				break;
 
-			else if (pdef->name()->value() == "respawns") {
+			case SYM_RESPAWNS:
 				GetDefNumber(Respawns, pdef, fn);
 				NewMissionShip.Respawns = Respawns;
 			
-			}
-			else if (pdef->name()->value() == "heading") {
+				break;
+			case SYM_HEADING:
 					GetDefNumber(Heading, pdef, fn);
 					NewMissionShip.Heading = Heading;
-			}
+					break;
 
-			else if (pdef->name()->value() == "integrity") {
+			case SYM_INTEGRITY:
 				GetDefNumber(Integrity, pdef, fn);
 				NewMissionShip.Integrity = Integrity;
-			}
+				break;
 
-			else if (pdef->name()->value() == "ammo") {
+			case SYM_AMMO:
 				GetDefArray(Ammo, 16, pdef, fn);
 
 				for (int AmmoIndex = 0; AmmoIndex < 16; AmmoIndex++) {
 					NewMissionShip.Ammo[AmmoIndex] = Ammo[AmmoIndex];
 				}
-			}
+				break;
 
-			else if (pdef->name()->value() == "fuel") {
+			case SYM_FUEL:
 				GetDefArray(Fuel, 4, pdef, fn);
 			
 				for (int FuelIndex = 0; FuelIndex < 16; FuelIndex++) {
 					NewMissionShip.Fuel[FuelIndex] = Fuel[FuelIndex];
 				}
+				break;
 			}
 		}
 	}
@@ -1735,20 +1770,22 @@ AGameDataLoader::ParseLoadout(TermStruct* val, const char* fn)
 	for (int i = 0; i < val->elements()->size(); i++) {
 		TermDef* pdef = val->elements()->at(i)->isDef();
 		if (pdef) {
-			if (pdef->name()->value() == "ship") {
+			switch (pdef->name()->symbol()) {
+			case SYM_SHIP:
 				GetDefNumber(ship, pdef, fn);
 				NewLoadout.Ship = ship;
-			}
-			else if (pdef->name()->value() == "name") {
+				break;
+			case SYM_NAME:
 				GetDefText(LoadoutName, pdef, fn);
 				NewLoadout.LoadoutName = FString(LoadoutName);
-			}
-			else if (pdef->name()->value() == "stations") {
+				break;
+			case SYM_STATIONS:
 				GetDefArray(stations, 16, pdef, fn);
 
 				for(int index = 0; index < 16; index++) {
 					NewLoadout.Stations[index] = stations[index];
 				}
+				break;
 			}
 		}
 	}
@@ -1790,33 +1827,36 @@ AGameDataLoader::ParseEvent(TermStruct* val, const char* fn)
 	for (int i = 0; i < val->elements()->size(); i++) {
 		TermDef* pdef = val->elements()->at(i)->isDef();
 		if (pdef) {
-			if (pdef->name()->value() == "type") {
+			switch (pdef->name()->symbol()) {
+			case SYM_TYPE:
 				GetDefText(EventType, pdef, fn);
 				NewMissionEvent.EventType = FString(EventType);
-			}
+				break;
 
-			else if (pdef->name()->value() == "trigger") {
+			case SYM_TRIGGER:
 				GetDefText(TriggerName, pdef, fn);
 				NewMissionEvent.TriggerName = FString(TriggerName);
-			}
+				break;
 
-			else if (pdef->name()->value() == "id") {
+			case SYM_ID:
 				GetDefNumber(EventId, pdef, fn);
 				NewMissionEvent.EventId = EventId;
 			
-			}
+				break;
 
-			else if (pdef->name()->value() == "time") {
+			case SYM_TIME:
 				GetDefNumber(EventTime, pdef, fn);
 				NewMissionEvent.EventTime = EventTime;
-			}
+				break;
 
-			else if (pdef->name()->value() == "delay") {
+			case SYM_DELAY:
 				GetDefNumber(EventDelay, pdef, fn);
 				NewMissionEvent.EventDelay = EventDelay;
-			}
+				break;
 			
-			else if (pdef->name()->value() == "event_param" || pdef->name()->value() == "param" || pdef->name()->value() == "color") {
+			case SYM_EVENT_PARAM:
+			case SYM_PARAM:
+			case SYM_COLOR:
 				if (pdef->term()->isNumber()) {
 					GetDefNumber(EventParam[0], pdef, fn);
 					EventNParams = 1;
@@ -1837,9 +1877,9 @@ AGameDataLoader::ParseEvent(TermStruct* val, const char* fn)
 					}
 					NewMissionEvent.EventNParams = EventNParams;
 				}
-			}
+				break;
 
-			else if (pdef->name()->value() == "trigger_param") {
+			case SYM_TRIGGER_PARAM:
 				if (pdef->term()->isNumber()) {
 					GetDefNumber(TriggerParam[0], pdef, fn);
 					TriggerNParams = 1;
@@ -1859,58 +1899,69 @@ AGameDataLoader::ParseEvent(TermStruct* val, const char* fn)
 					}
 					NewMissionEvent.TriggerNParams = TriggerNParams;
 				}
-			}
+				break;
 
-			else if (pdef->name()->value() == "event_ship" || pdef->name()->value() == "ship") {
+			case SYM_EVENT_SHIP:
+			case SYM_SHIP:
 				GetDefText(EventShip, pdef, fn);
 				NewMissionEvent.EventShip = FString(EventShip);
-			}
+				break;
 
-			else if (pdef->name()->value() == "event_source" || pdef->name()->value() == "source" || pdef->name()->value() == "font") {
+			case SYM_EVENT_SOURCE:
+			case SYM_SOURCE:
+			case SYM_FONT:
 				GetDefText(EventSource, pdef, fn);
 				NewMissionEvent.EventSource = FString(EventSource);
-			}
-			else if (pdef->name()->value() == "event_target" || pdef->name()->value() == "target" || pdef->name()->value() == "image") {
+				break;
+			case SYM_EVENT_TARGET:
+			case SYM_TARGET:
+			case SYM_IMAGE:
 				GetDefText(EventTarget, pdef, fn);
 				NewMissionEvent.EventTarget = FString(EventTarget);
-			}
+				break;
 
-			else if (pdef->name()->value() == "event_message" || pdef->name()->value() == "message") {
+			case SYM_EVENT_MESSAGE:
+			case SYM_MESSAGE:
 				GetDefText(EventMessage, pdef, fn);
 				NewMissionEvent.EventMessage = FString(EventMessage);
-			}
+				break;
 
-			else if (pdef->name()->value() == "event_chance" || pdef->name()->value() == "chance") {
+			case SYM_EVENT_CHANCE:
+			case SYM_CHANCE:
 				GetDefNumber(EventChance, pdef, fn);
 				NewMissionEvent.EventChance = EventChance;
-			}
-			else if (pdef->name()->value() == "event_sound" || pdef->name()->value() == "sound") {
+				break;
+			case SYM_EVENT_SOUND:
+			case SYM_SOUND:
 				GetDefText(EventSound, pdef, fn);
 				NewMissionEvent.EventSound = FString(EventSound);
-			}
+				break;
 
-			else if (pdef->name()->value() == "loc" || pdef->name()->value() == "vec" || pdef->name()->value() == "fade") {
+			case SYM_LOC:
+			case SYM_VEC:
+			case SYM_FADE:
 				GetDefVec(EventPoint, pdef, fn);
 				NewMissionEvent.EventPoint.X = EventPoint.x;
 				NewMissionEvent.EventPoint.Y = EventPoint.y;
 				NewMissionEvent.EventPoint.Z = EventPoint.z;
-			}
+				break;
 
-			else if (pdef->name()->value() == "rect") {
+			case SYM_RECT:
 				GetDefRect(EventRect, pdef, fn);
 				NewMissionEvent.EventRect.X = EventRect.x;
 				NewMissionEvent.EventRect.Y = EventRect.y;
 				NewMissionEvent.EventRect.Z = EventRect.h;
 				NewMissionEvent.EventRect.W = EventRect.w;
-			}
-			else if (pdef->name()->value() == "trigger_ship") {
+				break;
+			case SYM_TRIGGER_SHIP:
 				GetDefText(TriggerShip, pdef, fn);
 				NewMissionEvent.TriggerShip = FString(TriggerShip);
-			}
+				break;
 
-			else if (pdef->name()->value() == "trigger_target") {
+			case SYM_TRIGGER_TARGET:
 				GetDefText(TriggerTarget, pdef, fn);
 				NewMissionEvent.TriggerTarget = FString(TriggerTarget);
+				break;
 			}
 		}
 	}
@@ -1966,122 +2017,124 @@ AGameDataLoader::ParseElement(TermStruct* eval, const char* fn)
 	for (int i = 0; i < eval->elements()->size(); i++) {
 		TermDef* pdef = eval->elements()->at(i)->isDef();
 		if (pdef) {
-			if (pdef->name()->value() == "name") {
+			switch (pdef->name()->symbol()) {
+			case SYM_NAME:
 				GetDefText(ElementName, pdef, fn);
 				NewMissionElement.Name = FString(ElementName);
-			}
-			else if (pdef->name()->value() == "carrier") {
+				break;
+			case SYM_CARRIER:
 				GetDefText(Carrier, pdef, fn);
 				NewMissionElement.Carrier = FString(Carrier);
-			}
-			else if (pdef->name()->value() == "commander") {
+				break;
+			case SYM_COMMANDER:
 				GetDefText(Commander, pdef, fn);
 				NewMissionElement.Commander = FString(Commander);
-			}
-			else if (pdef->name()->value() == "squadron") {
+				break;
+			case SYM_SQUADRON:
 				GetDefText(Squadron, pdef, fn);
 				NewMissionElement.Squadron = FString(Squadron);
-			}
-			else if (pdef->name()->value() == "path") {
+				break;
+			case SYM_PATH:
 				GetDefText(Path, pdef, fn);
 				NewMissionElement.Path = FString(Path);
-			}
-			else if (pdef->name()->value() == "design") {
+				break;
+			case SYM_DESIGN:
 				GetDefText(Design, pdef, fn);
 				NewMissionElement.Design = FString(Design);
-			}
-			else if (pdef->name()->value() == "skin") {
+				break;
+			case SYM_SKIN:
 				GetDefText(SkinName, pdef, fn);
 				NewMissionElement.SkinName = FString(SkinName);
-			}
-			else if (pdef->name()->value() == "mission") {
+				break;
+			case SYM_MISSION:
 				GetDefText(RoleName, pdef, fn);
 				NewMissionElement.RoleName = FString(RoleName);
-			}
-			else if (pdef->name()->value() == "intel") {
+				break;
+			case SYM_INTEL:
 				GetDefText(RoleName, pdef, fn);
 				NewMissionElement.Intel = FString(ElementIntel);
-			}
+				break;
 
-			else if (pdef->name()->value() == "loc") {
+			case SYM_LOC:
 				GetDefVec(ElementLoc, pdef, fn);
 				NewMissionElement.Location.X = ElementLoc.x;
 				NewMissionElement.Location.Y = ElementLoc.y;
 				NewMissionElement.Location.Z = ElementLoc.z;
-			}
+				break;
 
-			else if (pdef->name()->value() == "rloc") {
+			case SYM_RLOC:
 				if (pdef->term()->isStruct()) {
 					ParseLoadout(pdef->term()->isStruct(), fn);
 					NewMissionElement.RLoc = MissionRLocArray;
 				}
-			}
+				break;
 
-			else if (pdef->name()->value() == "head") {
+			case SYM_HEAD:
 				GetDefNumber(Heading, pdef, fn);
 				NewMissionElement.Heading = Heading;
-			}
+				break;
 
-			else if (pdef->name()->value() == "region" || pdef->name()->value() == "rgn") {
+			case SYM_REGION:
+			case SYM_RGN:
 				GetDefText(RegionName, pdef, fn);
 				NewMissionElement.RegionName = FString(RegionName);
-			}
+				break;
 
-			else if (pdef->name()->value() == "iff") {
+			case SYM_IFF:
 				GetDefNumber(IFFCode, pdef, fn);
 				NewMissionElement.IFFCode = IFFCode;
 
-			}
-			else if (pdef->name()->value() == "count") {
+				break;
+			case SYM_COUNT:
 				GetDefNumber(Count, pdef, fn);
 				NewMissionElement.Count = Count;
 
-			}
-			else if (pdef->name()->value() == "maint_count") {
+				break;
+			case SYM_MAINT_COUNT:
 				GetDefNumber(MaintCount, pdef, fn);
 				NewMissionElement.MaintCount = MaintCount;
-			}
-			else if (pdef->name()->value() == "dead_count") {
+				break;
+			case SYM_DEAD_COUNT:
 				GetDefNumber(DeadCount, pdef, fn);
 				NewMissionElement.DeadCount = DeadCount;
-			}
-			else if (pdef->name()->value() == "player") {
+				break;
+			case SYM_PLAYER:
 				GetDefNumber(Player, pdef, fn);
 				NewMissionElement.Player = Player;
-			}
-			else if (pdef->name()->value() == "alert") {
+				break;
+			case SYM_ALERT:
 				GetDefBool(Alert, pdef, fn);
 				NewMissionElement.Alert = Alert;
-			}
-			else if (pdef->name()->value() == "playable") {
+				break;
+			case SYM_PLAYABLE:
 				GetDefBool(Playable, pdef, fn);
 				NewMissionElement.Playable = Playable;
-			}
-			else if (pdef->name()->value() == "rogue") {
+				break;
+			case SYM_ROGUE:
 				GetDefBool(Rogue, pdef, fn);
 				NewMissionElement.Rogue = Rogue;
-			}
-			else if (pdef->name()->value() == "invulnerable") {
+				break;
+			case SYM_INVULNERABLE:
 				GetDefBool(Invulnerable, pdef, fn);
 				NewMissionElement.Invulnerable = Invulnerable;
-			}
-			else if (pdef->name()->value() == "command_ai") {
+				break;
+			case SYM_COMMAND_AI:
 				GetDefNumber(CommandAI, pdef, fn);
 				NewMissionElement.CommandAI = CommandAI;
-			}
-			else if (pdef->name()->value() == "respawn") {
+				break;
+			case SYM_RESPAWN:
 				GetDefNumber(Respawns, pdef, fn);
 				NewMissionElement.Respawns = Respawns;
-			}
-			else if (pdef->name()->value() == "hold") {
+				break;
+			case SYM_HOLD:
 				GetDefNumber(HoldTime, pdef, fn);
 				NewMissionElement.HoldTime = HoldTime;
-			}
-			else if (pdef->name()->value() == "zone") {
+				break;
+			case SYM_ZONE:
 				GetDefNumber(ZoneLock, pdef, fn);
 				NewMissionElement.ZoneLock = ZoneLock;
-			}
-			else if (pdef->name()->value() == "objective") {
+				break;
+			case SYM_OBJECTIVE:
 				if (!pdef->term() || !pdef->term()->isStruct()) {
 					UE_LOG(LogTemp, Log, TEXT("Mission error - No objective"));
 				}
@@ -2089,13 +2142,13 @@ AGameDataLoader::ParseElement(TermStruct* eval, const char* fn)
 					ParseInstruction(pdef->term()->isStruct(), fn);
 					NewMissionElement.Instruction = MissionInstructionArray;
 				}
-			}
-			else if (pdef->name()->value() == "instr") {
+				break;
+			case SYM_INSTR:
 				GetDefText(Instr, pdef, fn);
 				NewMissionElement.Instr = FString(Instr);
-			}
+				break;
 
-			else if (pdef->name()->value() == "ship") {
+			case SYM_SHIP:
 				if (!pdef->term() || !pdef->term()->isStruct()) {
 					UE_LOG(LogTemp, Log, TEXT("Mission error - no ship"));
 				}
@@ -2103,9 +2156,10 @@ AGameDataLoader::ParseElement(TermStruct* eval, const char* fn)
 					ParseShip(pdef->term()->isStruct(), fn);
 					NewMissionElement.Ship = MissionShipArray;
 				}
-			}
+				break;
 
-			else if (pdef->name()->value() == "order" || pdef->name()->value() == "navpt") {
+			case SYM_ORDER:
+			case SYM_NAVPT:
 				if (!pdef->term() || !pdef->term()->isStruct()) {
 					UE_LOG(LogTemp, Log, TEXT("Mission error - no navpt"));
 
@@ -2114,9 +2168,9 @@ AGameDataLoader::ParseElement(TermStruct* eval, const char* fn)
 					ParseNavpoint(pdef->term()->isStruct(), fn);
 					NewMissionElement.Navpoint = MissionNavpointArray;
 				}
-			}
+				break;
 
-			else if (pdef->name()->value() == "loadout") {
+			case SYM_LOADOUT:
 				if (!pdef->term() || !pdef->term()->isStruct()) {
 					UE_LOG(LogTemp, Log, TEXT("Mission error - no loadout"));
 
@@ -2125,6 +2179,7 @@ AGameDataLoader::ParseElement(TermStruct* eval, const char* fn)
 					ParseLoadout(pdef->term()->isStruct(), fn);
 					NewMissionElement.Loadout = MissionLoadoutArray;
 				}
+				break;
 			}
 		}
 	}
@@ -2141,14 +2196,12 @@ AGameDataLoader::ParseScriptedTemplate(const char* fn)
 	SSWInstance->loader->GetLoader();
 	SSWInstance->loader->SetDataPath(fn);
 
-	BYTE* block = 0;
-	SSWInstance->loader->LoadBuffer(fn, block, true);
+	ParsedFile content;
+	LoadParsedFile(fn, content);
 
-	Parser parser(new BlockReader((const char*)block));
-	Term* term = parser.ParseTerm();
+	Term* term = content.ParseTerm();
 
 	FString fs = FString(ANSI_TO_TCHAR(fn));
-	FString FileString;
 
 	MissionElementArray.Empty();
 	MissionEventArray.Empty();
@@ -2156,12 +2209,6 @@ AGameDataLoader::ParseScriptedTemplate(const char* fn)
 	MissionOptionalArray.Empty();
 	MissionAliasArray.Empty();
 
-	if (FFileHelper::LoadFileToString(FileString, *fs, FFileHelper::EHashOptions::None))
-	{
-		UE_LOG(LogTemp, Log, TEXT("%s"), *FileString);
-
-		const char* result = TCHAR_TO_ANSI(*FileString);
-	}
 	if (!term) {
 		UE_LOG(LogTemp, Log, TEXT("WARNING: could not parse '%s'"), *FString(fn));
 		return;
@@ -2188,69 +2235,71 @@ AGameDataLoader::ParseScriptedTemplate(const char* fn)
 
 	do {
 		delete term;
-		term = parser.ParseTerm();
+		term = content.ParseTerm();
 
 		if (term) {
 			TermDef* def = term->isDef();
 			if (def) {
 				Text defname = def->name()->value();
 
-				if (def->name()->value() == "name") {
+				switch (def->name()->symbol()) {
+				case SYM_NAME:
 					GetDefText(TemplateName, def, fn);
 					NewTemplateMission.TemplateName = FString(TemplateName);
-				}
-				else if (def->name()->value() == "type") {
+					break;
+				case SYM_TYPE: {
 					char typestr[64];
 					GetDefText(typestr, def, fn);
 					TemplateType = Mission::TypeFromName(typestr);
 					NewTemplateMission.TemplateType = TemplateType;
+					break;
 				}
 
-				else if (def->name()->value() == "system") {
+				case SYM_SYSTEM:
 					GetDefText(TemplateSystem, def, fn);
 					NewTemplateMission.TemplateSystem = FString(TemplateSystem);
-				}
+					break;
 
-				else if (def->name()->value() == "degrees") {
+				case SYM_DEGREES:
 					GetDefBool(TemplateDegrees, def, fn);
 					NewTemplateMission.TemplateDegrees = TemplateDegrees;
-				}
-				else if (def->name()->value() == "region") {
+					break;
+				case SYM_REGION:
 					GetDefText(TemplateRegion, def, fn);
 					NewTemplateMission.TemplateRegion = FString(TemplateRegion);
-				}
+					break;
 
-				else if (def->name()->value() == "objective") {
+				case SYM_OBJECTIVE:
 					GetDefText(TemplateObjective, def, fn);
 					NewTemplateMission.TemplateObjective = FString(TemplateObjective);
-				}
+					break;
 
-				else if (def->name()->value() == "sitrep") {
+				case SYM_SITREP:
 					GetDefText(TemplateSitrep, def, fn);
 					NewTemplateMission.TemplateSitrep = FString(TemplateSitrep);
-				}
+					break;
 
-				else if (def->name()->value() == "start") {
+				case SYM_START:
 					//GetDefTime(start, def, fn);
 					GetDefText(TemplateStart, def, fn);
 					NewTemplateMission.TemplateStart = FString(TemplateStart);
-				}
-				else if (def->name()->value() == "team") {
+					break;
+				case SYM_TEAM:
 					GetDefNumber(TemplateTeam, def, fn);
 					NewTemplateMission.TemplateTeam = TemplateTeam;
-				}
+					break;
 
-				else if (def->name()->value() == "target") {
+				case SYM_TARGET:
 					GetDefText(TargetName, def, fn);
 					NewTemplateMission.TargetName = FString(TargetName);
-				}
+					break;
 
-				else if (def->name()->value() == "ward") {
+				case SYM_WARD:
 					GetDefText(WardName, def, fn);
 					NewTemplateMission.WardName = FString(WardName);
-				}
+					break;
 
-				else if ((def->name()->value() == "alias")) {
+				case SYM_ALIAS:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: alias struct missing in '%s'"), *FString(fn));
 					}
@@ -2258,9 +2307,9 @@ AGameDataLoader::ParseScriptedTemplate(const char* fn)
 						ParseAlias(def->term()->isStruct(), fn);
 						NewTemplateMission.Alias = MissionAliasArray;
 					}
-				}
+					break;
 
-				else if ((def->name()->value() == "callsign")) {
+				case SYM_CALLSIGN:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: callsign struct missing in '%s'"), *FString(fn));
 					}
@@ -2269,9 +2318,9 @@ AGameDataLoader::ParseScriptedTemplate(const char* fn)
 						ParseCallsign(val, fn);
 						NewTemplateMission.Callsign = MissionCallsignArray;
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "optional") {
+				case SYM_OPTIONAL:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: optional group struct missing in '%s'"), *FString(fn));
 					}
@@ -2280,9 +2329,9 @@ AGameDataLoader::ParseScriptedTemplate(const char* fn)
 						ParseOptional(val, fn);
 						NewTemplateMission.Optional = MissionOptionalArray;
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "element") {
+				case SYM_ELEMENT:
 					if (!def->term() || !def->term()->isStruct()) {
 						Print("WARNING: element struct missing in '%s'\n", fn);
 					}
@@ -2290,9 +2339,9 @@ AGameDataLoader::ParseScriptedTemplate(const char* fn)
 						ParseElement(def->term()->isStruct(), fn);
 						NewTemplateMission.Element = MissionElementArray;
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "event") {
+				case SYM_EVENT:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: event struct missing in '%s'"), *FString(fn));
 					}
@@ -2300,12 +2349,12 @@ AGameDataLoader::ParseScriptedTemplate(const char* fn)
 						ParseEvent(def->term()->isStruct(), fn);
 						NewTemplateMission.Event = MissionEventArray;;
 					}
+					break;
 				}
 			}     // def
 		}        // term
 	} while (term);
 
-	SSWInstance->loader->ReleaseBuffer(block);
 	ScriptedMissionArray.Add(NewTemplateMission);
 }
 
@@ -2319,14 +2368,12 @@ AGameDataLoader::ParseMissionTemplate(const char* fn)
 	SSWInstance->loader->GetLoader();
 	SSWInstance->loader->SetDataPath(fn);
 
-	BYTE* block = 0;
-	SSWInstance->loader->LoadBuffer(fn, block, true);
+	ParsedFile content;
+	LoadParsedFile(fn, content);
 
-	Parser parser(new BlockReader((const char*)block));
-	Term* term = parser.ParseTerm();
+	Term* term = content.ParseTerm();
 
 	FString fs = FString(ANSI_TO_TCHAR(fn));
-	FString FileString;
 
 	MissionElementArray.Empty();
 	MissionEventArray.Empty();
@@ -2334,12 +2381,6 @@ AGameDataLoader::ParseMissionTemplate(const char* fn)
 	MissionOptionalArray.Empty();
 	MissionAliasArray.Empty();
 
-	if (FFileHelper::LoadFileToString(FileString, *fs, FFileHelper::EHashOptions::None))
-	{
-		UE_LOG(LogTemp, Log, TEXT("%s"), *FileString);
-
-		const char* result = TCHAR_TO_ANSI(*FileString);
-	}
 	if (!term) {
 		UE_LOG(LogTemp, Log, TEXT("WARNING: could not parse '%s'"), *FString(fn));
 		return;
@@ -2366,69 +2407,71 @@ AGameDataLoader::ParseMissionTemplate(const char* fn)
 
 	do {
 		delete term; 
-		term = parser.ParseTerm();
+		term = content.ParseTerm();
 
 		if (term) {
 			TermDef* def = term->isDef();
 			if (def) {
 				Text defname = def->name()->value();
 
-				if (def->name()->value() == "name") {
+				switch (def->name()->symbol()) {
+				case SYM_NAME:
 					GetDefText(TemplateName, def, fn);
 					NewTemplateMission.TemplateName = FString(TemplateName);
-				}
-				else if (def->name()->value() == "type") {
+					break;
+				case SYM_TYPE: {
 					char typestr[64];
 					GetDefText(typestr, def, fn);
 					TemplateType = Mission::TypeFromName(typestr);
 					NewTemplateMission.TemplateType = TemplateType;
+					break;
 				}
 
-				else if (def->name()->value() == "system") {
+				case SYM_SYSTEM:
 					GetDefText(TemplateSystem, def, fn);
 					NewTemplateMission.TemplateSystem = FString(TemplateSystem);
-				}
+					break;
 
-				else if (def->name()->value() == "degrees") {
+				case SYM_DEGREES:
 					GetDefBool(TemplateDegrees, def, fn);
 					NewTemplateMission.TemplateDegrees = TemplateDegrees;
-				}
-				else if (def->name()->value() == "region") {
+					break;
+				case SYM_REGION:
 					GetDefText(TemplateRegion, def, fn);
 					NewTemplateMission.TemplateRegion = FString(TemplateRegion);
-				}
+					break;
 
-				else if (def->name()->value() == "objective") {
+				case SYM_OBJECTIVE:
 					GetDefText(TemplateObjective, def, fn);
 					NewTemplateMission.TemplateObjective = FString(TemplateObjective);
-				}
+					break;
 
-				else if (def->name()->value() == "sitrep") {
+				case SYM_SITREP:
 					GetDefText(TemplateSitrep, def, fn);
 					NewTemplateMission.TemplateSitrep = FString(TemplateSitrep);
-				}
+					break;
 
-				else if (def->name()->value() == "start") {
+				case SYM_START:
 					//GetDefTime(start, def, fn);
 					GetDefText(TemplateStart, def, fn);
 					NewTemplateMission.TemplateStart = FString(TemplateStart);
-				}
-				else if (def->name()->value() == "team") {
+					break;
+				case SYM_TEAM:
 					GetDefNumber(TemplateTeam, def, fn);
 					NewTemplateMission.TemplateTeam = TemplateTeam;
-				}
+					break;
 
-				else if (def->name()->value() == "target") {
+				case SYM_TARGET:
 					GetDefText(TargetName, def, fn);
 					NewTemplateMission.TargetName = FString(TargetName);
-				}
+					break;
 
-				else if (def->name()->value() == "ward") {
+				case SYM_WARD:
 					GetDefText(WardName, def, fn);
 					NewTemplateMission.WardName = FString(WardName);
-				}
+					break;
 
-				else if ((def->name()->value() == "alias")) {
+				case SYM_ALIAS:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: alias struct missing in '%s'"), *FString(fn));
 					}
@@ -2436,9 +2479,9 @@ AGameDataLoader::ParseMissionTemplate(const char* fn)
 						ParseAlias(def->term()->isStruct(), fn);
 						NewTemplateMission.Alias = MissionAliasArray;
 					}
-				}
+					break;
 
-				else if ((def->name()->value() == "callsign")) {
+				case SYM_CALLSIGN:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: callsign struct missing in '%s'"), *FString(fn));
 					}
@@ -2446,9 +2489,9 @@ AGameDataLoader::ParseMissionTemplate(const char* fn)
 						ParseCallsign(def->term()->isStruct(), fn);
 						NewTemplateMission.Callsign = MissionCallsignArray;
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "optional") {
+				case SYM_OPTIONAL:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: optional group struct missing in '%s'"), *FString(fn));
 					}
@@ -2456,9 +2499,9 @@ AGameDataLoader::ParseMissionTemplate(const char* fn)
 						ParseOptional(def->term()->isStruct(), fn);
 						NewTemplateMission.Optional = MissionOptionalArray;
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "element") {
+				case SYM_ELEMENT:
 					if (!def->term() || !def->term()->isStruct()) {
 						Print("WARNING: element struct missing in '%s'\n", fn);
 					}
@@ -2466,9 +2509,9 @@ AGameDataLoader::ParseMissionTemplate(const char* fn)
 						ParseElement(def->term()->isStruct(), fn);
 						NewTemplateMission.Element = MissionElementArray;
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "event") {
+				case SYM_EVENT:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: event struct missing in '%s'"), *FString(fn));
 					}
@@ -2476,12 +2519,12 @@ AGameDataLoader::ParseMissionTemplate(const char* fn)
 						ParseEvent(def->term()->isStruct(), fn);
 						NewTemplateMission.Event = MissionEventArray;
 					}
+					break;
 				}
 			}     // def
 		}        // term
 	} while (term);
 
-	SSWInstance->loader->ReleaseBuffer(block);
 	TemplateMissionArray.Add(NewTemplateMission);
 }
 
@@ -2513,65 +2556,67 @@ AGameDataLoader::ParseAlias(TermStruct* val, const char* fn)
 		TermDef* pdef = val->elements()->at(i)->isDef();
 		if (pdef) {
 
-			if (pdef->name()->value() == "name") {
+			switch (pdef->name()->symbol()) {
+			case SYM_NAME:
 				GetDefText(AliasName, pdef, fn);
 				NewMissionAlias.AliasName = FString(AliasName);
-			}
-			else if (pdef->name()->value() == "elem") {
+				break;
+			case SYM_ELEM:
 				GetDefText(ElementName, pdef, fn);
 				NewMissionAlias.ElementName = FString(ElementName);
-			}
-			else if (pdef->name()->value() == "code") {
+				break;
+			case SYM_CODE:
 				GetDefText(Code, pdef, fn);
 				NewMissionAlias.Code = FString(Code);
-			}
-			else if (pdef->name()->value() == "design") {
+				break;
+			case SYM_DESIGN:
 				GetDefText(Design, pdef, fn);
 				NewMissionAlias.Design = FString(Design);
-			}
-			else if (pdef->name()->value() == "mission") {
+				break;
+			case SYM_MISSION:
 				GetDefText(Mission, pdef, fn);
 				NewMissionAlias.Mission = FString(Mission);
-			}
-			else if (pdef->name()->value() == "iff") {
+				break;
+			case SYM_IFF:
 				GetDefNumber(iff, pdef, fn);
 				NewMissionAlias.Iff = iff;
-			}
-			else if (pdef->name()->value() == "loc") {
+				break;
+			case SYM_LOC:
 				GetDefVec(Location, pdef, fn);
 				UseLocation = true;
 				NewMissionAlias.Location.X = Location.x;
 				NewMissionAlias.Location.Y = Location.y;
 				NewMissionAlias.Location.Z = Location.z;
 				NewMissionAlias.UseLocation = UseLocation;
-			}
+				break;
 
-			else if (pdef->name()->value() == "rloc") {
+			case SYM_RLOC:
 				if (pdef->term()->isStruct()) {
 					ParseRLoc(pdef->term()->isStruct(), fn);
 					NewMissionAlias.RLoc = MissionRLocArray;
 				}
-			}
+				break;
 
-			else if (pdef->name()->value() == "player") {
+			case SYM_PLAYER:
 				GetDefNumber(player, pdef, fn);
 				if (player && !Code.length()) {
 					Code = "player";
 					NewMissionAlias.Code = FString(Code);
 					NewMissionAlias.Player = player;
 				}
-			}
-			else if (pdef->name()->value() == "navpt") {
+				break;
+			case SYM_NAVPT:
 				if (pdef->term()->isStruct()) {
 					ParseNavpoint(pdef->term()->isStruct(), fn);
 					NewMissionAlias.Navpoint = MissionNavpointArray;
 				}
-			}
-			else if (pdef->name()->value() == "objective") {
+				break;
+			case SYM_OBJECTIVE:
 				if (pdef->term()->isStruct()) {
 					ParseObjective(pdef->term()->isStruct(), fn);
 					NewMissionAlias.Objective = MissionObjectiveArray;
 				}
+				break;
 			}
 		}
 	}
@@ -2597,46 +2642,48 @@ AGameDataLoader::ParseRLoc(TermStruct* rval, const char* fn)
 	for (int index = 0; index < rval->elements()->size(); index++) {
 		TermDef* rdef = rval->elements()->at(index)->isDef();
 		if (rdef) {
-			if (rdef->name()->value() == "dex") {
+			switch (rdef->name()->symbol()) {
+			case SYM_DEX:
 				GetDefNumber(dex, rdef, fn);
 				NewRLocElement.Dex = dex;
 
-			}
-			else if (rdef->name()->value() == "dex_var") {
+				break;
+			case SYM_DEX_VAR:
 				GetDefNumber(dex_var, rdef, fn);
 				NewRLocElement.DexVar = dex_var;
 
-			}
-			else if (rdef->name()->value() == "az") {
+				break;
+			case SYM_AZ:
 				GetDefNumber(az, rdef, fn);
 				NewRLocElement.Azimuth = az;
 
-			}
-			else if (rdef->name()->value() == "az_var") {
+				break;
+			case SYM_AZ_VAR:
 				GetDefNumber(az_var, rdef, fn);
 				NewRLocElement.AzimuthVar = az_var;
 
-			}
-			else if (rdef->name()->value() == "el") {
+				break;
+			case SYM_EL:
 				GetDefNumber(el, rdef, fn);
 				NewRLocElement.Elevation = el;
 
-			}
-			else if (rdef->name()->value() == "el_var") {
+				break;
+			case SYM_EL_VAR:
 				GetDefNumber(el_var, rdef, fn);
 				NewRLocElement.ElevationVar = el_var;
 
-			}
-			else if (rdef->name()->value() == "loc") {
+				break;
+			case SYM_LOC:
 				GetDefVec(BaseLocation, rdef, fn);
 				NewRLocElement.BaseLocation.X = BaseLocation.x;
 				NewRLocElement.BaseLocation.Y = BaseLocation.y;
 				NewRLocElement.BaseLocation.Z = BaseLocation.z;
-			}
+				break;
 
-			else if (rdef->name()->value() == "ref") {
+			case SYM_REF:
 				GetDefText(Reference, rdef, fn);
 				NewRLocElement.Reference = FString(Reference);
+				break;
 			}
 		}
 	}
@@ -2656,12 +2703,12 @@ AGameDataLoader::ParseCallsign(TermStruct* val, const char* fn)
 	for (int i = 0; i < val->elements()->size(); i++) {
 		TermDef* pdef = val->elements()->at(i)->isDef();
 		if (pdef) {
-			if (pdef->name()->value() == "name") {
+			if (pdef->name()->symbol() == SYM_NAME) {
 				GetDefText(CallsignName, pdef, fn);
 				NewMissionCallsign.Callsign = FString(CallsignName);
 			}
 
-			else if (pdef->name()->value() == "iff") {
+			else if (pdef->name()->symbol() == SYM_IFF) {
 				GetDefNumber(CallsignIff, pdef, fn);
 				NewMissionCallsign.Iff = CallsignIff;
 			}
@@ -2682,17 +2729,19 @@ AGameDataLoader::ParseOptional(TermStruct* val, const char* fn)
 	for (int i = 0; i < val->elements()->size(); i++) {
 		TermDef* pdef = val->elements()->at(i)->isDef();
 		if (pdef) {
-			if (pdef->name()->value() == "min") {
+			switch (pdef->name()->symbol()) {
+			case SYM_MIN:
 				GetDefNumber(min, pdef, fn);
-			}
+				break;
 
-			else if (pdef->name()->value() == "max") {
+			case SYM_MAX:
 				GetDefNumber(max, pdef, fn);
-			}
+				break;
 
-			else if (pdef->name()->value() == "element") {
+			case SYM_ELEMENT:
 				//ParseElement(pdef->term()->isStruct(), fn);
 
+				break;
 			}
 		}
 	}
@@ -2713,21 +2762,13 @@ AGameDataLoader::LoadGalaxyMap()
 
 	SSWInstance->loader->GetLoader();
 
-	FString FileString;
-	BYTE* block = 0;
+	ParsedFile content;
 
-	SSWInstance->loader->LoadBuffer(fn, block, true);
+	LoadParsedFile(fn, content);
 
 	UE_LOG(LogTemp, Log, TEXT("Loading Galaxy: %s"), *FileName);
 
-	if (FFileHelper::LoadFileToString(FileString, *FileName, FFileHelper::EHashOptions::None))
-	{
-		UE_LOG(LogTemp, Log, TEXT("%s"), *FileString);
-	}
-
-	Parser parser(new BlockReader((const char*)block));
-
-	Term* term = parser.ParseTerm();
+	Term* term = content.ParseTerm();
 
 	if (!term) {
 		UE_LOG(LogTemp, Log, TEXT("WARNING: could not parse '%s'"), *FileName);
@@ -2749,18 +2790,19 @@ AGameDataLoader::LoadGalaxyMap()
 	// parse the galaxy:
 	do {
 		delete term;
-		term = parser.ParseTerm();
+		term = content.ParseTerm();
 		FVector fv;
 
 		double Radius;
 		if (term) {
 			TermDef* def = term->isDef();
 			if (def) {
-				if (def->name()->value() == "radius") {
+				switch (def->name()->symbol()) {
+				case SYM_RADIUS:
 					GetDefNumber(Radius, def, fn);
-				}
+					break;
 
-				else if (def->name()->value() == "system") {
+				case SYM_SYSTEM:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: system struct missing in '%s'"), *FString(fn));
 					}
@@ -2777,21 +2819,22 @@ AGameDataLoader::LoadGalaxyMap()
 						for (int i = 0; i < val->elements()->size(); i++) {
 							TermDef* pdef = val->elements()->at(i)->isDef();
 							if (pdef) {
-								if (pdef->name()->value() == "name") {
+								switch (pdef->name()->symbol()) {
+								case SYM_NAME:
 									GetDefText(SystemName, pdef, fn);
 									NewGalaxyData.Name = FString(SystemName);
-								}
-								else if (pdef->name()->value() == "loc") {
+									break;
+								case SYM_LOC:
 
 									GetDefVec(SystemLocation, pdef, fn);
 									fv = FVector(SystemLocation.x, SystemLocation.y, SystemLocation.z);
 									NewGalaxyData.Location = fv;
-								}
-								else if (pdef->name()->value() == "iff") {
+									break;
+								case SYM_IFF:
 									GetDefNumber(SystemIff, pdef, fn);
 									NewGalaxyData.Iff = SystemIff;
-								}
-								else if (pdef->name()->value() == "class") {
+									break;
+								case SYM_CLASS:
 									GetDefText(ClassName, pdef, fn);
 
 									switch (ClassName[0]) {
@@ -2824,6 +2867,7 @@ AGameDataLoader::LoadGalaxyMap()
 										break;
 									}
 									NewGalaxyData.Class = StarClass;
+									break;
 								}
 							}
 						}
@@ -2838,9 +2882,9 @@ AGameDataLoader::LoadGalaxyMap()
 
 						GalaxyData = NewGalaxyData;
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "star") {
+				case SYM_STAR:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: star struct missing in '%s'"), *FString(fn));
 					}
@@ -2857,13 +2901,13 @@ AGameDataLoader::LoadGalaxyMap()
 						for (int i = 0; i < val->elements()->size(); i++) {
 							TermDef* pdef = val->elements()->at(i)->isDef();
 							if (pdef) {
-								if (pdef->name()->value() == "name")
+								if (pdef->name()->symbol() == SYM_NAME)
 									GetDefText(star_name, pdef, fn);
 
-								else if (pdef->name()->value() == "loc")
+								else if (pdef->name()->symbol() == SYM_LOC)
 									GetDefVec(star_loc, pdef, fn);
 
-								else if (pdef->name()->value() == "class") {
+								else if (pdef->name()->symbol() == SYM_CLASS) {
 									GetDefText(classname, pdef, fn);
 
 									switch (classname[0]) {
@@ -2902,12 +2946,12 @@ AGameDataLoader::LoadGalaxyMap()
 							}
 						}
 					}
+					break;
 				}
 			}
 			UE_LOG(LogTemp, Log, TEXT("------------------------------------------------------------"));
 		}
 	} while (term);
-	SSWInstance->loader->ReleaseBuffer(block);
 }
 
 // +--------------------------------------------------------------------+
@@ -2934,58 +2978,63 @@ AGameDataLoader::ParseStar(TermStruct* val, const char* fn)
 	for (int i = 0; i < val->elements()->size(); i++) {
 		TermDef* pdef = val->elements()->at(i)->isDef();
 		if (pdef) {
-			if (pdef->name()->value() == "name") {
+			switch (pdef->name()->symbol()) {
+			case SYM_NAME:
 				GetDefText(StarName, pdef, fn);
 				NewStarData.Name = FString(StarName);
-			}
-			else if (pdef->name()->value() == "map" || pdef->name()->value() == "icon") {
+				break;
+			case SYM_MAP:
+			case SYM_ICON:
 				GetDefText(MapName, pdef, fn);
 				NewStarData.Map = FString(MapName);
-			}
-			else if (pdef->name()->value() == "image") {
+				break;
+			case SYM_IMAGE:
 				GetDefText(ImgName, pdef, fn);
 				NewStarData.Image = FString(ImgName);
-			}
-			else if (pdef->name()->value() == "mass") {
+				break;
+			case SYM_MASS:
 				GetDefNumber(Mass, pdef, fn);
 				NewStarData.Mass = Mass;
-			}
-			else if (pdef->name()->value() == "orbit") {
+				break;
+			case SYM_ORBIT:
 				GetDefNumber(Orbit, pdef, fn);
 				NewStarData.Orbit = Orbit;
-			}
-			else if (pdef->name()->value() == "radius") {
+				break;
+			case SYM_RADIUS:
 				GetDefNumber(Radius, pdef, fn);
 				NewStarData.Radius = Radius;
-			}
-			else if (pdef->name()->value() == "rotation") {
+				break;
+			case SYM_ROTATION:
 				GetDefNumber(Rot, pdef, fn);
 				NewStarData.Rot = Rot;
-			}
-			else if (pdef->name()->value() == "tscale") {
+				break;
+			case SYM_TSCALE:
 				GetDefNumber(Tscale, pdef, fn);
 				NewStarData.Tscale = Tscale;
-			}
-			else if (pdef->name()->value() == "light") {
+				break;
+			case SYM_LIGHT:
 				GetDefNumber(Light, pdef, fn);
 				NewStarData.Light = Light;
-			}
-			else if (pdef->name()->value() == "retro") {
+				break;
+			case SYM_RETRO:
 				GetDefBool(Retro, pdef, fn);
 				NewStarData.Retro = Retro;
-			}
-			else if (pdef->name()->value() == "color") {
+				break;
+			case SYM_COLOR: {
 				Vec3 a;
 				GetDefVec(a, pdef, fn);
 				NewStarData.Color = FColor(a.x, a.y, a.z, 1);
+				break;
 			}
 
-			else if (pdef->name()->value() == "back" || pdef->name()->value() == "back_color") {
+			case SYM_BACK:
+			case SYM_BACK_COLOR: {
 				Vec3 a;
 				GetDefVec(a, pdef, fn);
 				NewStarData.Back = FColor(a.x, a.y, a.z, 1);
+				break;
 			}
-			else if (pdef->name()->value() == "planet") {
+			case SYM_PLANET:
 				if (!pdef->term() || !pdef->term()->isStruct()) {
 					UE_LOG(LogTemp, Log, TEXT("WARNING: planet struct missing in '%s'"), *FString(fn));
 				}
@@ -2993,6 +3042,7 @@ AGameDataLoader::ParseStar(TermStruct* val, const char* fn)
 					ParsePlanet(pdef->term()->isStruct(), fn);
 					NewStarData.Planet = PlanetDataArray;
 				}
+				break;
 			}
 		}	
 	}
@@ -3032,85 +3082,92 @@ void AGameDataLoader::ParsePlanet(TermStruct* val, const char* fn)
 	for (int i = 0; i < val->elements()->size(); i++) {
 		TermDef* pdef = val->elements()->at(i)->isDef();
 		if (pdef) {
-			if (pdef->name()->value() == "name") {
+			switch (pdef->name()->symbol()) {
+			case SYM_NAME:
 				GetDefText(PlanetName, pdef, fn);
 				NewPlanetData.Name = FString(PlanetName);
-			}
-			else if (pdef->name()->value() == "map" || pdef->name()->value() == "icon") {
+				break;
+			case SYM_MAP:
+			case SYM_ICON:
 				GetDefText(MapName, pdef, fn);
 				NewPlanetData.Map = FString(MapName);
-			}
-			else if (pdef->name()->value() == "image" || pdef->name()->value() == "image_west" || pdef->name()->value() == "image_east") {
+				break;
+			case SYM_IMAGE:
+			case SYM_IMAGE_WEST:
+			case SYM_IMAGE_EAST:
 				GetDefText(ImgName, pdef, fn);
 				NewPlanetData.Image = FString(ImgName);
-			}
-			else if (pdef->name()->value() == "glow") {
+				break;
+			case SYM_GLOW:
 				GetDefText(GloName, pdef, fn);
 				NewPlanetData.Glow = FString(GloName);
-			}
-			else if (pdef->name()->value() == "gloss") {
+				break;
+			case SYM_GLOSS:
 				GetDefText(GlossName, pdef, fn);
 				NewPlanetData.Gloss = FString(GlossName);
-			}
-			else if (pdef->name()->value() == "high_res" || pdef->name()->value() == "high_res_west" || pdef->name()->value() == "high_res_east") {
+				break;
+			case SYM_HIGH_RES:
+			case SYM_HIGH_RES_WEST:
+			case SYM_HIGH_RES_EAST:
 				GetDefText(HiName, pdef, fn);
 				NewPlanetData.High = FString(HiName);
-			}
-			else if (pdef->name()->value() == "glow_high_res") {
+				break;
+			case SYM_GLOW_HIGH_RES:
 				GetDefText(GloHiName, pdef, fn);
 				NewPlanetData.GlowHigh = FString(GloHiName);
-			}
-			else if (pdef->name()->value() == "mass") {
+				break;
+			case SYM_MASS:
 				GetDefNumber(Mass, pdef, fn);
 				NewPlanetData.Mass = Mass;
-			}
-			else if (pdef->name()->value() == "orbit") {
+				break;
+			case SYM_ORBIT:
 				GetDefNumber(Orbit, pdef, fn);
 				NewPlanetData.Orbit = Orbit;
-			}
-			else if (pdef->name()->value() == "retro") {
+				break;
+			case SYM_RETRO:
 				GetDefBool(Retro, pdef, fn);
 				NewPlanetData.Retro = Retro;
-			}
-			else if (pdef->name()->value() == "luminous") {
+				break;
+			case SYM_LUMINOUS:
 				GetDefBool(Lumin, pdef, fn);
 				NewPlanetData.Lumin = Lumin;
-			}
-			else if (pdef->name()->value() == "rotation") {
+				break;
+			case SYM_ROTATION:
 				GetDefNumber(Rot, pdef, fn);
 				NewPlanetData.Rot = Rot;
-			}
-			else if (pdef->name()->value() == "radius") {
+				break;
+			case SYM_RADIUS:
 				GetDefNumber(Radius, pdef, fn);
 				NewPlanetData.Radius = Radius;
-			}	
-			else if (pdef->name()->value() == "ring") {
+				break;
+			case SYM_RING:
 				GetDefText(ImgRing, pdef, fn);
 				NewPlanetData.Rings = FString(ImgRing);
-			}
-			else if (pdef->name()->value() == "minrad") {
+				break;
+			case SYM_MINRAD:
 				GetDefNumber(Minrad, pdef, fn);
 				NewPlanetData.Minrad = Minrad;
-			}
-			else if (pdef->name()->value() == "maxrad") {
+				break;
+			case SYM_MAXRAD:
 				GetDefNumber(Maxrad, pdef, fn);
 				NewPlanetData.Maxrad = Maxrad;
-			}
-			else if (pdef->name()->value() == "tscale") {
+				break;
+			case SYM_TSCALE:
 				GetDefNumber(Tscale, pdef, fn);
 				NewPlanetData.Tscale = Tscale;
-			}
-			else if (pdef->name()->value() == "tilt") {
+				break;
+			case SYM_TILT:
 				GetDefNumber(Tilt, pdef, fn);
 				NewPlanetData.Tilt = Tilt;
-			}
-			else if (pdef->name()->value() == "atmosphere") {
+				break;
+			case SYM_ATMOSPHERE: {
 				Vec3 a;
 				GetDefVec(a, pdef, fn);
 				AtmosColor = FColor(a.x, a.y, a.z, 1);
 				NewPlanetData.Atmos = AtmosColor;
+				break;
 			}
-			else if (pdef->name()->value() == "moon") {
+			case SYM_MOON:
 				if (!pdef->term() || !pdef->term()->isStruct()) {
 					UE_LOG(LogTemp, Log, TEXT("WARNING: moon struct missing in '%s'"), *FString(fn));
 				}
@@ -3118,6 +3175,7 @@ void AGameDataLoader::ParsePlanet(TermStruct* val, const char* fn)
 					ParseMoon(pdef->term()->isStruct(), fn);
 					NewPlanetData.Moon = MoonDataArray;
 				}
+				break;
 			}
 		}
 	}
@@ -3152,67 +3210,71 @@ void AGameDataLoader::ParseMoon(TermStruct* val, const char* fn)
 	for (int i = 0; i < val->elements()->size(); i++) {
 		TermDef* pdef = val->elements()->at(i)->isDef();
 		if (pdef) {
-			if (pdef->name()->value() == "name") {
+			switch (pdef->name()->symbol()) {
+			case SYM_NAME:
 				GetDefText(MoonName, pdef, fn);
 				NewMoonData.Name = FString(MoonName);
-			}
-			else if (pdef->name()->value() == "map" || pdef->name()->value() == "icon") {
+				break;
+			case SYM_MAP:
+			case SYM_ICON:
 				GetDefText(MapName, pdef, fn);
 				NewMoonData.Map = FString(MapName);
-			}
-			else if (pdef->name()->value() == "image") {
+				break;
+			case SYM_IMAGE:
 				GetDefText(ImgName, pdef, fn);
 				NewMoonData.Image = FString(ImgName);
-			}
-			else if (pdef->name()->value() == "glow") {
+				break;
+			case SYM_GLOW:
 				GetDefText(GloName, pdef, fn);
 				NewMoonData.Glow = FString(GloName);
-			}
-			else if (pdef->name()->value() == "high_res") {
+				break;
+			case SYM_HIGH_RES:
 				GetDefText(HiName, pdef, fn);
 				NewMoonData.High = FString(HiName);
-			}
-			else if (pdef->name()->value() == "glow_high_res") {
+				break;
+			case SYM_GLOW_HIGH_RES:
 				GetDefText(GloHiName, pdef, fn);
 				NewMoonData.GlowHigh = FString(GloHiName);
-			}
-			else if (pdef->name()->value() == "gloss") {
+				break;
+			case SYM_GLOSS:
 				GetDefText(GlossName, pdef, fn);
 				NewMoonData.Gloss = FString(GlossName);
-			}
-			else if (pdef->name()->value() == "mass") {
+				break;
+			case SYM_MASS:
 				GetDefNumber(Mass, pdef, fn);
 				NewMoonData.Mass = Mass;
-			}
-			else if (pdef->name()->value() == "orbit") {
+				break;
+			case SYM_ORBIT:
 				GetDefNumber(Orbit, pdef, fn);
 				NewMoonData.Orbit = Orbit;
-			}
-			else if (pdef->name()->value() == "rotation") {
+				break;
+			case SYM_ROTATION:
 				GetDefNumber(Rot, pdef, fn);
 				NewMoonData.Rot = Rot;
-			}
-			else if (pdef->name()->value() == "retro") {
+				break;
+			case SYM_RETRO:
 				GetDefBool(Retro, pdef, fn);
 				NewMoonData.Retro = Retro;
-			}
-			else if (pdef->name()->value() == "radius") {
+				break;
+			case SYM_RADIUS:
 				GetDefNumber(Radius, pdef, fn);
 				NewMoonData.Radius = Radius;
-			}
-			else if (pdef->name()->value() == "tscale") {
+				break;
+			case SYM_TSCALE:
 				GetDefNumber(Tscale, pdef, fn);
 				NewMoonData.Tscale = Tscale;
-			}
-			else if (pdef->name()->value() == "inclination") {
+				break;
+			case SYM_INCLINATION:
 				GetDefNumber(Tilt, pdef, fn);
 				NewMoonData.Tilt = Tilt;
-			}
-			else if (pdef->name()->value() == "atmosphere") {
+				break;
+			case SYM_ATMOSPHERE: {
 				Vec3 a;
 				GetDefVec(a, pdef, fn);
 				AtmosColor = FColor(a.x, a.y, a.z, 1);
 				NewMoonData.Atmos = AtmosColor;
+				break;
+			}
 			}
 		}
 	}
@@ -3245,45 +3307,47 @@ void AGameDataLoader::ParseRegion(TermStruct* val, const char* fn)
 
 		TermDef* pdef = val->elements()->at(i)->isDef();
 		if (pdef) {
-			if (pdef->name()->value() == "name") {
+			switch (pdef->name()->symbol()) {
+			case SYM_NAME:
 				GetDefText(RegionName, pdef, fn);
 				NewRegionData.Name = FString(RegionName);
-			}
+				break;
 
-			else if (pdef->name()->value() == "parent") {
+			case SYM_PARENT:
 				GetDefText(RegionParent, pdef, fn);
 				NewRegionData.Parent = FString(RegionParent);
-			}
+				break;
 
-			else if (pdef->name()->value() == "link") {
+			case SYM_LINK:
 				GetDefText(LinkName, pdef, fn);
 				if (LinkName.length() > 0) {
 					links.append(new Text(LinkName));
 					LinksName.Add(FString(LinkName));
 				}
 				NewRegionData.Link = LinksName;
-			}
+				break;
 
-			else if (pdef->name()->value() == "orbit") {
+			case SYM_ORBIT:
 				GetDefNumber(Orbit, pdef, fn);
-			}
-			else if (pdef->name()->value() == "size" || pdef->name()->value() == "radius") {
+				break;
+			case SYM_SIZE:
+			case SYM_RADIUS:
 				GetDefNumber(Size, pdef, fn);
 				NewRegionData.Size = Size;
-			}
-			else if (pdef->name()->value() == "grid") {
+				break;
+			case SYM_GRID:
 				GetDefNumber(Grid, pdef, fn);
 				NewRegionData.Grid = Grid;
-			}
-			else if (pdef->name()->value() == "inclination") {
+				break;
+			case SYM_INCLINATION:
 				GetDefNumber(Inclination, pdef, fn);
 				NewRegionData.Inclination = Inclination;
-			}
-			else if (pdef->name()->value() == "asteroids") {
+				break;
+			case SYM_ASTEROIDS:
 				GetDefNumber(Asteroids, pdef, fn);
 				NewRegionData.Asteroids = Asteroids;
-			}
-			else if (pdef->name()->value() == "type") {
+				break;
+			case SYM_TYPE:
 				GetDefText(ParentType, pdef, fn);
 
 				switch (ParentType[0]) {
@@ -3301,6 +3365,7 @@ void AGameDataLoader::ParseRegion(TermStruct* val, const char* fn)
 					break;
 				}
 				NewRegionData.Type = parent_class;
+				break;
 			}
 		}
 
@@ -3349,116 +3414,120 @@ void AGameDataLoader::ParseTerrain(TermStruct* val, const char* fn)
 		double w_chances[EWEATHER_STATE::NUM_STATES];
 
 		if (pdef) {
-			if (pdef->name()->value() == "name") {
+			switch (pdef->name()->symbol()) {
+			case SYM_NAME:
 				GetDefText(RegionName, pdef, fn);
-			}
-			else if (pdef->name()->value() == "patch" || pdef->name()->value() == "patch_texture") {
+				break;
+			case SYM_PATCH:
+			case SYM_PATCH_TEXTURE:
 				GetDefText(PatchTexture, pdef, fn);
-			}
-			else if (pdef->name()->value() == "detail_texture_0") {
+				break;
+			case SYM_DETAIL_TEXTURE_0:
 				GetDefText(NoiseTex0, pdef, fn);
-			}
-			else if (pdef->name()->value() == "detail_texture_1") {
+				break;
+			case SYM_DETAIL_TEXTURE_1:
 				GetDefText(NoiseTex1, pdef, fn);
-			}
-			else if (pdef->name()->value() == "apron") {
+				break;
+			case SYM_APRON:
 				GetDefText(ApronName, pdef, fn);
-			}
-			else if (pdef->name()->value() == "apron_texture") {
+				break;
+			case SYM_APRON_TEXTURE:
 				GetDefText(ApronTexture, pdef, fn);
-			}
-			else if (pdef->name()->value() == "water_texture") {
+				break;
+			case SYM_WATER_TEXTURE:
 				GetDefText(WaterTexture, pdef, fn);
-			}
-			else if (pdef->name()->value() == "env_texture_positive_x") {
+				break;
+			case SYM_ENV_TEXTURE_POSITIVE_X:
 				GetDefText(EnvTexturePositive_x, pdef, fn);
-			}
-			else if (pdef->name()->value() == "env_texture_negative_x") {
+				break;
+			case SYM_ENV_TEXTURE_NEGATIVE_X:
 				GetDefText(EnvTextureNegative_x, pdef, fn);
-			}
-			else if (pdef->name()->value() == "env_texture_positive_y") {
+				break;
+			case SYM_ENV_TEXTURE_POSITIVE_Y:
 				GetDefText(EnvTexturePositive_y, pdef, fn);
-			}
-			else if (pdef->name()->value() == "env_texture_negative_y") {
+				break;
+			case SYM_ENV_TEXTURE_NEGATIVE_Y:
 				GetDefText(EnvTextureNegative_y, pdef, fn);
-			}
-			else if (pdef->name()->value() == "env_texture_positive_z") {
+				break;
+			case SYM_ENV_TEXTURE_POSITIVE_Z:
 				GetDefText(EnvTexturePositive_z, pdef, fn);
-			}
-			else if (pdef->name()->value() == "env_texture_negative_z") {
+				break;
+			case SYM_ENV_TEXTURE_NEGATIVE_Z:
 				GetDefText(EnvTextureNegative_z, pdef, fn);
-			}
-			else if (pdef->name()->value() == "clouds_high") {
+				break;
+			case SYM_CLOUDS_HIGH:
 				GetDefText(CloudsHigh, pdef, fn);
-			}
-			else if (pdef->name()->value() == "shades_high") {
+				break;
+			case SYM_SHADES_HIGH:
 				GetDefText(ShadesHigh, pdef, fn);
-			}
-			else if (pdef->name()->value() == "clouds_low") {
+				break;
+			case SYM_CLOUDS_LOW:
 				GetDefText(CloudsLow, pdef, fn);
-			}
-			else if (pdef->name()->value() == "shades_low") {
+				break;
+			case SYM_SHADES_LOW:
 				GetDefText(ShadesLow, pdef, fn);
-			}
-			else if (pdef->name()->value() == "haze") {
+				break;
+			case SYM_HAZE:
 				GetDefText(HazeName, pdef, fn);
-			}
-			else if (pdef->name()->value() == "sky_color") {
+				break;
+			case SYM_SKY_COLOR:
 				GetDefText(SkyName, pdef, fn);
-			}
-			else if (pdef->name()->value() == "size" || pdef->name()->value() == "radius") {
+				break;
+			case SYM_SIZE:
+			case SYM_RADIUS:
 				GetDefNumber(size, pdef, fn);
-			}
-			else if (pdef->name()->value() == "grid") {
+				break;
+			case SYM_GRID:
 				GetDefNumber(grid, pdef, fn);
-			}
-			else if (pdef->name()->value() == "inclination") {
+				break;
+			case SYM_INCLINATION:
 				GetDefNumber(inclination, pdef, fn);
-			}
-			else if (pdef->name()->value() == "scale") {
+				break;
+			case SYM_SCALE:
 				GetDefNumber(scale, pdef, fn);
-			}
-			else if (pdef->name()->value() == "mtnscale" || pdef->name()->value() == "mtn_scale") {
+				break;
+			case SYM_MTNSCALE:
+			case SYM_MTN_SCALE:
 				GetDefNumber(mtnscale, pdef, fn);
-			}
-			else if (pdef->name()->value() == "fog_density") {
+				break;
+			case SYM_FOG_DENSITY:
 				GetDefNumber(fog_density, pdef, fn);
-			}
-			else if (pdef->name()->value() == "fog_scale") {
+				break;
+			case SYM_FOG_SCALE:
 				GetDefNumber(fog_scale, pdef, fn);
-			}
-			else if (pdef->name()->value() == "haze_fade") {
+				break;
+			case SYM_HAZE_FADE:
 				GetDefNumber(haze_fade, pdef, fn);
-			}
-			else if (pdef->name()->value() == "clouds_alt_high") {
+				break;
+			case SYM_CLOUDS_ALT_HIGH:
 				GetDefNumber(clouds_alt_high, pdef, fn);
-			}
-			else if (pdef->name()->value() == "clouds_alt_low") {
+				break;
+			case SYM_CLOUDS_ALT_LOW:
 				GetDefNumber(clouds_alt_low, pdef, fn);
-			}
-			else if (pdef->name()->value() == "weather_period") {
+				break;
+			case SYM_WEATHER_PERIOD:
 				GetDefNumber(w_period, pdef, fn);
-			}
-			else if (pdef->name()->value() == "weather_clear") {
+				break;
+			case SYM_WEATHER_CLEAR:
 				GetDefNumber(w_chances[0], pdef, fn);
-			}
-			else if (pdef->name()->value() == "weather_high_clouds") {
+				break;
+			case SYM_WEATHER_HIGH_CLOUDS:
 				GetDefNumber(w_chances[1], pdef, fn);
-			}
-			else if (pdef->name()->value() == "weather_moderate_clouds") {
+				break;
+			case SYM_WEATHER_MODERATE_CLOUDS:
 				GetDefNumber(w_chances[2], pdef, fn);
-			}
-			else if (pdef->name()->value() == "weather_overcast") {
+				break;
+			case SYM_WEATHER_OVERCAST:
 				GetDefNumber(w_chances[3], pdef, fn);
-			}
-			else if (pdef->name()->value() == "weather_fog") {
+				break;
+			case SYM_WEATHER_FOG:
 				GetDefNumber(w_chances[4], pdef, fn);
-			}
-			else if (pdef->name()->value() == "weather_storm") {
+				break;
+			case SYM_WEATHER_STORM:
 				GetDefNumber(w_chances[5], pdef, fn);
-			}
+				break;
 
-			else if (pdef->name()->value() == "layer") {
+			case SYM_LAYER:
 				if (!pdef->term() || !pdef->term()->isStruct()) {
 					Print("WARNING: terrain layer struct missing in '%s'\n", fn);
 				}
@@ -3470,6 +3539,7 @@ void AGameDataLoader::ParseTerrain(TermStruct* val, const char* fn)
 					//TermStruct* val = pdef->term()->isStruct();
 					//ParseLayer(region, val);
 				}
+				break;
 			}
 		}
 	}
@@ -3489,42 +3559,38 @@ void AGameDataLoader::LoadStarsystems()
 	FString SysPath = PathName + "*.def";
 	FFileManagerGeneric::Get().FindFiles(output, *SysPath, true, false);
 
-	for (int i = 0; i < output.Num(); i++) {
+	List<ParsedFile> content;
+	PreloadContent(ProjectPath, output, content);
 
-		FString FileName = ProjectPath;
-		FileName.Append(output[i]);
-
-		char* fn = TCHAR_TO_ANSI(*FileName);
-		UE_LOG(LogTemp, Log, TEXT("Found StarSystem: '%s'"), *FString(FileName));
+	for (int i = 0; i < content.size(); i++) {
+		const char* fn = content[i]->GetFilename();
+		UE_LOG(LogTemp, Log, TEXT("Found StarSystem: '%s'"), *FString(fn));
 
-		ParseStarSystem(fn);
+		ParseStarSystem(fn, content[i]);
 	}
+
+	content.destroy();
 }
 
 // +--------------------------------------------------------------------+
 
-void AGameDataLoader::ParseStarSystem(const char* fn)
+void AGameDataLoader::ParseStarSystem(const char* fn, ParsedFile* content)
 {
 	SSWInstance->loader->GetLoader();
 
 	FString fs = FString(ANSI_TO_TCHAR(fn));
-	FString FileString;
-	BYTE* block = 0;
-
-	if (FFileHelper::LoadFileToString(FileString, *fs, FFileHelper::EHashOptions::None))
-	{
-		UE_LOG(LogTemp, Log, TEXT("%s"), *FileString);
+	ParsedFile local;
+	if (!content) {
+		content = &local;
+		LoadParsedFile(fn, local);
 	}
 
-	SSWInstance->loader->LoadBuffer(fn, block, true);
-
-	if (!block) {
+	if (!content->IsLoaded()) {
 		UE_LOG(LogTemp, Log, TEXT("ERROR: invalid star system file '%s'"), *FString(fn));
 		return;
 	}
 
-	Parser parser(new BlockReader((const char*)block));
-	Term* term = parser.ParseTerm();
+	Term* term = content->ParseTerm();
 
 	if (!term) {
 		UE_LOG(LogTemp, Log, TEXT("ERROR: could not parse '%s'"), *FString(fn));
@@ -3555,17 +3621,18 @@ void AGameDataLoader::ParseStarSystem(const char* fn)
 	// parse the system:
 	do {
 		delete term;
-		term = parser.ParseTerm();
+		term = content->ParseTerm();
 
 		if (term) {
 			TermDef* def = term->isDef();
 			if (def) {
-				if (def->name()->value() == "name") {
+				switch (def->name()->symbol()) {
+				case SYM_NAME:
 					GetDefText(SystemName, def, fn);
 					NewStarSystem.SystemName = FString(SystemName);
-				}
+					break;
 
-				else if (def->name()->value() == "sky") {
+				case SYM_SKY:
 					if (!def->term() || !def->term()->isStruct()) {
 						Print("WARNING: sky struct missing in '%s'\n", filename);
 					}
@@ -3574,41 +3641,44 @@ void AGameDataLoader::ParseStarSystem(const char* fn)
 						for (int i = 0; i < val->elements()->size(); i++) {
 							TermDef* pdef = val->elements()->at(i)->isDef();
 							if (pdef) {
-								if (pdef->name()->value() == "poly_stars") {
+								switch (pdef->name()->symbol()) {
+								case SYM_POLY_STARS:
 									GetDefText(SkyPolyStars, pdef, fn);
 									NewStarSystem.StarSky.SkyPolyStars = FString(SkyPolyStars);
-								}
-								else if (pdef->name()->value() == "nebula") {
+									break;
+								case SYM_NEBULA:
 									GetDefText(SkyNebula, pdef, fn);
 									NewStarSystem.StarSky.SkyNebula = FString(SkyNebula);
-								}	
-								else if (pdef->name()->value() == "haze") {
+									break;
+								case SYM_HAZE:
 									GetDefText(SkyHaze, pdef, fn);
 									NewStarSystem.StarSky.SkyHaze = FString(SkyHaze);
+									break;
 								}
 							}
 						}
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "stars") {
+				case SYM_STARS:
 					GetDefNumber(SkyStars, def, fn);
 					NewStarSystem.SkyStars = SkyStars;
-				}
+					break;
 
-				else if (def->name()->value() == "ambient") {
+				case SYM_AMBIENT: {
 					Vec3 a;
 					GetDefVec(a, def, fn);
 					AmbientColor = FColor((BYTE)a.x, (BYTE)a.y, (BYTE)a.z, 1);
 					NewStarSystem.AmbientColor = AmbientColor;
+					break;
 				}
 
-				else if (def->name()->value() == "dust") {
+				case SYM_DUST:
 					GetDefNumber(SkyDust, def, fn);
 					NewStarSystem.SkyDust = SkyDust;
-				}
+					break;
 
-				else if (def->name()->value() == "star") {
+				case SYM_STAR:
 					if (!def->term() || !def->term()->isStruct()) {
 						Print("WARNING: star struct missing in '%s'\n", fn);
 					}
@@ -3616,9 +3686,9 @@ void AGameDataLoader::ParseStarSystem(const char* fn)
 						ParseStar(def->term()->isStruct(), fn);
 						NewStarSystem.Star = StarDataArray;
 					}
-				}
+					break;
 				
-				else if (def->name()->value() == "region") {
+				case SYM_REGION:
 					if (!def->term() || !def->term()->isStruct()) {
 						Print("WARNING: region struct missing in '%s'\n", fn);
 					}
@@ -3626,9 +3696,9 @@ void AGameDataLoader::ParseStarSystem(const char* fn)
 						ParseRegion(def->term()->isStruct(), fn);
 						NewStarSystem.Region = RegionDataArray;
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "terrain") {
+				case SYM_TERRAIN:
 					if (!def->term() || !def->term()->isStruct()) {
 						Print("WARNING: terrain struct missing in '%s'\n", fn);
 					}
@@ -3636,6 +3706,7 @@ void AGameDataLoader::ParseStarSystem(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseTerrain(val);
 					}
+					break;
 				}
 				FName RowName = FName(FString(SystemName));
 
@@ -3646,7 +3717,6 @@ void AGameDataLoader::ParseStarSystem(const char* fn)
 	} while (term);
 	// define our data table struct
 	
-	SSWInstance->loader->ReleaseBuffer(block);
 }
 
 // +-------------------------------------------------------------------+
@@ -3664,14 +3734,13 @@ void AGameDataLoader::LoadCombatRoster()
 	FString Path = PathName + "*.def";
 	FFileManagerGeneric::Get().FindFiles(output, *Path, true, false);
 
+	// order of battle files are streamed, not preloaded as terms:
 	for (int i = 0; i < output.Num(); i++) {
 
 		FString FileName = ProjectPath;
 		FileName.Append(output[i]);
 
-		char* fn = TCHAR_TO_ANSI(*FileName);
-
-		LoadOrderOfBattle(fn, -1);
+		LoadOrderOfBattle(TCHAR_TO_ANSI(*FileName), -1);
 	}
 }
 
@@ -3688,15 +3757,13 @@ void AGameDataLoader::LoadShipDesigns()
 	FString Path = PathName + "*.def";
 	FFileManagerGeneric::Get().FindFiles(output, *Path, true, false);
 
-	for (int i = 0; i < output.Num(); i++) {
+	List<ParsedFile> content;
+	PreloadContent(ProjectPath, output, content);
 
-		FString FileName = ProjectPath;
-		FileName.Append(output[i]);
-
-		char* fn = TCHAR_TO_ANSI(*FileName);
+	for (int i = 0; i < content.size(); i++)
+		LoadShipDesign(content[i]->GetFilename(), content[i]);
 
-		LoadShipDesign(fn);
-	}
+	content.destroy();
 }
 
 void AGameDataLoader::LoadSystemDesignsFromDT() {
@@ -3740,242 +3807,241 @@ void AGameDataLoader::LoadSystemDesigns()
 	LoadSystemDesign(fn);
 }
 
-void AGameDataLoader::LoadOrderOfBattle(const char* fn, int team)
-{
-	UE_LOG(LogTemp, Log, TEXT("Loading Order of Battle Data: %s"), *FString(fn));
+// +-------------------------------------------------------------------+
 
-	SSWInstance->loader->GetLoader();
-	SSWInstance->loader->SetDataPath(fn);
+// Order of battle files are streamed rather than parsed into terms.
+// Each group struct is bound field by field into an FS_CombatGroup,
+// and its units into FS_CombatGroupUnit records, as the tokens are read:
 
-	BYTE* block = 0;
-	SSWInstance->loader->LoadBuffer(fn, block, true);
+class OOBUnitBinder : public TermBinder
+{
+public:
+	OOBUnitBinder()
+	{
+		BindText(SYM_NAME, &Name);
+		BindText(SYM_REGNUM, &Regnum);
+		BindText(SYM_REGION, &Region);
+		BindVec(SYM_LOC, &Loc);
+		BindText(SYM_TYPE, &Class);
+		BindText(SYM_DESIGN, &Design);
+		BindText(SYM_SKIN, &Skin);
+		BindNumber(SYM_COUNT, &Count);
+		BindNumber(SYM_DEAD_COUNT, &Dead);
+		BindNumber(SYM_DAMAGE, &Damage);
+		BindNumber(SYM_HEADING, &Heading);
+	}
+
+	virtual void BeginRecord()
+	{
+		Unit = FS_CombatGroupUnit();
 
-	Parser parser(new BlockReader((const char*)block));
-	Term* term = parser.ParseTerm();
+		Name = "";
+		Regnum = "";
+		Region = "";
+		Class = "";
+		Design = "";
+		Skin = "";
 
-	if (!term) {
-		return;
+		Count = 1;
+		Damage = 0;
+		Dead = 0;
+		Heading = 0;
+		Loc = Vec3(1.0e9f, 0.0f, 0.0f);
+		Fields = 0;
 	}
-	else {
-		TermText* file_type = term->isText();
-		if (!file_type || file_type->value() != "ORDER_OF_BATTLE")
-		{
-			UE_LOG(LogTemp, Log, TEXT("Invalid Order of Battle File: %s"), *FString(fn));
-			return;
-		}
-	}
-
-	do {
-		delete term;
-		term = parser.ParseTerm();
-
-		if (term) {
-			TermDef* def = term->isDef();
-			if (def) {
-				if (def->name()->value() == "group") {
-					if (!def->term() || !def->term()->isStruct()) {
-						UE_LOG(LogTemp, Log, TEXT("WARNING: group struct missing in '%s'"), *FString(fn));
-					}
-					else {
-						TermStruct* val = def->term()->isStruct();
-
-						FS_CombatGroup NewCombatGroup;
-						NewCombatUnitArray.Empty();
-
-						Text Name = "";
-						Text Type = "";
-						Text Intel = "KNOWN";
-						Text Region = "";
-						Text System = "";
-						Text ParentType = "";
-						int UnitIndex = 0;
-						int ParentId = 0;
-						int Id = 0;
-						int Iff = -1;
-						Vec3 Loc = Vec3(1.0e9f, 0.0f, 0.0f);
-
-						for (int i = 0; i < val->elements()->size(); i++)
-						{
-							NewCombatGroup.UnitIndex = 0;
-							TermDef* pdef = val->elements()->at(i)->isDef();
-
-							if (pdef->name()->value() == ("name"))
-							{
-								GetDefText(Name, pdef, fn);
-								NewCombatGroup.Name = FString(Name);
-							}
-							else if (pdef->name()->value() == ("type"))
-							{
-								GetDefText(Type, pdef, fn);
-								NewCombatGroup.Type = FString(Type);
-							}
-							else if (pdef->name()->value() == ("intel"))
-							{
-								GetDefText(Intel, pdef, fn);
-								NewCombatGroup.Intel = FString(Intel);
-							}
-							else if (pdef->name()->value() == ("region"))
-							{
-								GetDefText(Region, pdef, fn);
-								NewCombatGroup.Region = FString(Region);
-							}
-							else if (pdef->name()->value() == ("system"))
-							{
-								GetDefText(System, pdef, fn);
-								NewCombatGroup.System = FString(System);
-							}
-							else if (pdef->name()->value() == ("loc"))
-							{
-								GetDefVec(Loc, pdef, fn);
-
-								NewCombatGroup.Location.X = Loc.x;
-								NewCombatGroup.Location.Y = Loc.y;
-								NewCombatGroup.Location.Z = Loc.z;
-							}
-							else if (pdef->name()->value() == ("parent_type"))
-							{
-								GetDefText(ParentType, pdef, fn);
-								NewCombatGroup.ParentType = FString(ParentType);
-							}
-							else if (pdef->name()->value() == ("parent_id"))
-							{
-								GetDefNumber(ParentId, pdef, fn);
-								NewCombatGroup.ParentId = ParentId;
-							}
-							else if (pdef->name()->value() == ("iff"))
-							{
-								GetDefNumber(Iff, pdef, fn);
-								NewCombatGroup.Iff = Iff;
-							}
-							else if (pdef->name()->value() == ("id"))
-							{
-								GetDefNumber(Id, pdef, fn);
-								NewCombatGroup.Id = Id;
-							}
-							else if (pdef->name()->value() == ("unit_index"))
-							{
-								GetDefNumber(UnitIndex, pdef, fn);
-								NewCombatGroup.UnitIndex = UnitIndex;
-							}
 
-							else if (pdef->name()->value() == ("unit"))
-							{
-								TermStruct* UnitTerm = pdef->term()->isStruct();
-
-								NewCombatGroup.UnitIndex = UnitTerm->elements()->size();
+	virtual void EndField(Symbol key)
+	{
+		Fields++;
 
-								if (NewCombatGroup.UnitIndex > 0)
-								{
-									// Add Unit Stuff Here
+		if (key == SYM_NAME) {
+			UE_LOG(LogTemp, Log, TEXT("unit name '%s'"), *FString(Name));
+			Unit.UnitName = FString(Name);
+		}
+	}
 
-									FS_CombatGroupUnit NewCombatGroupUnit;
+	virtual void EndRecord()
+	{
+		Unit.UnitRegnum = FString(Regnum);
+		Unit.UnitRegion = FString(Region);
+		Unit.UnitLoc.X = Loc.x;
+		Unit.UnitLoc.Y = Loc.y;
+		Unit.UnitLoc.Z = Loc.z;
+		Unit.UnitClass = FString(Class);
+		Unit.UnitDesign = FString(Design);
+		Unit.UnitSkin = FString(Skin);
+		Unit.UnitCount = Count;
+		Unit.UnitDead = Dead;
+		Unit.UnitDamage = Damage;
+		Unit.UnitHeading = Heading;
+	}
+
+	FS_CombatGroupUnit Unit;
+	int Fields;
+
+	Text Name;
+	Text Regnum;
+	Text Region;
+	Text Class;
+	Text Design;
+	Text Skin;
+	int Count;
+	int Damage;
+	int Dead;
+	int Heading;
+	Vec3 Loc;
+};
 
-									UnitName = "";
-									UnitRegnum = "";
-									UnitRegion = "";
-									UnitClass = "";
-									UnitDesign = "";
-									UnitSkin = "";
+class OOBGroupBinder : public TermBinder
+{
+public:
+	OOBGroupBinder(TArray<FS_CombatGroupUnit>& units)
+		: Units(units), Complete(false)
+	{
+		BindText(SYM_NAME, &Name);
+		BindText(SYM_TYPE, &Type);
+		BindText(SYM_INTEL, &Intel);
+		BindText(SYM_REGION, &Region);
+		BindText(SYM_SYSTEM, &System);
+		BindVec(SYM_LOC, &Loc);
+		BindText(SYM_PARENT_TYPE, &ParentType);
+		BindNumber(SYM_PARENT_ID, &ParentId);
+		BindNumber(SYM_IFF, &Iff);
+		BindNumber(SYM_ID, &Id);
+		BindNumber(SYM_UNIT_INDEX, &UnitIndex);
+		BindStruct(SYM_UNIT, &UnitBinder);
+	}
+
+	virtual void BeginRecord()
+	{
+		Group = FS_CombatGroup();
+		Units.Empty();
+
+		Name = "";
+		Type = "";
+		Intel = "KNOWN";
+		Region = "";
+		System = "";
+		ParentType = "";
+		UnitIndex = 0;
+		ParentId = 0;
+		Id = 0;
+		Iff = -1;
+		Loc = Vec3(1.0e9f, 0.0f, 0.0f);
+
+		UnitBinder.Fields = 0;
+		Complete = false;
+	}
+
+	virtual void EndField(Symbol key)
+	{
+		Group.UnitIndex = 0;
+
+		switch (key) {
+		case SYM_NAME:        Group.Name = FString(Name);             break;
+		case SYM_TYPE:        Group.Type = FString(Type);             break;
+		case SYM_INTEL:       Group.Intel = FString(Intel);           break;
+		case SYM_REGION:      Group.Region = FString(Region);         break;
+		case SYM_SYSTEM:      Group.System = FString(System);         break;
+		case SYM_PARENT_TYPE: Group.ParentType = FString(ParentType); break;
+		case SYM_PARENT_ID:   Group.ParentId = ParentId;              break;
+		case SYM_IFF:         Group.Iff = Iff;                        break;
+		case SYM_ID:          Group.Id = Id;                          break;
+		case SYM_UNIT_INDEX:  Group.UnitIndex = UnitIndex;            break;
+
+		case SYM_LOC:
+			Group.Location.X = Loc.x;
+			Group.Location.Y = Loc.y;
+			Group.Location.Z = Loc.z;
+			break;
+
+		case SYM_UNIT:
+			Group.UnitIndex = UnitBinder.Fields;
+
+			if (UnitBinder.Fields > 0)
+				Units.Add(UnitBinder.Unit);
+
+			Group.Unit = Units;
+			UnitBinder.Fields = 0;
+			break;
+		}
+	}
 
-									UnitCount = 1;
-									UnitDamage = 0;
-									UnitDead = 0;
-									UnitHeading = 0;
-									UnitLoc = Vec3(1.0e9f, 0.0f, 0.0f);
+	virtual void EndRecord()
+	{
+		Complete = true;
+	}
+
+	FS_CombatGroup Group;
+	TArray<FS_CombatGroupUnit>& Units;
+	OOBUnitBinder UnitBinder;
+	bool Complete;
+
+	Text Name;
+	Text Type;
+	Text Intel;
+	Text Region;
+	Text System;
+	Text ParentType;
+	int UnitIndex;
+	int ParentId;
+	int Id;
+	int Iff;
+	Vec3 Loc;
+};
 
-									for (int UnitIdx = 0; UnitIdx < NewCombatGroup.UnitIndex; UnitIdx++)
-									{
-										pdef = UnitTerm->elements()->at(UnitIdx)->isDef();
+void AGameDataLoader::LoadOrderOfBattle(const char* fn, int team)
+{
+	UE_LOG(LogTemp, Log, TEXT("Loading Order of Battle Data: %s"), *FString(fn));
 
+	SSWInstance->loader->GetLoader();
+	SSWInstance->loader->SetDataPath(fn);
 
-										if (pdef->name()->value() == "name") {
-											GetDefText(UnitName, pdef, fn);
-											UE_LOG(LogTemp, Log, TEXT("unit name '%s'"), *FString(UnitName));
-											NewCombatGroupUnit.UnitName = FString(UnitName);
-										}
-										else if (pdef->name()->value() == "regnum") {
-											GetDefText(UnitRegnum, pdef, fn);
-										}
-										else if (pdef->name()->value() == "region") {
-											GetDefText(UnitRegion, pdef, fn);
-										}
-										else if (pdef->name()->value() == "loc") {
-											GetDefVec(UnitLoc, pdef, fn);
-										}
-										else if (pdef->name()->value() == "type") {
-											//char typestr[32];
-											GetDefText(UnitClass, pdef, fn);
-											//UnitClass = ShipDesign::ClassForName(typestr);
-										}
-										else if (pdef->name()->value() == "design") {
-											GetDefText(UnitDesign, pdef, fn);
-										}
-										else if (pdef->name()->value() == "skin") {
-											GetDefText(UnitSkin, pdef, fn);
-										}
-										else if (pdef->name()->value() == "count") {
-											GetDefNumber(UnitCount, pdef, fn);
-										}
-										else if (pdef->name()->value() == "dead_count") {
-											GetDefNumber(UnitDead, pdef, fn);
-										}
-										else if (pdef->name()->value() == "damage") {
-											GetDefNumber(UnitDamage, pdef, fn);
-										}
-										else if (pdef->name()->value() == "heading") {
-											GetDefNumber(UnitHeading, pdef, fn);
-										}
+	MappedFile file;
+	if (!LoadContentFile(fn, file))
+		return;
 
+	TermStream stream(new BlockReader(file.GetData(), file.GetSize()));
 
-										NewCombatGroupUnit.UnitRegnum = FString(UnitRegnum);
-										NewCombatGroupUnit.UnitRegion = FString(UnitRegion);
-										NewCombatGroupUnit.UnitLoc.X = UnitLoc.x;
-										NewCombatGroupUnit.UnitLoc.Y = UnitLoc.y;
-										NewCombatGroupUnit.UnitLoc.Z = UnitLoc.z;
-										NewCombatGroupUnit.UnitClass = FString(UnitClass);
-										NewCombatGroupUnit.UnitDesign = FString(UnitDesign);
-										NewCombatGroupUnit.UnitSkin = FString(UnitSkin);
-										NewCombatGroupUnit.UnitCount = UnitCount;
-										NewCombatGroupUnit.UnitDead = UnitDead;
-										NewCombatGroupUnit.UnitDamage = UnitDamage;
-										NewCombatGroupUnit.UnitHeading = UnitHeading;
-									}
+	if (!stream.ParseFileType("ORDER_OF_BATTLE")) {
+		UE_LOG(LogTemp, Log, TEXT("Invalid Order of Battle File: %s"), *FString(fn));
+		return;
+	}
 
-									NewCombatUnitArray.Add(NewCombatGroupUnit);
-								}
-								NewCombatGroup.Unit = NewCombatUnitArray;
-							}
+	OOBGroupBinder group(NewCombatUnitArray);
+	TermBinder     oob(fn);
 
-							FName RowName = FName(GetOrdinal(Id) + " " + FString(Name) + " " + +" " + FString(GetNameFromType(FString(Type))));
-							// call AddRow to insert the record
+	oob.BindStruct(SYM_GROUP, &group);
 
-							if (Iff > 0) {
-								CombatGroupDataTable->AddRow(RowName, NewCombatGroup);
-							}
-							CombatGroupData = NewCombatGroup;
+	while (stream.ParseTerm(oob)) {
+		if (group.Complete) {
+			FName RowName = FName(GetOrdinal(group.Id) + " " + FString(group.Name) + " " + +" " + FString(GetNameFromType(FString(group.Type))));
+			// call AddRow to insert the record
 
-						}  /// iff == team?
-					}    // group-struct
-				}          // group
-			}           // def
-		}             // term
-	} while (term);
-	SSWInstance->loader->ReleaseBuffer(block);
+			if (group.Iff > 0) {
+				CombatGroupDataTable->AddRow(RowName, group.Group);
+			}
+			CombatGroupData = group.Group;
+			group.Complete = false;
+		}
+	}
 }
 
 void
-AGameDataLoader::LoadShipDesign(const char* fn)
+AGameDataLoader::LoadShipDesign(const char* fn, ParsedFile* content)
 {
 	UE_LOG(LogTemp, Log, TEXT("Loading Ship Design Data: %s"), *FString(filename));
 
 	SSWInstance->loader->GetLoader();
 	SSWInstance->loader->SetDataPath(fn);
 
-	BYTE* block = 0;
-	SSWInstance->loader->LoadBuffer(fn, block, true);
+	ParsedFile local;
+	if (!content) {
+		content = &local;
+		LoadParsedFile(fn, local);
+	}
 
-	Parser parser(new BlockReader((const char*)block));
-	Term* term = parser.ParseTerm();
+	Term* term = content->ParseTerm();
 
 	if (!term) {
 		return;
@@ -4074,20 +4140,21 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 	// parse the system:
 	do {
 		delete term;
-		term = parser.ParseTerm();
+		term = content->ParseTerm();
 
 		if (term) {
 			TermDef* def = term->isDef();
 			if (def) {
-				if (def->name()->value() == "name") {
+				switch (def->name()->symbol()) {
+				case SYM_NAME:
 					GetDefText(ShipName, def, fn);	
 					NewShipDesign.ShipName = FString(ShipName);	
-				}
-				else if (def->name()->value() == "display_name") {
+					break;
+				case SYM_DISPLAY_NAME:
 					GetDefText(DisplayName, def, fn);
 					NewShipDesign.DisplayName = FString(DisplayName);
-				}
-				else if (def->name()->value() == "class") {
+					break;
+				case SYM_CLASS:
 					GetDefText(ShipClass, def, fn);
 					NewShipDesign.ShipClass = FString(ShipClass);
 
@@ -4103,204 +4170,205 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 					NewShipDesign.RepairAuto = repair_auto;
 					NewShipDesign.RepairScreen = repair_screen;
 					NewShipDesign.WepScreen = wep_screen;
-				}
+					break;
 
-				else if (def->name()->value() == "description") {
+				case SYM_DESCRIPTION:
 					GetDefText(Description, def, fn);
 					NewShipDesign.Description = FString(Description);
-				}
-				else if (def->name()->value() == "abrv") {
+					break;
+				case SYM_ABRV:
 					GetDefText(Abrv, def, fn);
 					NewShipDesign.Abrv = FString(Abrv);
-				}
+					break;
 
-				else if (def->name()->value() == "pcs") {
+				case SYM_PCS:
 					GetDefNumber(pcs, def, fn);
 					NewShipDesign.PCS = pcs;
-				}
-				else if (def->name()->value() == "acs") {
+					break;
+				case SYM_ACS:
 					GetDefNumber(acs, def, fn);
 					NewShipDesign.ACS = acs;
 
-				}
-				else if (def->name()->value() == "detec") {
+					break;
+				case SYM_DETEC:
 					GetDefNumber(detet, def, fn);
 					NewShipDesign.Detet = detet;
-				}
-				else if (def->name()->value() == "scale") {
+					break;
+				case SYM_SCALE:
 					GetDefNumber(scale, def, fn);
 					NewShipDesign.Scale = scale;
-				}
-				else if (def->name()->value() == "explosion_scale") {
+					break;
+				case SYM_EXPLOSION_SCALE:
 					GetDefNumber(explosion_scale, def, fn);
 					NewShipDesign.ExplosionScale = explosion_scale;
-				}
-				else if (def->name()->value() == "mass") {
+					break;
+				case SYM_MASS:
 					GetDefNumber(mass, def, fn);
 					NewShipDesign.Mass = mass;
-				}
+					break;
 
-				else if (def->name()->value() == "vlimit") {
+				case SYM_VLIMIT:
 					GetDefNumber(vlimit, def, fn);
 					NewShipDesign.Vlimit = vlimit;
-				}
-				else if (def->name()->value() == "agility") {
+					break;
+				case SYM_AGILITY:
 					GetDefNumber(agility, def, fn);
 					NewShipDesign.Agility = agility;
-				}
-				else if (def->name()->value() == "air_factor") {
+					break;
+				case SYM_AIR_FACTOR:
 					GetDefNumber(air_factor, def, fn);
 					NewShipDesign.AirFactor = air_factor;
-				}
-				else if (def->name()->value() == "roll_rate") {
+					break;
+				case SYM_ROLL_RATE:
 					GetDefNumber(roll_rate, def, fn);
 					NewShipDesign.RollRate = roll_rate;
-				}
-				else if (def->name()->value() == "pitch_rate") {
+					break;
+				case SYM_PITCH_RATE:
 					GetDefNumber(pitch_rate, def, fn);
 					NewShipDesign.PitchRate = pitch_rate;
 
-				}
-				else if (def->name()->value() == "yaw_rate") {
+					break;
+				case SYM_YAW_RATE:
 					GetDefNumber(yaw_rate, def, fn);
 					NewShipDesign.YawRate = yaw_rate;
-				}
-				else if (def->name()->value() == "trans_x") {
+					break;
+				case SYM_TRANS_X:
 					GetDefNumber(trans_x, def, fn);
 					NewShipDesign.Trans.X = trans_x;
-				}
-				else if (def->name()->value() == "trans_y") {
+					break;
+				case SYM_TRANS_Y:
 					GetDefNumber(trans_y, def, fn);
 					NewShipDesign.Trans.Y = trans_y;
-				}
-				else if (def->name()->value() == "trans_z") {
+					break;
+				case SYM_TRANS_Z:
 					GetDefNumber(trans_z, def, fn);
 					NewShipDesign.Trans.Z = trans_z;
-				}
-				else if (def->name()->value() == "turn_bank") {
+					break;
+				case SYM_TURN_BANK:
 					GetDefNumber(turn_bank, def, fn);
 					NewShipDesign.TurnBank = turn_bank;
-				}
-				else if (def->name()->value() == "cockpit_scale") {
+					break;
+				case SYM_COCKPIT_SCALE:
 					GetDefNumber(cockpit_scale, def, fn);
 					NewShipDesign.CockpitScale = cockpit_scale;
-				}
-				else if (def->name()->value() == "auto_roll") {
+					break;
+				case SYM_AUTO_ROLL:
 					GetDefNumber(auto_roll, def, fn);
 					NewShipDesign.AutoRoll = auto_roll;
-				}
-				else if (def->name()->value() == "CL") {
+					break;
+				case SYM_CL:
 					GetDefNumber(CL, def, fn);
 					NewShipDesign.CL = CL;
-				}
-				else if (def->name()->value() == "CD") {
+					break;
+				case SYM_CD:
 					GetDefNumber(CD, def, fn);
 					NewShipDesign.CD = CD;
-				}
-				else if (def->name()->value() == "stall") {
+					break;
+				case SYM_STALL:
 					GetDefNumber(stall, def, fn);
 					NewShipDesign.Stall = stall;
-				}
-				else if (def->name()->value() == "prep_time") {
+					break;
+				case SYM_PREP_TIME:
 					GetDefNumber(prep_time, def, fn);
 					NewShipDesign.PrepTime = prep_time;
-				}
-				else if (def->name()->value() == "avoid_time") {
+					break;
+				case SYM_AVOID_TIME:
 					GetDefNumber(avoid_time, def, fn);
 					NewShipDesign.AvoidTime = avoid_time;
-				}
-				else if (def->name()->value() == "avoid_fighter") {
+					break;
+				case SYM_AVOID_FIGHTER:
 					GetDefNumber(avoid_fighter, def, fn);
 					NewShipDesign.AvoidFighter = avoid_fighter;
-				}
-				else if (def->name()->value() == "avoid_strike") {
+					break;
+				case SYM_AVOID_STRIKE:
 					GetDefNumber(avoid_strike, def, fn);
 					NewShipDesign.AvoidStrike = avoid_strike;
-				}
-				else if (def->name()->value() == "avoid_target") {
+					break;
+				case SYM_AVOID_TARGET:
 					GetDefNumber(avoid_target, def, fn);
 					NewShipDesign.AvoidTarget = avoid_target;
-				}
-				else if (def->name()->value() == "commit_range") {
+					break;
+				case SYM_COMMIT_RANGE:
 					GetDefNumber(commit_range, def, fn);
 					NewShipDesign.CommitRange = commit_range;
-				}
-				else if (def->name()->value() == "splash_radius") {
+					break;
+				case SYM_SPLASH_RADIUS:
 					GetDefNumber(splash_radius, def, fn);
 					NewShipDesign.SplashRadius = splash_radius;
-				}
-				else if (def->name()->value() == "scuttle") {
+					break;
+				case SYM_SCUTTLE:
 					GetDefNumber(scuttle, def, fn);
 					NewShipDesign.Scuttle = scuttle;
-				}
-				else if (def->name()->value() == "repair_speed") {
+					break;
+				case SYM_REPAIR_SPEED:
 					GetDefNumber(repair_speed, def, fn);
 					NewShipDesign.RepairSpeed = repair_speed;
-				}
-				else if (def->name()->value() == "repair_teams") {
+					break;
+				case SYM_REPAIR_TEAMS:
 					GetDefNumber(repair_teams, def, fn);
 					NewShipDesign.RepairTeams = repair_teams;
-				}
-				else if (def->name()->value() == "cockpit_model") {
+					break;
+				case SYM_COCKPIT_MODEL:
 					GetDefText(CockpitName, def, fn);
 					NewShipDesign.CockpitName = FString(CockpitName);
-				}
+					break;
 
-				else if (def->name()->value() == "model" || def->name()->value() == "detail_0") {
+				case SYM_MODEL:
+				case SYM_DETAIL_0:
 					GetDefText(DetailName0, def, fn);
 					NewShipDesign.DetailName0 = FString(DetailName0);
 					//detail[0].append(new Text(detail_name));
-				}
+					break;
 
-				else if (def->name()->value() == "detail_1") {
+				case SYM_DETAIL_1:
 					GetDefText(DetailName1, def, fn);
 					NewShipDesign.DetailName1 = FString(DetailName1);
 					//detail[1].append(new Text(detail_name));
-				}
+					break;
 
-				else if (def->name()->value() == "detail_2") {
+				case SYM_DETAIL_2:
 					GetDefText(DetailName2, def, fn);
 					NewShipDesign.DetailName2 = FString(DetailName2);
 					//detail[2].append(new Text(detail_name));
-				}
+					break;
 
-				else if (def->name()->value() == "detail_3") {
+				case SYM_DETAIL_3:
 					GetDefText(DetailName3, def, fn);
 					NewShipDesign.DetailName3 = FString(DetailName3);
 					//detail[3].append(new Text(detail_name));
-				}
+					break;
 
-				else if (def->name()->value() == "spin") {
+				case SYM_SPIN:
 					GetDefVec(spin, def, fn);
 					NewShipDesign.Spin= FVector(spin.x, spin.y, spin.z);
 					//spin_rates.append(new Point(spin));
-				}
+					break;
 
-				else if (def->name()->value() == "offset_0") {
+				case SYM_OFFSET_0:
 					GetDefVec(off_loc, def, fn);	
 					NewShipDesign.Offset[0] = FVector(off_loc.x, off_loc.y, off_loc.z);
 					//offset[0].append(new Point(off_loc));
-				}
+					break;
 
-				else if (def->name()->value() == "offset_1") {
+				case SYM_OFFSET_1:
 					GetDefVec(off_loc, def, fn);
 					NewShipDesign.Offset[1] = FVector(off_loc.x, off_loc.y, off_loc.z);
 					//offset[1].append(new Point(off_loc));
-				}
+					break;
 
-				else if (def->name()->value() == "offset_2") {
+				case SYM_OFFSET_2:
 					GetDefVec(off_loc, def, fn);
 					NewShipDesign.Offset[2] = FVector(off_loc.x, off_loc.y, off_loc.z);
 					//offset[2].append(new Point(off_loc));
-				}
+					break;
 
-				else if (def->name()->value() == "offset_3") {
+				case SYM_OFFSET_3:
 					GetDefVec(off_loc, def, fn);
 					NewShipDesign.Offset[3] = FVector(off_loc.x, off_loc.y, off_loc.z);
 					//offset[3].append(new Point(off_loc));
-				}
+					break;
 
-				else if (def->name()->value() == "beauty") {
+				case SYM_BEAUTY:
 					if (def->term() && def->term()->isArray()) {
 						GetDefVec(BeautyCam, def, fn);
 
@@ -4319,84 +4387,67 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						//DataLoader* loader = DataLoader::GetLoader();
 						//loader->LoadBitmap(beauty_name, beauty);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "hud_icon") {
+				case SYM_HUD_ICON:
 					GetDefText(HudIconName, def, fn);
 					NewShipDesign.HudIconName = FString(HudIconName);
 					//DataLoader* loader = DataLoader::GetLoader();
 					//loader->LoadBitmap(hud_icon_name, hud_icon);
-				}
+					break;
 
-				else if (def->name()->value() == "feature_0") {
+				case SYM_FEATURE_0:
 					GetDefNumber(feature_size[0], def, fn);
 					NewShipDesign.FeatureSize[0] = feature_size[0];
-				}
+					break;
 
-				else if (def->name()->value() == "feature_1") {
+				case SYM_FEATURE_1:
 					GetDefNumber(feature_size[1], def, fn);
 					NewShipDesign.FeatureSize[1] = feature_size[1];
 	
-				}
+					break;
 
-				else if (def->name()->value() == "feature_2") {
+				case SYM_FEATURE_2:
 					GetDefNumber(feature_size[2], def, fn);
 					NewShipDesign.FeatureSize[2] = feature_size[2];
 
-				}
+					break;
 
-				else if (def->name()->value() == "feature_3") {
+				case SYM_FEATURE_3:
 					GetDefNumber(feature_size[3], def, fn);
 					NewShipDesign.FeatureSize[3] = feature_size[3];
 
-				}
-				else if (def->name()->value() == "class") {
-					GetDefText(ShipClass, def, fn);
-					NewShipDesign.ShipClass = FString(ShipClass);
-
-					ShipType = ClassForName(ShipClass);
-
-					if (ShipType <= (int) UShip::LCA) {
-						repair_auto = false;
-						repair_screen = false;
-						wep_screen = false;
-					}
-
-					NewShipDesign.ShipType = ShipType;
-					NewShipDesign.RepairAuto = repair_auto;
-					NewShipDesign.RepairScreen = repair_screen;
-					NewShipDesign.WepScreen = wep_screen;
-				}
+					break;
 
-				else if (def->name()->value() == "emcon_1") {
+				case SYM_EMCON_1:
 					GetDefNumber(e_factor[0], def, fn);
 					NewShipDesign.EFactor[0] = e_factor[0];
-				}
+					break;
 
-				else if (def->name()->value() == "emcon_2") {
+				case SYM_EMCON_2:
 					GetDefNumber(e_factor[1], def, fn);
 					NewShipDesign.EFactor[1] = e_factor[1];
-				}
+					break;
 
-				else if (def->name()->value() == "emcon_3") {
+				case SYM_EMCON_3:
 					GetDefNumber(e_factor[2], def, fn);
 					NewShipDesign.EFactor[2] = e_factor[2];
-				}
+					break;
 
-				else if (def->name()->value() == "chase") {
+				case SYM_CHASE:
 					GetDefVec(chase_vec, def, fn);
 					chase_vec *= (float)scale;
 					NewShipDesign.ChaseVec = FVector(chase_vec.x, chase_vec.y, chase_vec.z);
-				}
+					break;
 
-				else if (def->name()->value() == "bridge") {
+				case SYM_BRIDGE:
 					GetDefVec(bridge_vec, def, fn);
 
 					bridge_vec *= (float)scale;
 					NewShipDesign.BridgeVec = FVector(bridge_vec.x, bridge_vec.y, bridge_vec.z);
-				}
+					break;
 
-				else if (def->name()->value() == "power") {
+				case SYM_POWER:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: power source struct missing in '%s'"), *FString(fn));
 
@@ -4404,9 +4455,10 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 					else {
 						ParsePower(def->term()->isStruct(), fn);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "main_drive" || def->name()->value() == "drive") {
+				case SYM_MAIN_DRIVE:
+				case SYM_DRIVE:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: main drive struct missing in '%s'"), *FString(fn));
 					}
@@ -4414,9 +4466,10 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseDrive(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "quantum" || def->name()->value() == "quantum_drive") {
+				case SYM_QUANTUM:
+				case SYM_QUANTUM_DRIVE:
 					if (!def->term() || !def->term()->isStruct()) {	
 						UE_LOG(LogTemp, Log, TEXT("WARNING: quantum_drive struct missing in '%s'"), *FString(fn)); 
 					}
@@ -4424,9 +4477,10 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseQuantumDrive(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "sender" || def->name()->value() == "farcaster") {
+				case SYM_SENDER:
+				case SYM_FARCASTER:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: farcaster struct missing in '%s'"), *FString(fn));
 					}
@@ -4434,9 +4488,9 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseFarcaster(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "thruster") {
+				case SYM_THRUSTER:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: thruster struct missing in '%s'"), *FString(fn));
 					}
@@ -4444,9 +4498,9 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseThruster(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "navlight") {
+				case SYM_NAVLIGHT:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: navlight struct missing in '%s'"), *FString(fn));
 					}
@@ -4454,9 +4508,9 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseNavlight(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "flightdeck") {
+				case SYM_FLIGHTDECK:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: flightdeck struct missing in '%s'"), *FString(fn));
 					}
@@ -4464,9 +4518,9 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseFlightDeck(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "gear") {
+				case SYM_GEAR:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: landing gear struct missing in '%s'"), *FString(fn));
 					}
@@ -4474,9 +4528,9 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseLandingGear(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "weapon") {
+				case SYM_WEAPON:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: weapon struct missing in '%s'"), *FString(fn));
 					}
@@ -4484,9 +4538,9 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseWeapon(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "hardpoint") {
+				case SYM_HARDPOINT:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: hardpoint struct missing in '%s'"), *FString(fn));
 					}
@@ -4494,9 +4548,9 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseHardPoint(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "loadout") {
+				case SYM_LOADOUT:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: loadout struct missing in '%s'"), *FString(fn));
 					}
@@ -4504,9 +4558,9 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseLoadout(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "decoy") {
+				case SYM_DECOY:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: decoy struct missing in '%s'"), *FString(fn));
 					}
@@ -4514,9 +4568,9 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseWeapon(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "probe") {
+				case SYM_PROBE:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: probe struct missing in '%s'"), *FString(fn));
 					}
@@ -4524,9 +4578,9 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseWeapon(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "sensor") {
+				case SYM_SENSOR:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: sensor struct missing in '%s'"), *FString(fn));
 					}
@@ -4534,9 +4588,9 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseSensor(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "nav") {
+				case SYM_NAV:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: nav struct missing in '%s'"), *FString(fn));
 					}
@@ -4544,9 +4598,9 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseNavsys(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "computer") {
+				case SYM_COMPUTER:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: computer struct missing in '%s'"), *FString(fn));
 					}
@@ -4554,9 +4608,9 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseComputer(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "shield") {
+				case SYM_SHIELD:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: shield struct missing in '%s'"), *FString(fn));
 					}
@@ -4564,9 +4618,9 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseShield(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "death_spiral") {
+				case SYM_DEATH_SPIRAL:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: death spiral struct missing in '%s'"), *FString(fn));
 					}
@@ -4574,9 +4628,9 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseDeathSpiral(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "map") {
+				case SYM_MAP:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: map struct missing in '%s'"), *FString(fn));
 					}
@@ -4584,9 +4638,9 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseMap(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "squadron") {
+				case SYM_SQUADRON:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: squadron struct missing in '%s'"), *FString(fn));
 					}
@@ -4594,9 +4648,9 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseSquadron(val);
 					}
-				}
+					break;
 
-				else if (def->name()->value() == "skin") {
+				case SYM_SKIN:
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: skin struct missing in '%s'"), *FString(fn));
 					}
@@ -4604,10 +4658,11 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 						TermStruct* val = def->term()->isStruct();
 						//ParseSkin(val);
 					}
-				}
+					break;
 
-				else {
+				default:
 					UE_LOG(LogTemp, Log, TEXT("WARNING: unknown parameter '%s'"), *FString(fn));
+					break;
 				}
 				FName RowName = FName(FString(ShipName));
 
@@ -4619,7 +4674,6 @@ AGameDataLoader::LoadShipDesign(const char* fn)
 	} while (term);
 	// define our data table struct
 
-	SSWInstance->loader->ReleaseBuffer(block);
 }
 
 // +--------------------------------------------------------------------+
@@ -6751,11 +6805,10 @@ AGameDataLoader::LoadSystemDesign(const char* fn)
 	SSWInstance->loader->GetLoader();
 	SSWInstance->loader->SetDataPath(fn);
 
-	BYTE* block = 0;
-	SSWInstance->loader->LoadBuffer(fn, block, true);
+	ParsedFile content;
+	LoadParsedFile(fn, content);
 
-	Parser parser(new BlockReader((const char*)block));
-	Term* term = parser.ParseTerm();
+	Term* term = content.ParseTerm();
 
 	if (!term) {
 		return;
@@ -6784,52 +6837,54 @@ AGameDataLoader::LoadSystemDesign(const char* fn)
 
 	do {
 		delete term;
-		term = parser.ParseTerm();
+		term = content.ParseTerm();
 
 		if (term) {
 			TermDef* def = term->isDef();
 			if (def) {
-				if (def->name()->value() == "system") {
+				if (def->name()->symbol() == SYM_SYSTEM) {
 					TermStruct* val = def->term()->isStruct();
 					NewComponentArray.Empty();
 					for (int i = 0; i < val->elements()->size(); i++) {	
 						TermDef* pdef = val->elements()->at(i)->isDef();
 						if (pdef) {
-							if (pdef->name()->value() == "name") {
+							if (pdef->name()->symbol() == SYM_NAME) {
 								GetDefText(SystemName, pdef, fn);
 								NewSystemDesign.Name = FString(SystemName);
 							}
 
-							else if (pdef->name()->value() == ("component")) {
+							else if (pdef->name()->symbol() == SYM_COMPONENT) {
 								
 								FS_ComponentDesign NewComponentDesign;
 								TermStruct* val2 = pdef->term()->isStruct();
 								for (int idx = 0; idx < val2->elements()->size(); idx++) {
 									TermDef* pdef2 = val2->elements()->at(idx)->isDef();
 									if (pdef2) {
-										if (pdef2->name()->value() == "name") {
+										switch (pdef2->name()->symbol()) {
+										case SYM_NAME:
 											GetDefText(ComponentName, pdef2, fn);
 											NewComponentDesign.Name = FString(ComponentName);
-										}
-										else if (pdef2->name()->value() == "abrv") {
+											break;
+										case SYM_ABRV:
 											GetDefText(ComponentAbrv, pdef2, fn);
 											NewComponentDesign.Abrv = FString(ComponentAbrv);
-										}
-										else if (pdef2->name()->value() == "repair_time") {
+											break;
+										case SYM_REPAIR_TIME:
 											GetDefNumber(ComponentRepairTime, pdef2, fn);
 											NewComponentDesign.RepairTime = ComponentRepairTime;
-										}
-										else if (pdef2->name()->value() == "replace_time") {
+											break;
+										case SYM_REPLACE_TIME:
 											GetDefNumber(ComponentReplaceTime, pdef2, fn);
 											NewComponentDesign.ReplaceTime = ComponentReplaceTime;
-										}
-										else if (pdef2->name()->value() == "spares") {
+											break;
+										case SYM_SPARES:
 											GetDefNumber(ComponentSpares, pdef2, fn);
 											NewComponentDesign.Spares = ComponentSpares;
-										}
-										else if (pdef2->name()->value() == "affects") {
+											break;
+										case SYM_AFFECTS:
 											GetDefNumber(ComponentAffects, pdef2, fn);
 											NewComponentDesign.Affects = ComponentAffects;
+											break;
 										}
 									}	
 								}
@@ -6848,7 +6903,6 @@ AGameDataLoader::LoadSystemDesign(const char* fn)
 		}
 	} while (term);
 
-	SSWInstance->loader->ReleaseBuffer(block);
 }
 
 int
@@ -7093,7 +7147,12 @@ AGameDataLoader::GetCombatant(const char* cname)
 Text
 AGameDataLoader::GetContentBundleText(const char* key) const
 {
-	return ContentValues.Find(key, Text(key));
+	Text value;
+
+	if (ContentValues.Lookup(key, value))
+		return value;
+
+	return Text(key);
 }
 
 // +--------------------------------------------------------------------+
@@ -7105,17 +7164,16 @@ AGameDataLoader::LoadContentBundle() {
 
 	char* fn = TCHAR_TO_ANSI(*ProjectPath);
 	
-	SSWInstance->loader->GetLoader(); 
 	if (SSWInstance->loader->GetLoader()) {
-		BYTE* buffer = 0;
-		BYTE* block = 0;
-		SSWInstance->loader->LoadBuffer(fn, buffer, true, true);
-		if (buffer && *buffer) {
+		MappedFile file;
+		LoadContentFile(fn, file, true);
+
+		const char* p = file.GetData();
+		if (p && *p) {
 
 			Text key;
 			Text val;
 
-			char* p = (char*)buffer;
 			int   s = 0;
 
 			key = "";
@@ -7128,7 +7186,9 @@ AGameDataLoader::LoadContentBundle() {
 				else if (*p == '\n' || *p == '\r') {
 					if (key != ""  && val != "") {
 						ContentValues.Insert(Text(key).trim(), Text(val).trim());
-						UE_LOG(LogTemp, Log, TEXT("Inserted- %s: %s"), *FString(Text(key).trim()), *FString(Text(val).trim()));
+
+						if (VerboseContentDump)
+							UE_LOG(LogTemp, Log, TEXT("Inserted- %s: %s"), *FString(Text(key).trim()), *FString(Text(val).trim()));
 					}
 					s = 0;
 					
@@ -7161,13 +7221,88 @@ AGameDataLoader::LoadContentBundle() {
 				p++;
 				
 			}
-			SSWInstance->loader->ReleaseBuffer(buffer);
 		}
 	}
 }
 
 // +--------------------------------------------------------------------+
 
+bool
+AGameDataLoader::LoadContentFile(const char* fn, MappedFile& file, bool optional)
+{
+	SSWInstance->loader->MapFile(fn, file, optional);
+
+	if (!file.IsOpen())
+		return false;
+
+	if (VerboseContentDump)
+		UE_LOG(LogTemp, Log, TEXT("%s:\n%s"), *FString(fn), *FString(file.GetData()));
+
+	return true;
+}
+
+bool
+AGameDataLoader::LoadParsedFile(const char* fn, ParsedFile& content)
+{
+	MappedFile file;
+
+	if (!LoadContentFile(fn, file)) {
+		content.Clear();
+		return false;
+	}
+
+	// unchanged files come straight back from the content cache:
+	if (ContentCache.Load(fn, file.GetData(), file.GetSize(), content))
+		return true;
+
+	content.Parse(file.GetData(), file.GetSize());
+	ContentCache.Store(fn, file.GetData(), file.GetSize(), content);
+
+	return content.IsLoaded();
+}
+
+// +--------------------------------------------------------------------+
+
+struct PreloadBatch
+{
+	AGameDataLoader*        loader;
+	const List<ParsedFile>* content;
+	int                     first;
+};
+
+static void PreloadTask(void* param, int index)
+{
+	PreloadBatch* batch = (PreloadBatch*)param;
+	ParsedFile*   file = batch->content->at(batch->first + index);
+
+	batch->loader->LoadParsedFile(file->GetFilename(), *file);
+}
+
+void
+AGameDataLoader::PreloadContent(const FString& Path, const TArray<FString>& Names, List<ParsedFile>& content)
+{
+	content.reserve(content.size() + Names.Num());
+
+	int first = content.size();
+
+	for (int i = 0; i < Names.Num(); i++) {
+		FString FileName = Path;
+		FileName.Append(Names[i]);
+
+		content.append(new ParsedFile(TCHAR_TO_ANSI(*FileName)));
+	}
+
+	// each task only writes to its own ParsedFile:
+	PreloadBatch batch;
+	batch.loader  = this;
+	batch.content = &content;
+	batch.first   = first;
+
+	LoadPool.Run(content.size() - first, PreloadTask, &batch);
+}
+
+// +--------------------------------------------------------------------+
+
 void AGameDataLoader::LoadForms()
 {
 	UE_LOG(LogTemp, Log, TEXT("AGameDataLoader::LoadForms()"));
@@ -7181,29 +7316,29 @@ void AGameDataLoader::LoadForms()
 	FString Path = PathName + "*.frm";
 	FFileManagerGeneric::Get().FindFiles(output, *Path, true, false);
 
-	for (int i = 0; i < output.Num(); i++) {
-
-		FString FileName = ProjectPath;
-		FileName.Append(output[i]);
+	List<ParsedFile> content;
+	PreloadContent(ProjectPath, output, content);
 
-		char* fn = TCHAR_TO_ANSI(*FileName);
+	for (int i = 0; i < content.size(); i++)
+		LoadForm(content[i]->GetFilename(), content[i]);
 
-		LoadForm(fn);
-	}
+	content.destroy();
 }
 
 
 void
-AGameDataLoader::LoadForm(const char* fn)
+AGameDataLoader::LoadForm(const char* fn, ParsedFile* content)
 {
 	SSWInstance->loader->GetLoader();
 	SSWInstance->loader->SetDataPath(fn);
 
-	BYTE* block = 0;
-	SSWInstance->loader->LoadBuffer(fn, block, true);
+	ParsedFile local;
+	if (!content) {
+		content = &local;
+		LoadParsedFile(fn, local);
+	}
 
-	Parser parser(new BlockReader((const char*)block));
-	Term* term = parser.ParseTerm();
+	Term* term = content->ParseTerm();
 
 	if (!term) {
 		return;
@@ -7224,12 +7359,12 @@ AGameDataLoader::LoadForm(const char* fn)
 
 	do {
 		delete term;
-		term = parser.ParseTerm();
+		term = content->ParseTerm();
 
 		if (term) {
 			TermDef* def = term->isDef();
 			if (def) {
-				if (def->name()->value() == "form") {
+				if (def->name()->symbol() == SYM_FORM) {
 
 					if (!def->term() || !def->term()->isStruct()) {
 						UE_LOG(LogTemp, Log, TEXT("WARNING: form structure missing in '%s'"), *FString(fn));
@@ -7242,113 +7377,126 @@ AGameDataLoader::LoadForm(const char* fn)
 
 							TermDef* pdef = val->elements()->at(i)->isDef();
 							if (pdef) {
-								if (pdef->name()->value() == "text" ||
-									pdef->name()->value() == "caption") {
+								switch (pdef->name()->symbol()) {
+								case SYM_TEXT:
+								case SYM_CAPTION:
 
 									GetDefText(buf, pdef, fn);
 									NewForm.Caption = FString(buf);
-								}
+									break;
 
-								else if (pdef->name()->value() == "id") {
+								case SYM_ID: {
 									DWORD id;
 									GetDefNumber(id, pdef, fn);
 									NewForm.Id = id;
+									break;
 								}
 
-								else if (pdef->name()->value() == "pid") {
+								case SYM_PID: {
 									DWORD id;
 									GetDefNumber(id, pdef, fn);
 									NewForm.PId = id;
+									break;
 								}
 
-								else if (pdef->name()->value() == "rect") {
+								case SYM_RECT: {
 									Rect r;
 									GetDefRect(r, pdef, fn);
 									NewForm.Rect.X = r.x;
 									NewForm.Rect.Y = r.y; 
 									NewForm.Rect.Z = r.h; 
 									NewForm.Rect.W = r.w;
+									break;
 								}
 
-								else if (pdef->name()->value() == "font") {
+								case SYM_FONT:
 									GetDefText(buf, pdef, fn);
 									NewForm.Font = FString(buf);
 									
-								}
+									break;
 
-								else if (pdef->name()->value() == "back_color") {
+								case SYM_BACK_COLOR: {
 									Vec3 c;
 									GetDefVec(c, pdef, fn);
 									NewForm.BackColor = FColor(c.x, c.y, c.z, 1);
+									break;
 								}
 
-								else if (pdef->name()->value() == "base_color") {
+								case SYM_BASE_COLOR: {
 									Vec3 c;
 									GetDefVec(c, pdef, fn);
 									NewForm.BaseColor = FColor(c.x, c.y, c.z, 1);
+									break;
 								}
 
-								else if (pdef->name()->value() == "fore_color") {
+								case SYM_FORE_COLOR: {
 									Vec3 c;
 									GetDefVec(c, pdef, fn);
 									NewForm.ForeColor = FColor(c.x, c.y, c.z, 1);
+									break;
 								}
 
-								else if (pdef->name()->value() == "margins") {
+								case SYM_MARGINS: {
 									Insets m;
 									GetDefInsets(m, pdef, fn);
 									NewForm.Insets.X = m.left;
 									NewForm.Insets.Y = m.right;
 									NewForm.Insets.Z = m.top;
 									NewForm.Insets.W = m.bottom;
+									break;
 								}
 
-								else if (pdef->name()->value() == "text_insets") {
+								case SYM_TEXT_INSETS: {
 									Insets t;
 									GetDefInsets(t, pdef, fn);
 									NewForm.TextInsets.X = t.left;
 									NewForm.TextInsets.Y = t.right;
 									NewForm.TextInsets.Z = t.top;
 									NewForm.TextInsets.W = t.bottom;
+									break;
 								}
 
-								else if (pdef->name()->value() == "cell_insets") {
+								case SYM_CELL_INSETS: {
 									Insets c;
 									GetDefInsets(c, pdef, fn);
 									NewForm.CellInsets.X = c.left;
 									NewForm.CellInsets.Y = c.right;
 									NewForm.CellInsets.Z = c.top;
 									NewForm.CellInsets.W = c.bottom;
+									break;
 								}
 
-								else if (pdef->name()->value() == "cells") {
+								case SYM_CELLS: {
 									Rect c;
 									GetDefRect(c, pdef, fn);
 									NewForm.Cells.X = c.x;
 									NewForm.Cells.Y = c.y;
 									NewForm.Cells.Z = c.h;
 									NewForm.Cells.W = c.w;
+									break;
 								}
 
-								else if (pdef->name()->value() == "texture") {
+								case SYM_TEXTURE:
 									GetDefText(buf, pdef, fn);
 									NewForm.Texture = FString(buf);
-								}
+									break;
 
-								else if (pdef->name()->value() == "transparent") {
+								case SYM_TRANSPARENT: {
 									bool b;
 									GetDefBool(b, pdef, fn);
 									NewForm.Transparent = b;	
+									break;
 								}
 
-								else if (pdef->name()->value() == "style") {
+								case SYM_STYLE: {
 									DWORD s;
 									GetDefNumber(s, pdef, fn);
 									NewForm.Style = s;
+									break;
 								}
 
-								else if (pdef->name()->value() == "align" ||
-									pdef->name()->value() == "text_align") {
+								case SYM_ALIGN:
+								case SYM_TEXT_ALIGN: {
 									DWORD a = DT_LEFT;
 
 									if (GetDefText(buf, pdef, fn)) {
@@ -7366,11 +7514,12 @@ AGameDataLoader::LoadForm(const char* fn)
 										NewForm.Align = a;
 									}
 
+									break;
 								}
 
 								// layout constraints:
 
-								else if (pdef->name()->value() == "layout") {
+								case SYM_LAYOUT:
 
 									if (!pdef->term() || !pdef->term()->isStruct()) {
 										UE_LOG(LogTemp, Log, TEXT("WARNING: layout structure missing in '%s'"), *FString(fn));
@@ -7379,11 +7528,11 @@ AGameDataLoader::LoadForm(const char* fn)
 										TermStruct* lval = pdef->term()->isStruct();
 										//ParseLayoutDef(&form->layout, val);
 									}
-								}
+									break;
 
 								// controls:
 
-								else if (pdef->name()->value() == "defctrl") {
+								case SYM_DEFCTRL:
 
 									if (!pdef->term() || !pdef->term()->isStruct()) {
 										UE_LOG(LogTemp, Log, TEXT("WARNING: defctrl structure missing in '%s'"), *FString(fn));
@@ -7392,9 +7541,9 @@ AGameDataLoader::LoadForm(const char* fn)
 										TermStruct* dval = pdef->term()->isStruct();
 										//ParseCtrlDef(&form->defctrl, val);
 									}
-								}
+									break;
 
-								else if (pdef->name()->value() == "ctrl") {
+								case SYM_CTRL:
 
 									if (!pdef->term() || !pdef->term()->isStruct()) {
 										UE_LOG(LogTemp, Log, TEXT("WARNING: ctrl structure missing in '%s'"), *FString(fn));
@@ -7408,6 +7557,7 @@ AGameDataLoader::LoadForm(const char* fn)
 
 										//ParseCtrlDef(ctrl, val);
 									}
+									break;
 								}
 
 								// end of controls.
@@ -7422,6 +7572,5 @@ AGameDataLoader::LoadForm(const char* fn)
 		}
 	} while (term);
 
-	SSWInstance->loader->ReleaseBuffer(block);
 	//SSWInstance->loader->SetDataPath(0);
 }
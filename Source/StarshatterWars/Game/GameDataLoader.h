@@ -23,9 +23,15 @@
 #include "../Foundation/Text.h"
 #include "../Foundation/Term.h"
 #include "../Foundation/GameLoader.h"
+#include "../Foundation/ParsedFile.h"
+#include "../Foundation/TaskPool.h"
+#include "../Foundation/TermCache.h"
+#include "../Foundation/TermBinder.h"
 
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "Misc/Parse.h"
+#include "Misc/CommandLine.h"
 #include "Engine/DataTable.h"
 #include "HAL/FileManagerGeneric.h"
 #include "GameStructs.h"
@@ -100,7 +106,7 @@ public:
 
 	void LoadStarsystems();
 
-	void ParseStarSystem(const char* FileName);
+	void ParseStarSystem(const char* FileName, ParsedFile* content = 0);
 
 	void LoadCombatRoster();
 	void LoadShipDesigns();
@@ -119,7 +125,7 @@ public:
 
 	void ParseCombatUnit();
 
-	void LoadShipDesign(const char* fn);
+	void LoadShipDesign(const char* fn, ParsedFile* content = 0);
 	
 	// Ship Components
 	void ParsePower(TermStruct* val, const char* fn);
@@ -145,7 +151,27 @@ public:
 
 	void LoadContentBundle();
 	void LoadForms();
-	void LoadForm(const char* fname);
+	void LoadForm(const char* fname, ParsedFile* content = 0);
+
+	// Single read of a content file; dumps it to the log when
+	// VerboseContentDump is set (-SSWDumpContent on the command line).
+	// A missing optional file is not reported as an error:
+	bool LoadContentFile(const char* fname, MappedFile& file, bool optional = false);
+	bool VerboseContentDump;
+
+	// Reads and parses a directory's worth of files on a TaskPool of
+	// LoadThreads threads (-SSWLoadThreads=N, zero for one per core).
+	// The files come back in the order they were named, so interpreting
+	// them one by one matches the serial path.  The pool is kept for
+	// the loader's lifetime, so every directory reuses its workers:
+	bool LoadParsedFile(const char* fname, ParsedFile& content);
+	void PreloadContent(const FString& Path, const TArray<FString>& Names, List<ParsedFile>& content);
+	int  LoadThreads;
+	TaskPool LoadPool;
+
+	// Binary cache of parsed files under Saved/ContentCache, keyed by
+	// source path and a hash of the text (-SSWNoContentCache to bypass it):
+	TermCache ContentCache;
 	bool IsContentBundleLoaded() const { return !ContentValues.IsEmpty(); }
 
 	Text              ContentName;
@@ -13,6 +13,8 @@
 
 
 #include "Physical.h"
+#include "PhysicalBatch.h"
+#include "../Foundation/Random.h"
 //#include "Graphic.h"
 //#include "Light.h"
 //#include "Director.h"
@@ -24,7 +26,7 @@ double   UPhysical::sub_frame = 1.0 / 60.0;
 
 static const double GRAV = 6.673e-11;
 
-inline double Random() { return rand() - 16384; }
+inline double Random() { return RandomInt() - 16384; }
 
 // +--------------------------------------------------------------------+
 
@@ -84,6 +86,9 @@ UPhysical::UPhysical()
 	alpha = 0.0f;
 	stall = 0.0f;
 
+	batch = 0;
+	batch_handle = -1;
+
 	strcpy_s(name, "unknown object");
 }
 
@@ -144,6 +149,9 @@ UPhysical::UPhysical(const char* n, int t) {
 	alpha = 0.0f;
 	stall = 0.0f;
 
+	batch = 0;
+	batch_handle = -1;
+
 	strncpy_s(name, n, NAMELEN - 1);
 	name[NAMELEN - 1] = 0;
 }
@@ -160,6 +168,8 @@ UPhysical::~UPhysical()
 	// we own the director
 	//delete dir;
 	dir = 0;
+
+	LeaveBatch();
 }
 
 // +--------------------------------------------------------------------+
@@ -167,6 +177,11 @@ UPhysical::~UPhysical()
 void
 UPhysical::ExecFrame(double s)
 {
+	// keep where the step started, for RenderLocation().  objects in
+	// a batch save it when they push their state instead:
+	if (cam && !batch)
+		SaveRenderState();
+
 	/*Point orig_velocity = Velocity();
 	arcade_velocity = Point();
 
@@ -365,6 +380,19 @@ UPhysical::AeroFrame(double s)
 	}*/
 }
 
+Point
+UPhysical::RenderLocation(double alpha) const
+{
+	Point loc = Location();
+
+	if (alpha <= 0) return render_loc;
+	if (alpha >= 1) return loc;
+
+	return render_loc + (loc - render_loc) * alpha;
+}
+
+// +--------------------------------------------------------------------+
+
 double
 UPhysical::GetDensity() const
 {
@@ -535,6 +563,102 @@ UPhysical::LinearFrame(double seconds)
 
 // +--------------------------------------------------------------------+
 
+void
+UPhysical::JoinBatch(PhysicalBatch* b)
+{
+	if (batch == b)
+		return;
+
+	LeaveBatch();
+
+	if (b) {
+		batch = b;
+		batch_handle = batch->Add();
+	}
+}
+
+void
+UPhysical::LeaveBatch()
+{
+	if (batch)
+		batch->Remove(batch_handle);
+
+	batch = 0;
+	batch_handle = -1;
+}
+
+void
+UPhysical::PushBatchState()
+{
+	if (!batch || !cam)
+		return;
+
+	int h = batch_handle;
+
+	SaveRenderState();
+
+	// main engine and lateral thrusters, in world space.  the batch
+	// holds this fixed for the frame, as the heading only moves a
+	// few degrees between pulls:
+	Point thrust_acc = cam->vpn() * ((thrust + trans_y) / mass) +
+	                   cam->vrt() * (trans_x / mass) +
+	                   cam->vup() * (trans_z / mass);
+
+	batch->SetLocation(h, cam->Pos());
+	batch->SetVelocity(h, velocity);
+	batch->SetThrust(h, thrust_acc);
+	batch->SetDrag(h, drag);
+	batch->SetGravity(h, g_accel);
+	batch->SetPrimary(h, primary_loc, primary_mass);
+	batch->SetStraight(h, straight);
+
+	batch->SetRotation(h, dr, dp, dy);
+	batch->SetAngularAccel(h, dr_acc, dp_acc, dy_acc);
+	batch->SetAngularDrag(h, dr_drg, dp_drg, dy_drg);
+}
+
+void
+UPhysical::PullBatchState(double seconds)
+{
+	if (!batch || !cam)
+		return;
+
+	int    h = batch_handle;
+	double r, p, y;
+
+	velocity = batch->GetVelocity(h);
+	cam->MoveTo(batch->GetLocation(h));
+
+	if (!straight) {
+		batch->GetRotation(h, r, p, y);
+		dr = (float)r;
+		dp = (float)p;
+		dy = (float)y;
+
+		batch->GetAttitude(h, r, p, y);
+		roll = (float)r;
+		pitch = (float)p;
+		yaw = (float)y;
+
+		// vibration once per frame rather than once per slice:
+		if (shake > 0.01) {
+			vibration = Point(Random(), Random(), Random());
+			vibration.Normalize();
+			vibration *= (float)(shake * seconds);
+
+			shake *= (float)exp(-1.5 * seconds);
+		}
+		else {
+			vibration.x = vibration.y = vibration.z = 0.0f;
+			shake = 0.0f;
+		}
+
+		cam->Aim(roll, pitch, yaw);
+	}
+}
+
+// +--------------------------------------------------------------------+
+
 void
 UPhysical::CalcFlightPath()
 {
@@ -25,6 +25,7 @@
 class Director;
 class Graphic;
 class Light;
+class PhysicalBatch;
 
 // +--------------------------------------------------------------------+
 
@@ -59,6 +60,16 @@ public:
 
 	virtual void      CalcFlightPath();
 
+	// batch integration, for regions that move many objects at once.
+	// push before PhysicalBatch::Integrate(), pull after it.  every
+	// SimRegion keeps one batch for the ships inside it:
+	void              JoinBatch(PhysicalBatch* b);
+	void              LeaveBatch();
+	void              PushBatchState();
+	void              PullBatchState(double seconds);
+	PhysicalBatch*    GetBatch()       const { return batch; }
+	int               GetBatchHandle() const { return batch_handle; }
+
 	virtual void      MoveTo(const Point& new_loc);
 	virtual void      TranslateBy(const Point& ref);
 	virtual void      ApplyForce(const Point& force);
@@ -85,6 +96,11 @@ public:
 	const char* Name()      const { return name; }
 
 	Point             Location()  const { return cam->Pos(); }
+
+	// drawing between fixed steps: the location at the start of the
+	// latest step, blended toward the current one by alpha (0..1):
+	void              SaveRenderState() { render_loc = Location(); }
+	Point             RenderLocation(double alpha) const;
 	Point             Heading()   const { return cam->vpn(); }
 	Point             LiftLine()  const { return cam->vup(); }
 	Point             BeamLine()  const { return cam->vrt(); }
@@ -152,6 +168,7 @@ protected:
 
 	// position, velocity, and acceleration:
 	UCamera*          cam;
+	Point             render_loc;
 	Point             velocity;
 	Point             arcade_velocity;
 	Point             accel;
@@ -204,6 +221,10 @@ protected:
 	// AI or human controller:
 	Director* dir;        // null implies an autonomous object
 
+	// batch integration:
+	PhysicalBatch*    batch;
+	int               batch_handle;
+
 	static double sub_frame;
 	
 	
@@ -0,0 +1,451 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Game
+	FILE:         PhysicalBatch.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Structure of arrays integrator for physical objects
+*/
+
+
+#include "PhysicalBatch.h"
+#include <math.h>
+#include <string.h>
+
+// +--------------------------------------------------------------------+
+
+static const double GRAV = 6.673e-11;
+
+template <class T>
+static void Resize(T*& a, int n, int extent)
+{
+	T* b = new T[extent];
+
+	if (a && n > 0)
+		memcpy(b, a, n * sizeof(T));
+
+	delete [] a;
+	a = b;
+}
+
+template <class T>
+static void Release(T*& a)
+{
+	delete [] a;
+	a = 0;
+}
+
+// +--------------------------------------------------------------------+
+
+PhysicalBatch::PhysicalBatch()
+	: count(0), extent(0), slot_of(0), handle_of(0), free_handle(-1), num_handles(0),
+	  px(0), py(0), pz(0), vx(0), vy(0), vz(0),
+	  ax(0), ay(0), az(0), drag(0),
+	  gx(0), gy(0), gz(0), gm(0), g_accel(0),
+	  dr(0), dp(0), dy(0), dr_acc(0), dp_acc(0), dy_acc(0),
+	  dr_drg(0), dp_drg(0), dy_drg(0), straight(0),
+	  roll(0), pitch(0), yaw(0)
+{
+	for (int k = 0; k < 2; k++)
+		for (int j = 0; j < 4; j++)
+			decay[k][j] = 0;
+}
+
+PhysicalBatch::~PhysicalBatch()
+{
+	Release(slot_of);  Release(handle_of);
+	Release(px);       Release(py);       Release(pz);
+	Release(vx);       Release(vy);       Release(vz);
+	Release(ax);       Release(ay);       Release(az);       Release(drag);
+	Release(gx);       Release(gy);       Release(gz);       Release(gm);
+	Release(g_accel);
+	Release(dr);       Release(dp);       Release(dy);
+	Release(dr_acc);   Release(dp_acc);   Release(dy_acc);
+	Release(dr_drg);   Release(dp_drg);   Release(dy_drg);
+	Release(straight);
+	Release(roll);     Release(pitch);    Release(yaw);
+
+	for (int k = 0; k < 2; k++)
+		for (int j = 0; j < 4; j++)
+			Release(decay[k][j]);
+}
+
+// +--------------------------------------------------------------------+
+
+void
+PhysicalBatch::Grow()
+{
+	int n = extent ? extent * 2 : 64;
+
+	Resize(slot_of, num_handles, n);
+	Resize(handle_of, count, n);
+
+	Resize(px, count, n);       Resize(py, count, n);       Resize(pz, count, n);
+	Resize(vx, count, n);       Resize(vy, count, n);       Resize(vz, count, n);
+	Resize(ax, count, n);       Resize(ay, count, n);       Resize(az, count, n);
+	Resize(drag, count, n);
+	Resize(gx, count, n);       Resize(gy, count, n);       Resize(gz, count, n);
+	Resize(gm, count, n);       Resize(g_accel, count, n);
+	Resize(dr, count, n);       Resize(dp, count, n);       Resize(dy, count, n);
+	Resize(dr_acc, count, n);   Resize(dp_acc, count, n);   Resize(dy_acc, count, n);
+	Resize(dr_drg, count, n);   Resize(dp_drg, count, n);   Resize(dy_drg, count, n);
+	Resize(straight, count, n);
+	Resize(roll, count, n);     Resize(pitch, count, n);    Resize(yaw, count, n);
+
+	// the decay factors are scratch, rebuilt by every Integrate():
+	for (int k = 0; k < 2; k++)
+		for (int j = 0; j < 4; j++)
+			Resize(decay[k][j], 0, n);
+
+	extent = n;
+}
+
+// +--------------------------------------------------------------------+
+
+int
+PhysicalBatch::Add()
+{
+	if (count >= extent)
+		Grow();
+
+	// free handles are chained through slot_of, encoded as -2 - next
+	// so that every free entry is negative:
+	int handle = free_handle;
+
+	if (handle >= 0)
+		free_handle = -2 - slot_of[handle];
+	else
+		handle = num_handles++;
+
+	int i = count++;
+
+	slot_of[handle] = i;
+	handle_of[i]    = handle;
+
+	px[i] = py[i] = pz[i] = 0;
+	vx[i] = vy[i] = vz[i] = 0;
+	ax[i] = ay[i] = az[i] = 0;
+	gx[i] = gy[i] = gz[i] = 0;
+	gm[i] = 0;
+
+	drag[i]    = 0.0f;
+	g_accel[i] = 0.0f;
+
+	dr[i]     = dp[i]     = dy[i]     = 0.0f;
+	dr_acc[i] = dp_acc[i] = dy_acc[i] = 0.0f;
+	dr_drg[i] = dp_drg[i] = dy_drg[i] = 0.0f;
+	roll[i]   = pitch[i]  = yaw[i]    = 0.0f;
+
+	straight[i] = false;
+
+	return handle;
+}
+
+void
+PhysicalBatch::Remove(int handle)
+{
+	if (!IsValid(handle))
+		return;
+
+	// move the last body into the hole, keeping the arrays dense:
+	int i    = slot_of[handle];
+	int last = --count;
+
+	if (i != last) {
+		px[i] = px[last];           py[i] = py[last];           pz[i] = pz[last];
+		vx[i] = vx[last];           vy[i] = vy[last];           vz[i] = vz[last];
+		ax[i] = ax[last];           ay[i] = ay[last];           az[i] = az[last];
+		drag[i] = drag[last];
+		gx[i] = gx[last];           gy[i] = gy[last];           gz[i] = gz[last];
+		gm[i] = gm[last];           g_accel[i] = g_accel[last];
+		dr[i] = dr[last];           dp[i] = dp[last];           dy[i] = dy[last];
+		dr_acc[i] = dr_acc[last];   dp_acc[i] = dp_acc[last];   dy_acc[i] = dy_acc[last];
+		dr_drg[i] = dr_drg[last];   dp_drg[i] = dp_drg[last];   dy_drg[i] = dy_drg[last];
+		straight[i] = straight[last];
+		roll[i] = roll[last];       pitch[i] = pitch[last];     yaw[i] = yaw[last];
+
+		handle_of[i] = handle_of[last];
+		slot_of[handle_of[i]] = i;
+	}
+
+	slot_of[handle] = -2 - free_handle;
+	free_handle     = handle;
+}
+
+void
+PhysicalBatch::Clear()
+{
+	count       = 0;
+	num_handles = 0;
+	free_handle = -1;
+}
+
+bool
+PhysicalBatch::IsValid(int handle) const
+{
+	return handle >= 0 && handle < num_handles && slot_of[handle] >= 0;
+}
+
+// +--------------------------------------------------------------------+
+
+void
+PhysicalBatch::SetLocation(int handle, const Point& loc)
+{
+	if (!IsValid(handle)) return;
+	int i = slot_of[handle];
+
+	px[i] = loc.x;
+	py[i] = loc.y;
+	pz[i] = loc.z;
+}
+
+Point
+PhysicalBatch::GetLocation(int handle) const
+{
+	if (!IsValid(handle)) return Point();
+	int i = slot_of[handle];
+
+	return Point(px[i], py[i], pz[i]);
+}
+
+void
+PhysicalBatch::SetVelocity(int handle, const Point& vel)
+{
+	if (!IsValid(handle)) return;
+	int i = slot_of[handle];
+
+	vx[i] = vel.x;
+	vy[i] = vel.y;
+	vz[i] = vel.z;
+}
+
+Point
+PhysicalBatch::GetVelocity(int handle) const
+{
+	if (!IsValid(handle)) return Point();
+	int i = slot_of[handle];
+
+	return Point(vx[i], vy[i], vz[i]);
+}
+
+void
+PhysicalBatch::SetRotation(int handle, double r, double p, double y)
+{
+	if (!IsValid(handle)) return;
+	int i = slot_of[handle];
+
+	dr[i] = (float)r;
+	dp[i] = (float)p;
+	dy[i] = (float)y;
+}
+
+void
+PhysicalBatch::GetRotation(int handle, double& r, double& p, double& y) const
+{
+	r = p = y = 0;
+
+	if (!IsValid(handle)) return;
+	int i = slot_of[handle];
+
+	r = dr[i];
+	p = dp[i];
+	y = dy[i];
+}
+
+void
+PhysicalBatch::GetAttitude(int handle, double& r, double& p, double& y) const
+{
+	r = p = y = 0;
+
+	if (!IsValid(handle)) return;
+	int i = slot_of[handle];
+
+	r = roll[i];
+	p = pitch[i];
+	y = yaw[i];
+}
+
+// +--------------------------------------------------------------------+
+
+void
+PhysicalBatch::SetThrust(int handle, const Point& accel)
+{
+	if (!IsValid(handle)) return;
+	int i = slot_of[handle];
+
+	ax[i] = accel.x;
+	ay[i] = accel.y;
+	az[i] = accel.z;
+}
+
+void
+PhysicalBatch::SetAngularAccel(int handle, double r, double p, double y)
+{
+	if (!IsValid(handle)) return;
+	int i = slot_of[handle];
+
+	dr_acc[i] = (float)r;
+	dp_acc[i] = (float)p;
+	dy_acc[i] = (float)y;
+}
+
+void
+PhysicalBatch::SetAngularDrag(int handle, double r, double p, double y)
+{
+	if (!IsValid(handle)) return;
+	int i = slot_of[handle];
+
+	dr_drg[i] = (float)r;
+	dp_drg[i] = (float)p;
+	dy_drg[i] = (float)y;
+}
+
+void
+PhysicalBatch::SetDrag(int handle, double d)
+{
+	if (!IsValid(handle)) return;
+	drag[slot_of[handle]] = (float)d;
+}
+
+void
+PhysicalBatch::SetGravity(int handle, double g)
+{
+	if (!IsValid(handle)) return;
+	g_accel[slot_of[handle]] = (float)g;
+}
+
+void
+PhysicalBatch::SetPrimary(int handle, const Point& loc, double mass)
+{
+	if (!IsValid(handle)) return;
+	int i = slot_of[handle];
+
+	gx[i] = loc.x;
+	gy[i] = loc.y;
+	gz[i] = loc.z;
+	gm[i] = mass > 0 ? GRAV * mass : 0;
+}
+
+void
+PhysicalBatch::SetStraight(int handle, bool s)
+{
+	if (!IsValid(handle)) return;
+	straight[slot_of[handle]] = s;
+}
+
+// +--------------------------------------------------------------------+
+
+void
+PhysicalBatch::Integrate(double s, double sub_frame)
+{
+	if (count < 1 || s <= 0)
+		return;
+
+	if (sub_frame <= 0 || sub_frame > s)
+		sub_frame = s;
+
+	int    slices = (int)(s / sub_frame);
+	double rest   = s - slices * sub_frame;
+
+	// every full slice has the same length, so the exponentials are
+	// taken at most twice per body per frame instead of once per
+	// body per slice:
+	double lengths[2] = { sub_frame, rest };
+
+	for (int k = 0; k < 2; k++) {
+		double t = lengths[k];
+
+		if (t <= 0)
+			continue;
+
+		double* lin = decay[k][0];
+		double* kr  = decay[k][1];
+		double* kp  = decay[k][2];
+		double* ky  = decay[k][3];
+
+		for (int i = 0; i < count; i++) {
+			lin[i] = exp(-drag[i]   * t);
+			kr[i]  = exp(-dr_drg[i] * t);
+			kp[i]  = exp(-dp_drg[i] * t);
+			ky[i]  = exp(-dy_drg[i] * t);
+		}
+	}
+
+	memset(roll,  0, count * sizeof(float));
+	memset(pitch, 0, count * sizeof(float));
+	memset(yaw,   0, count * sizeof(float));
+
+	for (int n = 0; n < slices; n++)
+		Slice(sub_frame, 0);
+
+	if (rest > 0)
+		Slice(rest, 1);
+}
+
+// +--------------------------------------------------------------------+
+
+void
+PhysicalBatch::Slice(double t, int k)
+{
+	const double* lin = decay[k][0];
+	const double* kr  = decay[k][1];
+	const double* kp  = decay[k][2];
+	const double* ky  = decay[k][3];
+
+	// ANGULAR MOVEMENT ---------------------------
+
+	for (int i = 0; i < count; i++) {
+		if (straight[i])
+			continue;
+
+		dr[i] = (float)((dr[i] + dr_acc[i] * t) * kr[i]);
+		dp[i] = (float)((dp[i] + dp_acc[i] * t) * kp[i]);
+		dy[i] = (float)((dy[i] + dy_acc[i] * t) * ky[i]);
+
+		roll[i]  += (float)(dr[i] * t);
+		pitch[i] += (float)(dp[i] * t);
+		yaw[i]   += (float)(dy[i] * t);
+	}
+
+	// LINEAR MOVEMENT ----------------------------
+
+	for (int i = 0; i < count; i++) {
+		double x = vx[i] + ax[i] * t;
+		double y = vy[i] + ay[i] * t;
+		double z = vz[i] + az[i] * t;
+
+		// if gravity applies, attract:
+		if (gm[i] > 0) {
+			double gdx = gx[i] - px[i];
+			double gdy = gy[i] - py[i];
+			double gdz = gz[i] - pz[i];
+			double r2  = gdx * gdx + gdy * gdy + gdz * gdz;
+
+			if (r2 > 0) {
+				double f = gm[i] / (r2 * sqrt(r2)) * t;
+
+				x += gdx * f;
+				y += gdy * f;
+				z += gdz * f;
+			}
+		}
+
+		// constant gravity:
+		else {
+			y -= g_accel[i] * t;
+		}
+
+		// drag, and move by the (time-frame scaled) velocity:
+		vx[i] = x * lin[i];
+		vy[i] = y * lin[i];
+		vz[i] = z * lin[i];
+
+		px[i] += vx[i] * t;
+		py[i] += vy[i] * t;
+		pz[i] += vz[i] * t;
+	}
+}
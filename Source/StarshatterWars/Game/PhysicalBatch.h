@@ -0,0 +1,114 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Game
+	FILE:         PhysicalBatch.h
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Motion state for many physical objects, kept in parallel arrays
+	(one array per field) so a whole region can be integrated in one
+	tight loop per sub frame instead of one virtual call chain per
+	object.
+
+	Objects are named by handle.  A handle stays valid until it is
+	removed, even though the slots behind it are compacted on every
+	removal.  UPhysical::PushBatchState() copies an object's controls
+	and motion into its slot before a frame, and PullBatchState()
+	copies the result back out afterwards, so the object's own
+	accessors read the same values as the batch between frames.
+	Each SimRegion moves its ships through a batch of its own.
+
+	Within one frame the thrust vector is held fixed in world space
+	and the attitude change is accumulated as a sum of small angles
+	and applied once.  At sub frame lengths this matches the per
+	object integrator to within the rounding of the exponentials.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "../Foundation/Types.h"
+#include "../Foundation/Geometry.h"
+
+// +--------------------------------------------------------------------+
+
+class STARSHATTERWARS_API PhysicalBatch
+{
+public:
+	static const char* TYPENAME() { return "PhysicalBatch"; }
+
+	PhysicalBatch();
+	~PhysicalBatch();
+
+	int         Add();
+	void        Remove(int handle);
+	void        Clear();
+
+	int         NumBodies()             const { return count; }
+	bool        IsValid(int handle)     const;
+
+	// state:
+	void        SetLocation(int handle, const Point& loc);
+	Point       GetLocation(int handle) const;
+	void        SetVelocity(int handle, const Point& vel);
+	Point       GetVelocity(int handle) const;
+	void        SetRotation(int handle, double  r, double  p, double  y);
+	void        GetRotation(int handle, double& r, double& p, double& y) const;
+
+	// attitude change over the last call to Integrate():
+	void        GetAttitude(int handle, double& r, double& p, double& y) const;
+
+	// controls, held constant over a frame:
+	void        SetThrust(int handle, const Point& accel);
+	void        SetAngularAccel(int handle, double r, double p, double y);
+	void        SetAngularDrag(int handle, double r, double p, double y);
+	void        SetDrag(int handle, double d);
+	void        SetGravity(int handle, double g);
+	void        SetPrimary(int handle, const Point& loc, double mass);
+	void        SetStraight(int handle, bool s);
+
+	void        Integrate(double seconds, double sub_frame);
+
+private:
+	PhysicalBatch(const PhysicalBatch&);
+	PhysicalBatch& operator=(const PhysicalBatch&);
+
+	void        Grow();
+	void        Slice(double seconds, int full_slice);
+
+	int         count;
+	int         extent;
+
+	int*        slot_of;          // handle to slot, -1 when free
+	int*        handle_of;        // slot to handle
+	int         free_handle;      // head of the free handle chain
+	int         num_handles;
+
+	// position and velocity:
+	double*     px;  double* py;  double* pz;
+	double*     vx;  double* vy;  double* vz;
+
+	// world space thrust acceleration and linear drag:
+	double*     ax;  double* ay;  double* az;
+	float*      drag;
+
+	// gravitation, gm is G times the primary mass:
+	double*     gx;  double* gy;  double* gz;
+	double*     gm;
+	float*      g_accel;
+
+	// angular velocity, acceleration and drag:
+	float*      dr;      float* dp;      float* dy;
+	float*      dr_acc;  float* dp_acc;  float* dy_acc;
+	float*      dr_drg;  float* dp_drg;  float* dy_drg;
+	bool*       straight;
+
+	// attitude change over the frame:
+	float*      roll;    float* pitch;   float* yaw;
+
+	// per body decay factors for the full and the final slice:
+	double*     decay[2][4];
+};
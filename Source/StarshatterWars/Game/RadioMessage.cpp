@@ -4,6 +4,7 @@
 #include "RadioMessage.h"
 #include "Ship.h"
 #include "../Foundation/Text.h"
+#include "../Foundation/Random.h"
 
 
 RadioMessage::RadioMessage()
@@ -103,7 +104,7 @@ const char*
 RadioMessage::ActionName(int a)
 {
 	if (a == ACK) {
-		int coin = rand();
+		int coin = RandomInt();
 		if (coin < 10000)       return "Acknowledged";
 		if (coin < 17000)       return "Roger that";
 		if (coin < 20000)       return "Understood";
@@ -112,7 +113,7 @@ RadioMessage::ActionName(int a)
 	}
 
 	if (a == DISTRESS) {
-		int coin = rand();
+		int coin = RandomInt();
 		if (coin < 15000)       return "Mayday! Mayday!";
 		if (coin < 18000)       return "She's breaking up!";
 		if (coin < 21000)       return "Checking out!";
@@ -120,7 +121,7 @@ RadioMessage::ActionName(int a)
 	}
 
 	if (a == WARN_ACCIDENT) {
-		int coin = rand();
+		int coin = RandomInt();
 		if (coin < 15000)       return "Check your fire!";
 		if (coin < 18000)       return "Watch it!";
 		if (coin < 21000)       return "Hey! We're on your side!";
@@ -128,7 +129,7 @@ RadioMessage::ActionName(int a)
 	}
 
 	if (a == WARN_TARGETED) {
-		int coin = rand();
+		int coin = RandomInt();
 		if (coin < 15000)       return "Break off immediately!";
 		if (coin < 20000)       return "Buddy spike!";
 		return "Abort! Abort!";
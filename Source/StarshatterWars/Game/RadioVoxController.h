@@ -6,6 +6,7 @@
 #include "../Foundation/Types.h"
 #include "../Foundation/List.h"
 #include "../Foundation/Text.h"
+#include "../Foundation/ThreadSync.h"
 
 /**
  * 
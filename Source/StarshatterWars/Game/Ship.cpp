@@ -237,7 +237,7 @@ UShip::UShip(const char* ship_name, const char* reg_num, ShipDesign* ship_dsn, i
 	auto_repair = design->repair_auto;
 
 	while (!base_contact_id)
-		base_contact_id = rand() % 1000;
+		base_contact_id = RandomInt() % 1000;
 
 	contact_id = base_contact_id++;
 	int sys_id = 0;
@@ -891,6 +891,7 @@ void UShip::SelectDetail(double seconds)
 
 void UShip::SetRegion(SimRegion* rgn)
 {
+	USimObject::SetRegion(rgn);
 }
 
 void UShip::ExecFrame(double seconds)
@@ -1004,6 +1005,51 @@ UShip::ClassForName(const char* name)
 	return ShipDesign::ClassForName(name);
 }
 
+// +--------------------------------------------------------------------+
+
+int
+UShip::Value(int type)
+{
+	int value = 0;
+
+	switch (type) {
+	case DRONE:       value =    10; break;
+	case FIGHTER:     value =    20; break;
+	case ATTACK:      value =    40; break;
+	case LCA:         value =    50; break;
+
+	case COURIER:     value =   100; break;
+	case CARGO:       value =   100; break;
+	case CORVETTE:    value =   100; break;
+	case FREIGHTER:   value =   250; break;
+	case FRIGATE:     value =   200; break;
+	case DESTROYER:   value =   500; break;
+	case CRUISER:     value =   800; break;
+	case BATTLESHIP:  value =  1000; break;
+	case CARRIER:     value =  1500; break;
+	case DREADNAUGHT: value =  1500; break;
+
+	case STATION:     value =  2500; break;
+	case FARCASTER:   value =  5000; break;
+
+	case MINE:        value =    20; break;
+	case COMSAT:      value =   200; break;
+	case DEFSAT:      value =   300; break;
+	case SWACS:       value =   500; break;
+
+	case BUILDING:    value =   100; break;
+	case FACTORY:     value =   250; break;
+	case SAM:         value =   100; break;
+	case EWR:         value =   200; break;
+	case C3I:         value =   500; break;
+	case STARBASE:    value =  2000; break;
+
+	default:          value =   100; break;
+	}
+
+	return value;
+}
+
 Instruction* UShip::GetNextNavPoint()
 {
 	return nullptr;
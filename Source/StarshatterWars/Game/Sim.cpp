@@ -7,6 +7,7 @@
 #include "SimObject.h"
 //#include "Starshatter.h"
 #include "../Space/StarSystem.h"
+#include "../Space/OrbitalRegion.h"
 
 //#include "Contact.h"
 #include "Ship.h"
@@ -109,6 +110,10 @@ USim::USim()
 	mission = 0;
 	netgame = 0;
 	start_time = 0;
+	exec_seconds = 0;
+	step_time = 0;
+	step_alpha = 0;
+	max_steps = 64;
 
 	//Drive::Initialize();
 	//Explosion::Initialize();
@@ -118,7 +123,9 @@ USim::USim()
 	//MFD::Initialize();
 	//Asteroid::Initialize();
 
-	if (!sim)
+	// the class default object is built first, and must not stand
+	// in for the game's sim, or the real one would never tick:
+	if (!sim && !HasAnyFlags(RF_ClassDefaultObject))
 		sim = this;
 
 	UE_LOG(LogTemp, Log, TEXT("Simulation Created"));
@@ -137,6 +144,10 @@ USim::USim(MotionController* c)
 	mission = 0;
 	netgame = 0;
 	start_time = 0;
+	exec_seconds = 0;
+	step_time = 0;
+	step_alpha = 0;
+	max_steps = 64;
 
 	//Drive::Initialize();
 	//Explosion::Initialize();
@@ -146,12 +157,465 @@ USim::USim(MotionController* c)
 	//MFD::Initialize();
 	//Asteroid::Initialize();
 
-	if (!sim)
+	// the class default object is built first, and must not stand
+	// in for the game's sim, or the real one would never tick:
+	if (!sim && !HasAnyFlags(RF_ClassDefaultObject))
 		sim = this;
 
 	//cam_dir = CameraDirector::GetInstance();
 }
 
+// +--------------------------------------------------------------------+
+
+void
+USim::Tick(float DeltaTime)
+{
+	ExecFrame(DeltaTime * Game::TimeCompression());
+}
+
+bool
+USim::IsTickable() const
+{
+	// only the game's sim runs itself, not the class default object
+	// or a sim built for a test:
+	return sim == this && !HasAnyFlags(RF_ClassDefaultObject) && !regions.isEmpty();
+}
+
+void
+USim::ExecFrame(double seconds)
+{
+	if (Game::Paused())
+		return;
+
+	StepRegions(seconds);
+}
+
+// +--------------------------------------------------------------------+
+
+void
+USim::ExecRegions(double seconds, int steps)
+{
+	if (steps < 1)
+		return;
+
+	ListIter<SimRegion> iter = regions;
+	while (++iter) {
+		SimRegion* rgn = iter.value();
+
+		if (rgn->random_master != RandomStream::GetMasterSeed())
+			rgn->SeedRandom();
+	}
+
+	exec_seconds = seconds;
+
+	for (int i = 0; i < steps; i++) {
+		// a jump resolved at the last barrier may have moved the
+		// player, and the active region with it:
+		exec_list.clear();
+
+		iter.reset();
+		while (++iter) {
+			if (iter.value() != active_region)
+				exec_list.append(iter.value());
+		}
+
+		// the active region drives the scene and the player's view,
+		// so it stays on the game thread:
+		if (active_region) {
+			RandomScope random(active_region->GetRandom());
+			active_region->ExecFrame(seconds);
+		}
+
+		region_pool.Run(exec_list.size(), ExecRegionTask, this);
+
+		// step barrier:
+		MergeDeferred();
+		ResolveHyperList();
+		ResolveSplashList();
+	}
+
+	exec_list.clear();
+}
+
+void
+USim::ExecRegionTask(void* param, int index)
+{
+	USim*      s   = (USim*)param;
+	SimRegion* rgn = s->exec_list.at(index);
+
+	RandomScope random(rgn->GetRandom());
+	rgn->ExecFrame(s->exec_seconds);
+}
+
+// +--------------------------------------------------------------------+
+
+int
+USim::StepRegions(double seconds)
+{
+	double step = UPhysical::GetSubFrameLength();
+
+	if (seconds <= 0 || step <= 0)
+		return 0;
+
+	step_time += seconds;
+
+	int steps = (int)(step_time / step);
+
+	if (steps > 0) {
+		double elapsed = steps * step;
+
+		// at high time compression a slow machine cannot keep up one
+		// step per sub frame.  rather than fall further behind every
+		// frame, cover the whole elapsed time in fewer, longer steps.
+		// the sim keeps pace with the clock: the ships' batch still
+		// integrates each long step in sub frame slices, and only the
+		// per step work (collisions, jumps, splash) runs less often.
+		//
+		// background regions are not yet thinned out further by their
+		// Director; that waits on the AI port, so every region runs
+		// every step:
+		if (steps > max_steps)
+			ExecRegions(elapsed / max_steps, max_steps);
+		else
+			ExecRegions(step, steps);
+
+		step_time -= elapsed;
+	}
+
+	step_alpha = step_time / step;
+	return steps < max_steps ? steps : max_steps;
+}
+
+void
+USim::MergeDeferred()
+{
+	// walk the regions in list order, not in the order they finished,
+	// so the merged lists come out the same from run to run:
+	ListIter<SimRegion> iter = regions;
+	while (++iter) {
+		SimRegion* rgn = iter.value();
+
+		jumplist.append(rgn->hyper_queue);
+		splashlist.append(rgn->splash_queue);
+
+		rgn->hyper_queue.clear();
+		rgn->splash_queue.clear();
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+bool
+USim::ActivateRegion(SimRegion* rgn)
+{
+	if (!rgn || rgn == active_region || !regions.contains(rgn))
+		return false;
+
+	if (active_region)
+		active_region->Deactivate();
+
+	active_region = rgn;
+	star_system   = rgn->System();
+
+	active_region->Activate();
+	return true;
+}
+
+void
+USim::ResolveHyperList()
+{
+	// resolve the hyper space transitions:
+	ListIter<SimHyper> iter = jumplist;
+	while (++iter) {
+		SimHyper*  jump = iter.value();
+		UShip*     ship = jump->ship;
+		SimRegion* dest = jump->rgn;
+
+		if (!ship || !dest)
+			continue;
+
+		dest->InsertObject(ship);
+
+		if (ship->Cam())
+			ship->MoveTo(jump->loc);
+
+		// the view follows the player:
+		if (ship == GetPlayerShip())
+			ActivateRegion(dest);
+	}
+
+	jumplist.destroy();
+}
+
+void
+USim::ResolveSplashList()
+{
+	ListIter<SimSplash> iter = splashlist;
+	while (++iter) {
+		SimSplash* splash = iter.value();
+
+		if (!splash->rgn || splash->range <= 0)
+			continue;
+
+		// damage ships, falling off with distance from the blast:
+		ListIter<UShip> s_iter = splash->rgn->Ships();
+		while (++s_iter) {
+			UShip* ship = s_iter.value();
+
+			if (!ship->Cam())
+				continue;
+
+			double distance = (ship->Location() - splash->loc).length();
+
+			if (distance > 1 && distance < splash->range)
+				ship->InflictDamage(splash->damage * (1 - distance / splash->range));
+		}
+	}
+
+	splashlist.destroy();
+}
+
+// +--------------------------------------------------------------------+
+
+SimRegion::SimRegion(USim* s, const char* n, int t)
+	: sim(s), name(n), type(t), star_system(0), orbital_region(0), grid(0),
+	  terrain(0), active(false), player_ship(0), current_view(0),
+	  sim_time(0), ai_index(0)
+{
+	if (sim)
+		star_system = sim->GetStarSystem();
+
+	SeedRandom();
+}
+
+SimRegion::SimRegion(USim* s, AOrbitalRegion* rgn)
+	: sim(s), type(REAL_SPACE), star_system(0), orbital_region(rgn), grid(0),
+	  terrain(0), active(false), player_ship(0), current_view(0),
+	  sim_time(0), ai_index(0)
+{
+	if (rgn) {
+		name        = rgn->Name();
+		location    = rgn->Location();
+		star_system = rgn->System();
+
+		if (rgn->Type() == EOrbitalType::TERRAIN)
+			type = AIR_SPACE;
+	}
+	else {
+		name = "Unknown";
+	}
+
+	if (sim && !star_system)
+		star_system = sim->GetStarSystem();
+
+	SeedRandom();
+}
+
+SimRegion::~SimRegion()
+{
+	// the objects belong to the sim, but queued jumps and
+	// splashes not yet merged belong to the region:
+	hyper_queue.destroy();
+	splash_queue.destroy();
+
+	// ships may outlive the region, but not its batch, and
+	// must not keep pointing at it:
+	ListIter<UShip> iter = ships;
+	while (++iter) {
+		iter->LeaveBatch();
+		iter->SetRegion(0);
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+void
+SimRegion::Activate()
+{
+	active = true;
+}
+
+void
+SimRegion::Deactivate()
+{
+	active = false;
+}
+
+// +--------------------------------------------------------------------+
+
+void
+SimRegion::ExecFrame(double seconds)
+{
+	if (!sim)
+		return;
+
+	sim_time += (DWORD)(seconds * 1000);
+
+	UpdateShips(seconds);
+
+	if (active && !Game::Paused())
+		CollideShips();
+}
+
+void
+SimRegion::UpdateShips(double seconds)
+{
+	ListIter<UShip> iter = ships;
+	while (++iter)
+		iter->PushBatchState();
+
+	physics.Integrate(seconds, UPhysical::GetSubFrameLength());
+
+	iter.reset();
+	while (++iter) {
+		UShip* ship = iter.value();
+
+		ship->PullBatchState(seconds);
+		ship->ExecFrame(seconds);
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+enum { GRID_SHIPS };
+
+void
+SimRegion::CollideShips()
+{
+	if (ships.size() < 2)
+		return;
+
+	collision_grid.Clear();
+
+	ListIter<UShip> iter = ships;
+	while (++iter) {
+		UShip* ship = iter.value();
+
+		if (!ship->Cam() || ship->InTransition() ||
+			ship->GetFlightPhase() < UShip::ACTIVE ||
+			ship->MissionClock() < 10000 ||
+			ship->IsNetObserver())
+			continue;
+
+		collision_grid.Insert(ship, GRID_SHIPS);
+	}
+
+	// only ships that share a grid cell are tested, instead of
+	// every ship against every other ship:
+	collision_grid.FindPairs(GRID_SHIPS, GRID_SHIPS, CollideShipPair, this);
+}
+
+void
+SimRegion::CollideShipPair(UPhysical* a, UPhysical* b, void* param)
+{
+	SimRegion* rgn  = (SimRegion*)param;
+	UShip*     ship = (UShip*)a;
+	UShip*     targ = (UShip*)b;
+
+	// ignore AI fighter collisions:
+	if (ship->IsDropship() && ship != rgn->player_ship &&
+		targ->IsDropship() && targ != rgn->player_ship)
+		return;
+
+	// don't collide with own runway!
+	if (rgn->IsAirSpace() && (ship->GetCarrier() == targ || targ->GetCarrier() == ship))
+		return;
+
+	// impact:
+	if (ship->CollidesWith(*targ)) {
+		Point tv1 = targ->Velocity();
+		Point sv1 = ship->Velocity();
+
+		UPhysical::SemiElasticCollision(*ship, *targ);
+
+		Point tv2 = targ->Velocity();
+		Point sv2 = ship->Velocity();
+
+		double dvs = (sv2 - sv1).length();
+		double dvt = (tv2 - tv1).length();
+
+		if (dvs > 20) dvs *= dvs;
+		if (dvt > 20) dvt *= dvt;
+
+		ship->InflictDamage(dvs);
+		targ->InflictDamage(dvt);
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+void
+SimRegion::InsertObject(UShip* ship)
+{
+	if (!ship)
+		return;
+
+	SimRegion* orig = ship->GetRegion();
+
+	if (orig == this)
+		return;
+
+	if (orig) {
+		orig->ships.remove(ship);
+		orig->carriers.remove(ship);
+		orig->selection.remove(ship);
+	}
+
+	ships.append(ship);
+	ship->SetRegion(this);
+	ship->JoinBatch(&physics);
+}
+
+// shots, explosions, debris and asteroids are not ported yet, so
+// the region only keeps track of them:
+
+void
+SimRegion::InsertObject(Shot* shot)
+{
+	if (shot)
+		shots.append(shot);
+}
+
+void
+SimRegion::InsertObject(Explosion* explosion)
+{
+	if (explosion)
+		explosions.append(explosion);
+}
+
+void
+SimRegion::InsertObject(Debris* d)
+{
+	if (d)
+		debris.append(d);
+}
+
+void
+SimRegion::InsertObject(Asteroid* asteroid)
+{
+	if (asteroid)
+		asteroids.append(asteroid);
+}
+
+Shot*
+SimRegion::FindShotByObjID(DWORD objid)
+{
+	return 0;
+}
+
+// +--------------------------------------------------------------------+
+
+void
+SimRegion::SeedRandom()
+{
+	// mix the name into all 64 bits, so regions whose names hash
+	// close together still draw unrelated sequences:
+	random_master = RandomStream::GetMasterSeed();
+	random.Seed(RandomStream::TaskSeed(random_master, (int)name.hash()));
+}
+
+// +--------------------------------------------------------------------+
+
 void USim::ProcessEventTrigger(int type, int event_id, const char* ship, int param)
 {
 }
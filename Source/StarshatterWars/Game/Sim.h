@@ -19,9 +19,13 @@
 #include "../Space/Universe.h"
 //#include "Scene.h"
 #include "Physical.h"
+#include "PhysicalBatch.h"
+#include "CollisionGrid.h"
 #include "../Foundation/Geometry.h"
 #include "../Foundation/List.h"
 #include "../Foundation/Text.h"
+#include "../Foundation/Random.h"
+#include "../Foundation/TaskPool.h"
 #include "Sim.generated.h"
 
 // +--------------------------------------------------------------------+
@@ -85,7 +89,32 @@ public:
 
 	static USim*		 GetSim() { return sim; }
 
-	//virtual void         ExecFrame(double seconds);
+	// UUniverse: the game ticks the sim once per rendered frame,
+	// scaled by the time compression:
+	virtual void         Tick(float DeltaTime) override;
+	virtual bool         IsTickable() const override;
+
+	virtual void         ExecFrame(double seconds);
+
+	// runs steps frames of every region in lockstep.  each step runs
+	// the active region on this thread, then the background regions
+	// across worker threads.  hyper jumps and splash damage raised by
+	// a region are queued on the region, merged into the jump and
+	// splash lists in region order, and resolved at the end of every
+	// step, so no region sees another before the step barrier:
+	void                 ExecRegions(double seconds, int steps = 1);
+	int                  GetRegionThreads() const { return region_pool.GetThreads(); }
+	void                 SetRegionThreads(int n) { region_pool.SetThreads(n); }
+
+	// fixed timestep: banks the (time compressed) frame time and runs
+	// the regions for as many whole physics sub frames as it covers.
+	// the fraction of a step left over is the blend factor for
+	// drawing objects between their last two steps.  returns the
+	// number of steps taken:
+	int                  StepRegions(double seconds);
+	double               GetStepAlpha() const { return step_alpha; }
+	int                  GetMaxSteps() const { return max_steps; }
+	void                 SetMaxSteps(int n) { max_steps = n > 0 ? n : 1; }
 
 	void                 LoadMission(Mission* msn, bool preload_textures = false);
 	void                 ExecMission();
@@ -210,6 +239,9 @@ protected:
 	void                 CopyEvents();
 	void                 BuildLinks();
 
+	static void          ExecRegionTask(void* param, int index);
+	void                 MergeDeferred();
+
 	// Convert a single live element into a mission element
 	// that can be serialized over the net.
 	MissionElement* CreateMissionElement(Element* elem);
@@ -239,6 +271,16 @@ protected:
 
 	NetGame* netgame;
 	DWORD                start_time;
+
+	// region frames, see ExecRegions():
+	TaskPool             region_pool;
+	List<SimRegion>      exec_list;
+	double               exec_seconds;
+
+	// fixed timestep, see StepRegions():
+	double               step_time;
+	double               step_alpha;
+	int                  max_steps;
 };
 
 // +--------------------------------------------------------------------+
@@ -307,6 +349,17 @@ public:
 
 	List<Contact>& TrackList(int iff);
 
+	// regions may run their frames in parallel, so anything that
+	// reaches into another region waits here for the frame barrier:
+	void                 DeferHyperJump(SimHyper* h) { if (h) hyper_queue.append(h); }
+	void                 DeferSplash(SimSplash* s) { if (s) splash_queue.append(s); }
+
+	// the stream the region's frame draws from.  it is seeded from the
+	// master seed and the region name, so a region replays the same
+	// way whichever thread runs it:
+	RandomStream&        GetRandom() { return random; }
+	void                 SeedRandom();
+
 	void                 ResolveTimeSkip(double seconds);
 	USim* sim;
 
@@ -327,6 +380,7 @@ protected:
 
 	void                 DamageShips();
 	void                 CollideShips();
+	static void          CollideShipPair(UPhysical* a, UPhysical* b, void* param);
 	void                 CrashShips();
 	void                 DockShips();
 
@@ -353,6 +407,17 @@ protected:
 	List<Asteroid>       asteroids;
 	List<Contact>        track_database[5];
 	List<SimRegion>      links;
+	List<SimHyper>       hyper_queue;
+	List<SimSplash>      splash_queue;
+	RandomStream         random;
+	uint64               random_master = 0;
+
+	// motion state of the region's ships, integrated in one pass
+	// per frame, see UpdateShips():
+	PhysicalBatch        physics;
+
+	// broad phase for CollideShips(), rebuilt every frame:
+	CollisionGrid        collision_grid;
 
 	DWORD                sim_time;
 	int                  ai_index;
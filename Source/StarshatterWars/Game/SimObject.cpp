@@ -20,40 +20,63 @@
 
 SimObserver::~SimObserver()
 {
-	ListIter<USimObject> observed = observe_list;
-	while (++observed)
-		observed->Unregister(this);
+	for (int i = 0; i < observe_list.size(); i++) {
+		ObserverLink* link = observe_list[i];
+		USimObject*   obj  = link->object;
+
+		// an object in the middle of Notify() is walking its list,
+		// so leave the link there for it to throw away:
+		if (obj->notifying) {
+			link->observer = 0;
+		}
+		else {
+			obj->DropLink(link);
+			delete link;
+		}
+	}
+
+	observe_list.clear();
 }
 
 void
 SimObserver::Observe(USimObject* obj)
 {
-	if (obj) {
+	if (obj)
 		obj->Register(this);
-
-		if (!observe_list.contains(obj))
-			observe_list.append(obj);
-	}
 }
 
 void
 SimObserver::Ignore(USimObject* obj)
 {
-	if (obj) {
+	if (obj)
 		obj->Unregister(this);
-		observe_list.remove(obj);
-	}
 }
 
 bool
 SimObserver::Update(USimObject* obj)
 {
+	// during Notify() the link is already gone and this does nothing:
 	if (obj)
-		observe_list.remove(obj);
+		obj->Unregister(this);
 
 	return true;
 }
 
+void
+SimObserver::DropLink(ObserverLink* link)
+{
+	int i    = link->observer_slot;
+	int last = observe_list.size() - 1;
+
+	if (i != last) {
+		ObserverLink* moved = observe_list[last];
+		observe_list[i] = moved;
+		moved->observer_slot = i;
+	}
+
+	observe_list.removeIndex(last);
+}
+
 const char*
 SimObserver::GetObserverName() const
 {
@@ -98,14 +121,24 @@ USimObject::Notify()
 		int nupdate = 0;
 
 		if (nobservers > 0) {
-			ListIter<SimObserver> iter = observers;
-			while (++iter) {
-				SimObserver* observer = iter.value();
+			for (int i = 0; i < observers.size(); i++) {
+				ObserverLink* link = observers[i];
+				SimObserver*  observer = link->observer;
+
+				// destroyed by an earlier observer's update:
+				if (!observer) {
+					nupdate++;
+					continue;
+				}
+
+				observer->DropLink(link);
+				link->observer = 0;
+
 				observer->Update(this);
 				nupdate++;
 			}
 
-			observers.clear();
+			observers.destroy();
 		}
 
 		if (nobservers != nupdate) {
@@ -125,8 +158,18 @@ USimObject::Notify()
 void
 USimObject::Register(SimObserver* observer)
 {
-	if (!notifying && !observers.contains(observer))
-		observers.append(observer);
+	if (!observer || notifying || FindLink(observer))
+		return;
+
+	ObserverLink* link = new ObserverLink;
+
+	link->object        = this;
+	link->observer      = observer;
+	link->object_slot   = observers.size();
+	link->observer_slot = observer->observe_list.size();
+
+	observers.append(link);
+	observer->observe_list.append(link);
 }
 
 // +--------------------------------------------------------------------+
@@ -134,8 +177,53 @@ USimObject::Register(SimObserver* observer)
 void
 USimObject::Unregister(SimObserver* observer)
 {
-	if (!notifying)
-		observers.remove(observer);
+	if (!observer || notifying)
+		return;
+
+	ObserverLink* link = FindLink(observer);
+
+	if (link) {
+		DropLink(link);
+		observer->DropLink(link);
+		delete link;
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+ObserverLink*
+USimObject::FindLink(SimObserver* observer) const
+{
+	// the link is in both lists, so search whichever is shorter:
+	if (observers.size() <= observer->observe_list.size()) {
+		for (int i = 0; i < observers.size(); i++) {
+			if (observers[i]->observer == observer)
+				return observers[i];
+		}
+	}
+	else {
+		for (int i = 0; i < observer->observe_list.size(); i++) {
+			if (observer->observe_list[i]->object == this)
+				return observer->observe_list[i];
+		}
+	}
+
+	return 0;
+}
+
+void
+USimObject::DropLink(ObserverLink* link)
+{
+	int i    = link->object_slot;
+	int last = observers.size() - 1;
+
+	if (i != last) {
+		ObserverLink* moved = observers[last];
+		observers[i] = moved;
+		moved->object_slot = i;
+	}
+
+	observers.removeIndex(last);
 }
 
 // +--------------------------------------------------------------------+
@@ -30,6 +30,23 @@ class Scene;
 
 // +--------------------------------------------------------------------+
 
+// One observation, held in the lists of both the object and the
+// observer.  Each side records where the link sits in its own list,
+// so either end can drop it without searching:
+
+class ObserverLink
+{
+public:
+	static const char* TYPENAME() { return "ObserverLink"; }
+
+	USimObject*          object;
+	SimObserver*         observer;     // null once the observer is gone
+	int                  object_slot;
+	int                  observer_slot;
+};
+
+// +--------------------------------------------------------------------+
+
 /**
  * 
  */
@@ -39,6 +56,7 @@ class STARSHATTERWARS_API USimObject : public UPhysical
 	GENERATED_BODY()
 	
 	friend class SimRegion;
+	friend class SimObserver;
 
 public:
 	static const char* TYPENAME() { return "SimObject"; }
@@ -60,6 +78,10 @@ public:
 	virtual SimRegion* GetRegion()                const { return region; }
 	virtual void         SetRegion(SimRegion* rgn) { region = rgn; }
 
+	// Register and Unregister look the link up with FindLink, a
+	// linear search of the shorter of the two lists.  an object
+	// rarely has more than a handful of observers, so that is cheap
+	// even for an observer watching thousands of objects:
 	virtual void         Notify();
 	virtual void         Register(SimObserver* obs);
 	virtual void         Unregister(SimObserver* obs);
@@ -76,8 +98,12 @@ public:
 	}
 
 protected:
+	// DropLink is constant time, through the slots the link records:
+	ObserverLink*        FindLink(SimObserver* obs) const;
+	void                 DropLink(ObserverLink* link);
+
 	SimRegion* region;
-	List<SimObserver>    observers;
+	List<ObserverLink>   observers;
 	DWORD                objid;
 	bool                 active;
 	bool                 notifying;	
@@ -87,6 +113,8 @@ protected:
 
 class SimObserver
 {
+	friend class USimObject;
+
 public:
 	static const char* TYPENAME() { return "SimObserver"; }
 
@@ -102,5 +130,7 @@ public:
 
 
 protected:
-	List<USimObject>      observe_list;
+	void                 DropLink(ObserverLink* link);
+
+	List<ObserverLink>   observe_list;
 };
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "../System/Game.h"
 #include "Component.h"
 #include "SystemDesign.h"
+#include "../Foundation/Random.h"
 
 // Sets default values for this component's properties
 USystemComponent::USystemComponent()
@@ -194,7 +195,7 @@ USystemComponent::ExecFrame(double seconds)
 
 			// inflict some damage now:
 			if (safety_overload > 60) {
-				safety_overload -= (float)(rand() / (1000 * (power_level - safety)));
+				safety_overload -= (float)(RandomInt() / (1000 * (power_level - safety)));
 				ApplyDamage(15);
 
 				//NetUtil::SendSysStatus(ship, this);
@@ -242,13 +243,13 @@ USystemComponent::ApplyDamage(double damage)
 		damage /= 10;
 
 	if (components.size() > 0) {
-		int index = rand() % components.size();
+		int index = RandomInt() % components.size();
 
 		if (damage > 50) {
 			damage /= 2;
 			components[index]->ApplyDamage(damage);
 
-			index = rand() % components.size();
+			index = RandomInt() % components.size();
 		}
 
 		components[index]->ApplyDamage(damage);
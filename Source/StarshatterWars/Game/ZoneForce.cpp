@@ -57,6 +57,20 @@ ZoneForce::RemoveGroup(CombatGroup* group)
 		groups.remove(group);
 }
 
+void
+ZoneForce::AddAssigned(CombatGroup* group)
+{
+	if (group)
+		assigned.append(group);
+}
+
+void
+ZoneForce::RemoveAssigned(CombatGroup* group)
+{
+	if (group)
+		assigned.remove(group);
+}
+
 bool
 ZoneForce::HasGroup(CombatGroup* group)
 {
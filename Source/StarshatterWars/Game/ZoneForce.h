@@ -36,6 +36,12 @@ public:
 	List<CombatGroup>& GetTargetList() { return target_list; }
 	List<CombatGroup>& GetDefendList() { return defend_list; }
 
+	// groups of this force whose assigned zone is the zone that
+	// owns the force, kept current by CombatGroup::SetAssignedZone:
+	List<CombatGroup>& GetAssignedGroups() { return assigned; }
+	void                 AddAssigned(CombatGroup* g);
+	void                 RemoveAssigned(CombatGroup* g);
+
 	void                 AddGroup(CombatGroup* g);
 	void                 RemoveGroup(CombatGroup* g);
 	bool                 HasGroup(CombatGroup* g);
@@ -50,5 +56,6 @@ private:
 	List<CombatGroup>    groups;
 	List<CombatGroup>    defend_list;
 	List<CombatGroup>    target_list;
+	List<CombatGroup>    assigned;
 	int                  need[8];
 };
@@ -9,6 +9,7 @@
 #include "../Foundation/Color.h"
 #include "../Game/SimObject.h"
 #include "../Foundation/Text.h"
+#include "../Foundation/ThreadSync.h"
 #include "W_RadioView.generated.h"
 
 
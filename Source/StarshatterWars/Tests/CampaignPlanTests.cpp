@@ -0,0 +1,250 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         CampaignPlanTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Automation tests for the campaign planners, on synthetic campaigns
+	with several combatants and zones: serial and parallel assignment
+	passes must agree, the region to zone index must follow its zones,
+	and the planning pass is timed at increasing sizes.  The loaded
+	campaign, when there is one, is also planned both ways.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "../Game/Campaign.h"
+#include "../Game/CampaignPlanAssignment.h"
+#include "../Game/Combatant.h"
+#include "../Game/CombatAssignment.h"
+#include "../Game/CombatGroup.h"
+#include "../Game/CombatZone.h"
+#include "../Foundation/Random.h"
+#include "TestCampaign.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	void DescribeAssignments(CombatGroup* g, FString& out)
+	{
+		if (!g)
+			return;
+
+		ListIter<CombatAssignment> a = g->GetAssignments();
+		while (++a) {
+			CombatGroup* obj = a->GetObjective();
+
+			out += FString::Printf(TEXT("%d:%d %d %d:%d\n"),
+				g->Type(), g->GetID(), a->Type(),
+				obj ? obj->Type() : 0, obj ? obj->GetID() : 0);
+		}
+
+		ListIter<CombatGroup> comp = g->GetComponents();
+		while (++comp)
+			DescribeAssignments(comp.value(), out);
+	}
+
+	FString PlanAssignments(UCampaignPlanAssignment* plan, UCampaign* campaign, int threads, uint64 seed)
+	{
+		RandomStream stream(seed);
+		RandomScope  random(stream);
+
+		plan->SetThreads(threads);
+		plan->SetCampaign(campaign);   // also makes the pass due now
+		plan->ExecFrame();
+
+		FString out;
+
+		ListIter<Combatant> iter = campaign->GetCombatants();
+		while (++iter) {
+			out += FString::Printf(TEXT("combatant %d\n"), iter->GetIFF());
+			DescribeAssignments(iter->GetForce(), out);
+		}
+
+		return out;
+	}
+
+	int CountAssignments(CombatGroup* g)
+	{
+		if (!g)
+			return 0;
+
+		int count = g->GetAssignments().size();
+
+		ListIter<CombatGroup> comp = g->GetComponents();
+		while (++comp)
+			count += CountAssignments(comp.value());
+
+		return count;
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCampaignPlanAssignmentDeterminismTest,
+	"StarshatterWars.Game.CampaignPlan.AssignmentDeterminism",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FCampaignPlanAssignmentDeterminismTest::RunTest(const FString& Parameters)
+{
+	const uint64 SEED = 0x5eed;
+
+	// several combatants contesting several zones, so each task has
+	// targets in the other forces and real work to interleave:
+	UCampaign* campaign = TestCampaign::Create(4, 6);
+	campaign->SetStatus(UCampaign::CAMPAIGN_ACTIVE);
+
+	UCampaignPlanAssignment* plan = NewObject<UCampaignPlanAssignment>(campaign);
+
+	// serial, parallel, and parallel again from the same seed:
+	FString serial   = PlanAssignments(plan, campaign, 1, SEED);
+	FString parallel = PlanAssignments(plan, campaign, 0, SEED);
+	FString again    = PlanAssignments(plan, campaign, 4, SEED);
+
+	int assignments = 0;
+
+	ListIter<Combatant> iter = campaign->GetCombatants();
+	while (++iter)
+		assignments += CountAssignments(iter->GetForce());
+
+	TestTrue(TEXT("assignments were made"),    assignments > 0);
+	TestEqual(TEXT("parallel matches serial"), parallel, serial);
+	TestEqual(TEXT("repeat matches serial"),   again,    serial);
+
+	TestCampaign::Destroy(campaign);
+
+	// and the loaded campaign too, when there is one:
+	UCampaign* live = UCampaign::GetCampaign();
+
+	if (live && live->IsActive()) {
+		plan = NewObject<UCampaignPlanAssignment>(live);
+
+		serial   = PlanAssignments(plan, live, 1, SEED);
+		parallel = PlanAssignments(plan, live, 0, SEED);
+
+		TestEqual(TEXT("loaded campaign: parallel matches serial"), parallel, serial);
+	}
+
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCampaignZoneIndexTest,
+	"StarshatterWars.Game.CampaignPlan.ZoneIndex",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FCampaignZoneIndexTest::RunTest(const FString& Parameters)
+{
+	UCampaign*        campaign = TestCampaign::Create(2, 3);
+	List<CombatZone>& zones    = campaign->GetZones();
+
+	TestTrue(TEXT("region found"),    campaign->GetZone("Sector 2") == zones[1]);
+	TestTrue(TEXT("unknown region"),  campaign->GetZone("Sector 9") == 0);
+
+	// a region added to a zone the index has already seen:
+	zones[2]->AddRegion("Sector 2b");
+	TestTrue(TEXT("added region found"), campaign->GetZone("Sector 2b") == zones[2]);
+
+	// a zone replaced by another, leaving the count the same:
+	CombatZone* old_zone = zones.removeIndex(0);
+	delete old_zone;
+
+	CombatZone* new_zone = new CombatZone();
+	new_zone->AddRegion("Sector 1");
+	zones.append(new_zone);
+
+	TestTrue(TEXT("replaced zone found"), campaign->GetZone("Sector 1") == new_zone);
+
+	TestCampaign::Destroy(campaign);
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCampaignPlanningPassBenchmarkTest,
+	"StarshatterWars.Game.CampaignPlan.PlanningPassBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FCampaignPlanningPassBenchmarkTest::RunTest(const FString& Parameters)
+{
+	struct Size { int combatants; int zones; };
+
+	static const Size SIZES[] = {
+		{ 2,  4 },
+		{ 4,  8 },
+		{ 8, 16 },
+		{ 8, 32 },
+	};
+
+	const int PASSES  = 10;
+	const int LOOKUPS = 100000;
+
+	for (int s = 0; s < UE_ARRAY_COUNT(SIZES); s++) {
+		const Size& size = SIZES[s];
+
+		UCampaign* campaign = TestCampaign::Create(size.combatants, size.zones);
+		campaign->SetStatus(UCampaign::CAMPAIGN_ACTIVE);
+
+		UCampaignPlanAssignment* plan = NewObject<UCampaignPlanAssignment>(campaign);
+
+		RandomStream stream(0x5eed);
+		RandomScope  random(stream);
+
+		double plan_time = 0;
+
+		// pass zero starts the pool's workers and is not timed:
+		for (int n = 0; n <= PASSES; n++) {
+			double t0 = FPlatformTime::Seconds();
+
+			plan->SetCampaign(campaign);
+			plan->ExecFrame();
+
+			if (n > 0)
+				plan_time += FPlatformTime::Seconds() - t0;
+		}
+
+		int assignments = 0;
+
+		ListIter<Combatant> iter = campaign->GetCombatants();
+		while (++iter)
+			assignments += CountAssignments(iter->GetForce());
+
+		// the lookups the event and strategic planners make by region:
+		char region[32];
+		int  found = 0;
+
+		double t0 = FPlatformTime::Seconds();
+
+		for (int n = 0; n < LOOKUPS; n++) {
+			sprintf_s(region, 32, "Sector %d", 1 + n % size.zones);
+
+			if (campaign->GetZone(region))
+				found++;
+		}
+
+		double lookup_time = FPlatformTime::Seconds() - t0;
+
+		TestEqual(FString::Printf(TEXT("%d zones: every region found"), size.zones), found, LOOKUPS);
+		TestTrue(FString::Printf(TEXT("%d zones: assignments made"), size.zones), assignments > 0);
+
+		AddInfo(FString::Printf(
+			TEXT("Planning pass, %d combatants, %d zones: %.3f ms per assignment pass (%d assignments), %.1f ns per zone lookup"),
+			size.combatants, size.zones,
+			plan_time * 1e3 / PASSES, assignments,
+			lookup_time * 1e9 / LOOKUPS));
+
+		TestCampaign::Destroy(campaign);
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,195 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         CampaignRunnerTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Automation tests for the campaign soak runner, on synthetic
+	campaigns: the daily release counts must add up to the graph's
+	own count without the runner touching the ready set, and a run
+	must repeat exactly from the same seed.  Also
+	a benchmark of simulated hours per second against campaign size.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "TestCampaign.h"
+#include "../Game/Campaign.h"
+#include "../Game/CampaignRunner.h"
+#include "../Game/CombatAction.h"
+#include "../Game/CombatActionGraph.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	int CountStatus(UCampaign* campaign, int status)
+	{
+		int count = 0;
+
+		ListIter<CombatAction> iter = campaign->GetActions();
+		while (++iter)
+			if (iter->Status() == status)
+				count++;
+
+		return count;
+	}
+
+	// pending actions with every action requirement met, which is
+	// what the ready set must hold when no action has a deadline:
+	int CountWaiting(UCampaign* campaign)
+	{
+		int count = 0;
+
+		ListIter<CombatAction> iter = campaign->GetActions();
+		while (++iter)
+			if (iter->Status() == CombatAction::PENDING && iter->DependenciesMet())
+				count++;
+
+		return count;
+	}
+
+	FString DescribeDays(const CampaignRunner& runner)
+	{
+		FString out;
+
+		const List<CampaignDayStats>& days = runner.GetDays();
+
+		for (int i = 0; i < days.size(); i++) {
+			const CampaignDayStats* stats = days[i];
+
+			out += FString::Printf(TEXT("%d: %d %d %d %d\n"),
+				stats->day, stats->events, stats->assignments, stats->missions, stats->released);
+		}
+
+		return out;
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCampaignRunnerReleaseCountTest,
+	"StarshatterWars.Game.CampaignRunner.ReleaseCount",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FCampaignRunnerReleaseCountTest::RunTest(const FString& Parameters)
+{
+	const int DAYS    = 3;
+	const int ACTIONS = 120;
+	const int CHAINS  = 4;
+
+	UCampaign* campaign = TestCampaign::Create(3, 4);
+	TestCampaign::AddActions(campaign, ACTIONS, CHAINS);
+
+	CampaignRunner runner(campaign, 0x5eed);
+	runner.Run(DAYS);
+
+	CombatActionGraph& graph = campaign->GetActionGraph();
+
+	// the head of each chain is released by Build, before day one:
+	const List<CampaignDayStats>& days = runner.GetDays();
+
+	int daily = 0;
+	for (int i = 0; i < days.size(); i++)
+		daily += days[i]->released;
+
+	TestEqual(TEXT("ran every day"),                  days.size(), DAYS);
+	TestEqual(TEXT("daily releases add up"),          daily + CHAINS, graph.NumReleased());
+	TestEqual(TEXT("ready set left for planners"),    graph.NumReady(), CountWaiting(campaign));
+	TestTrue(TEXT("actions were released"),           daily > 0);
+	TestTrue(TEXT("no action completes unreleased"),  CountStatus(campaign, CombatAction::COMPLETE) <= graph.NumReleased());
+	TestTrue(TEXT("campaign no longer current"),      UCampaign::GetCampaign() != campaign);
+
+	TestCampaign::Destroy(campaign);
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCampaignRunnerDeterminismTest,
+	"StarshatterWars.Game.CampaignRunner.Determinism",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FCampaignRunnerDeterminismTest::RunTest(const FString& Parameters)
+{
+	const int DAYS = 4;
+
+	FString result[2];
+
+	for (int n = 0; n < 2; n++) {
+		UCampaign* campaign = TestCampaign::Create(3, 4);
+		TestCampaign::AddActions(campaign, 120, 4);
+
+		CampaignRunner runner(campaign, 0x5eed);
+		runner.Run(DAYS);
+
+		result[n] = DescribeDays(runner);
+		TestCampaign::Destroy(campaign);
+	}
+
+	TestFalse(TEXT("days recorded"), result[0].IsEmpty());
+	TestEqual(TEXT("repeat matches first run"), result[1], result[0]);
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCampaignRunnerThroughputBenchmarkTest,
+	"StarshatterWars.Game.CampaignRunner.ThroughputBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FCampaignRunnerThroughputBenchmarkTest::RunTest(const FString& Parameters)
+{
+	struct Size { int combatants; int zones; int actions; };
+
+	static const Size SIZES[] = {
+		{ 2,  2,  100 },
+		{ 4,  8,  500 },
+		{ 8, 16, 2000 },
+	};
+
+	const int DAYS = 7;
+
+	for (int s = 0; s < UE_ARRAY_COUNT(SIZES); s++) {
+		const Size& size = SIZES[s];
+
+		UCampaign* campaign = TestCampaign::Create(size.combatants, size.zones);
+		TestCampaign::AddActions(campaign, size.actions, size.actions / 20);
+
+		CampaignRunner runner(campaign, 1);
+		runner.Run(DAYS);
+
+		int released = 0;
+		int events   = 0;
+
+		const List<CampaignDayStats>& days = runner.GetDays();
+
+		for (int i = 0; i < days.size(); i++) {
+			released += days[i]->released;
+			events   += days[i]->events;
+		}
+
+		TestEqual(FString::Printf(TEXT("%d combatants: ran every day"), size.combatants), days.size(), DAYS);
+
+		AddInfo(FString::Printf(
+			TEXT("Runner %d combatants, %d zones, %d actions: %.0f sim hours/sec (%.1f ms per day), ")
+			TEXT("%.1f released and %.1f events per day, %d complete"),
+			size.combatants, size.zones, size.actions,
+			runner.SimHoursPerSecond(),
+			runner.GetWallSeconds() * 1e3 / DAYS,
+			released / (double)DAYS, events / (double)DAYS,
+			CountStatus(campaign, CombatAction::COMPLETE)));
+
+		TestCampaign::Destroy(campaign);
+	}
+
+	return true;
+}
+
+#endif
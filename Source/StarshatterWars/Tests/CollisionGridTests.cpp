@@ -0,0 +1,183 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         CollisionGridTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Stress test for the CollisionGrid broad phase: a region of 5000
+	ships and 50000 shots, a few of them big enough to skip the grid.
+	The grid must report exactly the overlapping pairs an all pairs
+	scan finds, each one once, while running far fewer sphere tests.
+	The objects are never dereferenced, so they are stood in for by
+	their index.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "../Game/CollisionGrid.h"
+#include "../Foundation/Random.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	enum { SHIPS, SHOTS };
+
+	const int NUM_SHIPS = 5000;
+	const int NUM_SHOTS = 50000;
+
+	struct Body {
+		Point   loc;
+		double  radius;
+		int     group;
+	};
+
+	struct Tally {
+		int     pairs;
+		uint64  sum;
+	};
+
+	UPhysical* Handle(int index) { return (UPhysical*)(UPTRINT)(index + 1); }
+	int        Index(UPhysical* obj) { return (int)(UPTRINT)obj - 1; }
+
+	// order independent, so a pair reported as (a,b) or (b,a) by
+	// a same group search counts the same:
+	uint64 PairKey(int a, int b)
+	{
+		uint64 lo = a < b ? a : b;
+		uint64 hi = a < b ? b : a;
+		return RandomStream::TaskSeed(lo, (int)hi);
+	}
+
+	void CountPair(UPhysical* a, UPhysical* b, void* param)
+	{
+		Tally* t = (Tally*)param;
+		t->pairs++;
+		t->sum += PairKey(Index(a), Index(b));
+	}
+
+	// ships spread over a 100 km region, a few stations too big for
+	// the grid, and half the shots flying close around some ship:
+	Body* CreateBodies(RandomStream& rng)
+	{
+		Body* bodies = new Body[NUM_SHIPS + NUM_SHOTS];
+
+		for (int i = 0; i < NUM_SHIPS; i++) {
+			Body& b = bodies[i];
+
+			b.loc    = Point(rng.Double(-50e3, 50e3), rng.Double(-50e3, 50e3), rng.Double(-50e3, 50e3));
+			b.radius = i % 1000 ? rng.Double(20, 400) : 12e3;
+			b.group  = SHIPS;
+		}
+
+		for (int i = 0; i < NUM_SHOTS; i++) {
+			Body& b = bodies[NUM_SHIPS + i];
+
+			if (i & 1) {
+				const Body& near = bodies[rng.Next() % NUM_SHIPS];
+				b.loc = near.loc + Point(rng.Double(-1e3, 1e3), rng.Double(-1e3, 1e3), rng.Double(-1e3, 1e3));
+			}
+			else {
+				b.loc = Point(rng.Double(-50e3, 50e3), rng.Double(-50e3, 50e3), rng.Double(-50e3, 50e3));
+			}
+
+			b.radius = rng.Double(1, 10);
+			b.group  = SHOTS;
+		}
+
+		return bodies;
+	}
+
+	bool Overlap(const Body& a, const Body& b)
+	{
+		Point  d = a.loc - b.loc;
+		double r = a.radius + b.radius;
+		return d * d <= r * r;
+	}
+
+	void AllPairs(const Body* bodies, int group_a, int group_b, Tally& t)
+	{
+		const int count = NUM_SHIPS + NUM_SHOTS;
+
+		for (int i = 0; i < count; i++) {
+			if (bodies[i].group != group_a)
+				continue;
+
+			for (int j = group_a == group_b ? i + 1 : 0; j < count; j++) {
+				if (bodies[j].group != group_b)
+					continue;
+
+				if (Overlap(bodies[i], bodies[j])) {
+					t.pairs++;
+					t.sum += PairKey(i, j);
+				}
+			}
+		}
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCollisionGridStressTest,
+	"StarshatterWars.Game.CollisionGrid.Stress",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FCollisionGridStressTest::RunTest(const FString& Parameters)
+{
+	RandomStream rng(0x5eed);
+	Body*        bodies = CreateBodies(rng);
+
+	CollisionGrid grid;
+	Tally         ship_ship = { 0, 0 };
+	Tally         ship_shot = { 0, 0 };
+
+	double t0 = FPlatformTime::Seconds();
+
+	grid.Clear();
+	for (int i = 0; i < NUM_SHIPS + NUM_SHOTS; i++)
+		grid.Insert(Handle(i), bodies[i].group, bodies[i].loc, bodies[i].radius);
+
+	int found = grid.FindPairs(SHIPS, SHIPS, CountPair, &ship_ship);
+	int tests = grid.NumTests();
+
+	found += grid.FindPairs(SHIPS, SHOTS, CountPair, &ship_shot);
+	tests += grid.NumTests();
+
+	double t1 = FPlatformTime::Seconds();
+
+	Tally all_ship_ship = { 0, 0 };
+	Tally all_ship_shot = { 0, 0 };
+
+	AllPairs(bodies, SHIPS, SHIPS, all_ship_ship);
+	AllPairs(bodies, SHIPS, SHOTS, all_ship_shot);
+
+	double t2 = FPlatformTime::Seconds();
+
+	double all_tests = (double)NUM_SHIPS * (NUM_SHIPS - 1) / 2 + (double)NUM_SHIPS * NUM_SHOTS;
+
+	TestEqual(TEXT("objects"), grid.NumObjects(), NUM_SHIPS + NUM_SHOTS);
+	TestEqual(TEXT("pairs returned"), found, ship_ship.pairs + ship_shot.pairs);
+	TestEqual(TEXT("ship/ship pairs"), ship_ship.pairs, all_ship_ship.pairs);
+	TestEqual(TEXT("ship/shot pairs"), ship_shot.pairs, all_ship_shot.pairs);
+	TestTrue(TEXT("ship/ship pairs match all pairs"), ship_ship.sum == all_ship_ship.sum);
+	TestTrue(TEXT("ship/shot pairs match all pairs"), ship_shot.sum == all_ship_shot.sum);
+	TestTrue(TEXT("some pairs overlap"), ship_shot.pairs > 0);
+	TestTrue(TEXT("grid tests a fraction of all pairs"), tests < all_tests / 20);
+
+	AddInfo(FString::Printf(
+		TEXT("CollisionGrid %d ships, %d shots: %d pairs, grid %.3f ms (%d tests), all pairs %.3f ms (%.0f tests)"),
+		NUM_SHIPS, NUM_SHOTS, found,
+		(t1 - t0) * 1e3, tests,
+		(t2 - t1) * 1e3, all_tests));
+
+	delete [] bodies;
+	return true;
+}
+
+#endif
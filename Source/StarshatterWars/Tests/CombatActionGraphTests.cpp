@@ -0,0 +1,236 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         CombatActionGraphTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Automation tests for the campaign action graph.  A planner pass
+	over the ready set must fire the same actions, in the same order
+	and from the same random draws, as the old pass that asked every
+	action whether it was available.  The actions are scripted with
+	chains, probabilities, deadlines, delays and negative requirements.
+	Also a stress benchmark of the two passes over 10,000 actions.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "TestCampaign.h"
+#include "../Game/Campaign.h"
+#include "../Game/CombatAction.h"
+#include "../Game/CombatActionGraph.h"
+#include "../Foundation/Random.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	const int PASS_SECONDS = 1200;    // as the event planner
+
+	void AddScript(UCampaign* campaign, int count, int chains, uint64 seed)
+	{
+		RandomStream script(seed);
+
+		for (int id = 1; id <= count; id++) {
+			CombatAction* action = new CombatAction(id, CombatAction::NO_ACTION, 0, 1);
+			action->SetCount(script.Rand() % 3 ? 1 : 2);
+			action->SetStartAfter((id - 1) / chains * 1800 + script.Rand() % 1200);
+
+			if (script.Rand() % 3 == 0)
+				action->SetProbability(60);
+
+			if (script.Rand() % 4 == 0)
+				action->SetStartBefore(action->StartAfter() + 600 + script.Rand() % 3000);
+
+			if (script.Rand() % 7 == 0)
+				action->SetDelay(900);
+
+			if (id > chains)
+				action->AddRequirement(id - chains, CombatAction::COMPLETE);
+
+			if (id > 2 * chains && script.Rand() % 5 == 0)
+				action->AddRequirement(id - 2 * chains, CombatAction::SKIPPED, true);
+
+			campaign->GetActions().append(action);
+		}
+	}
+
+	void SetTime(UCampaign* campaign, double seconds)
+	{
+		// the campaign is not started, so this only moves its clock:
+		UCampaign::SetVirtualClock(seconds);
+		campaign->ExecFrame();
+	}
+
+	// the old pass: every action is asked:
+	int WalkAll(UCampaign* campaign, int pass, FString* log)
+	{
+		int fired = 0;
+
+		ListIter<CombatAction> iter = campaign->GetActions();
+		while (++iter) {
+			if (iter->IsAvailable()) {
+				iter->FireAction();
+				fired++;
+
+				if (log)
+					*log += FString::Printf(TEXT("%d:%d "), pass, iter->Identity());
+			}
+		}
+
+		return fired;
+	}
+
+	// the planners' pass: only the ready set is asked:
+	int WalkReady(UCampaign* campaign, int pass, FString* log)
+	{
+		CombatActionGraph& graph  = campaign->GetActionGraph();
+		CombatAction*      action = 0;
+		int                fired  = 0;
+
+		while ((action = graph.NextReady(action)) != 0) {
+			if (action->IsAvailable()) {
+				action->FireAction();
+				fired++;
+
+				if (log)
+					*log += FString::Printf(TEXT("%d:%d "), pass, action->Identity());
+			}
+		}
+
+		return fired;
+	}
+
+	typedef int (*PASS_FUNC)(UCampaign*, int, FString*);
+
+	// runs the script through the given pass and returns what fired
+	// when, and how each action ended:
+	FString RunScript(PASS_FUNC walk, int count, int chains, uint64 seed, int passes, double* seconds = 0)
+	{
+		UCampaign* campaign = TestCampaign::Create(0, 0);
+		AddScript(campaign, count, chains, seed);
+
+		UCampaign::SetCurrentCampaign(campaign);
+		campaign->GetActionGraph().Build(campaign->GetActions());
+
+		RandomStream stream(seed);
+		RandomScope  random(stream);
+
+		FString log;
+		double  time = 0;
+
+		for (int pass = 1; pass <= passes; pass++) {
+			SetTime(campaign, pass * PASS_SECONDS);
+
+			double t0 = FPlatformTime::Seconds();
+			walk(campaign, pass, &log);
+			time += FPlatformTime::Seconds() - t0;
+		}
+
+		if (seconds)
+			*seconds = time;
+
+		log += TEXT("| ");
+
+		ListIter<CombatAction> iter = campaign->GetActions();
+		while (++iter)
+			log += FString::Printf(TEXT("%d"), iter->Status());
+
+		UCampaign::ClearVirtualClock();
+		TestCampaign::Destroy(campaign);
+		return log;
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatActionGraphReadySetTest,
+	"StarshatterWars.Game.CombatActionGraph.ReadySet",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FCombatActionGraphReadySetTest::RunTest(const FString& Parameters)
+{
+	for (uint64 seed = 1; seed <= 8; seed++) {
+		FString all   = RunScript(WalkAll,   300, 8, seed, 400);
+		FString ready = RunScript(WalkReady, 300, 8, seed, 400);
+
+		TestEqual(FString::Printf(TEXT("seed %d: ready set fires as the full walk"), (int)seed), ready, all);
+	}
+
+	// the set follows status changes, in campaign order:
+	UCampaign* campaign = TestCampaign::Create(0, 0);
+	TestCampaign::AddActions(campaign, 12, 3);
+
+	CombatActionGraph& graph = campaign->GetActionGraph();
+	graph.Build(campaign->GetActions());
+
+	TestEqual(TEXT("chain heads are ready"),  graph.NumReady(), 3);
+	TestEqual(TEXT("chain heads released"),   graph.NumReleased(), 3);
+
+	CombatAction* second = campaign->GetActions()[1];
+	second->FireAction();
+
+	TestEqual(TEXT("fired action leaves, dependent enters"), graph.NumReady(), 3);
+	TestEqual(TEXT("dependent released"),     graph.NumReleased(), 4);
+
+	// the first walk covers every action until each has drawn its roll:
+	int walked = 0;
+	for (CombatAction* a = graph.NextReady(); a; a = graph.NextReady(a))
+		walked++;
+
+	TestEqual(TEXT("first walk covers every action"), walked, 12);
+
+	ListIter<CombatAction> iter = campaign->GetActions();
+	while (++iter)
+		iter->IsAvailable();
+
+	graph.NextReady(campaign->GetActions().last());
+
+	int order[3] = { 0, 0, 0 };
+	int n = 0;
+	for (CombatAction* a = graph.NextReady(); a && n < 3; a = graph.NextReady(a))
+		order[n++] = a->Identity();
+
+	TestEqual(TEXT("then only the ready set"), n, 3);
+	TestTrue(TEXT("in campaign order"), order[0] == 1 && order[1] == 3 && order[2] == 5);
+
+	TestCampaign::Destroy(campaign);
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatActionGraphStressBenchmarkTest,
+	"StarshatterWars.Game.CombatActionGraph.StressBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FCombatActionGraphStressBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const int ACTIONS = 10000;
+	const int CHAINS  = 100;
+	const int PASSES  = 400;
+
+	double all_time   = 0;
+	double ready_time = 0;
+
+	FString all   = RunScript(WalkAll,   ACTIONS, CHAINS, 5, PASSES, &all_time);
+	FString ready = RunScript(WalkReady, ACTIONS, CHAINS, 5, PASSES, &ready_time);
+
+	TestEqual(TEXT("ready set fires as the full walk"), ready, all);
+
+	AddInfo(FString::Printf(
+		TEXT("%d actions in %d chains, %d planner passes: full walk %.3f ms per pass, ready set %.3f ms per pass (%.1fx)"),
+		ACTIONS, CHAINS, PASSES,
+		all_time * 1e3 / PASSES,
+		ready_time * 1e3 / PASSES,
+		ready_time > 0 ? all_time / ready_time : 0));
+
+	return true;
+}
+
+#endif
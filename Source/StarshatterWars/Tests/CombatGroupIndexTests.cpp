@@ -0,0 +1,276 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         CombatGroupIndexTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Automation tests for the order of battle index: when two groups
+	share a type and id, or two units share a name, removing the one
+	the index holds must leave the other one findable.  Also a benchmark
+	that evaluates a scripted action for every group of the full
+	Alliance and Hegemony rosters, and looks up every unit by name,
+	through the index and by walking the tree.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "TestCampaign.h"
+#include "../Game/Campaign.h"
+#include "../Game/Combatant.h"
+#include "../Game/CombatAction.h"
+#include "../Game/CombatGroup.h"
+#include "../Game/CombatGroupIndex.h"
+#include "../Game/CombatUnit.h"
+#include "../Game/GameStructs.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	CombatUnit* AddUnit(CombatGroup* g, const char* name)
+	{
+		CombatUnit* u = new CombatUnit(name, "", 0, "", 1, 1);
+		g->GetUnits().append(u);
+		u->SetCombatGroup(g);
+		return u;
+	}
+
+	void DeleteBranch(CombatGroup* g)
+	{
+		// the parent link stays until the group is gone, so the
+		// destructor can still reach the tree's index:
+		g->GetParent()->GetComponents().remove(g);
+		delete g;
+	}
+
+	// the searches FindGroup and FindUnit made before the index:
+	CombatGroup* WalkFindGroup(CombatGroup* g, int type, int id)
+	{
+		if (g->Type() == type && g->GetID() == id)
+			return g;
+
+		ListIter<CombatGroup> iter = g->GetComponents();
+		while (++iter) {
+			CombatGroup* result = WalkFindGroup(iter.value(), type, id);
+			if (result)
+				return result;
+		}
+
+		return 0;
+	}
+
+	CombatUnit* WalkFindUnit(CombatGroup* g, const char* name)
+	{
+		ListIter<CombatUnit> unit = g->GetUnits();
+		while (++unit)
+			if (unit->Name() == name)
+				return unit.value();
+
+		ListIter<CombatGroup> iter = g->GetComponents();
+		while (++iter) {
+			CombatUnit* result = WalkFindUnit(iter.value(), name);
+			if (result)
+				return result;
+		}
+
+		return 0;
+	}
+
+	// one intel action per group, as a campaign script names them:
+	// the asset is the group itself, and the group must still have
+	// some value for the action to be available.  the force each
+	// action and unit belongs to is kept alongside, for the walks:
+	void ScriptGroups(Combatant* c, CombatGroup* g, List<CombatAction>& actions, List<CombatGroup>& action_forces,
+		List<CombatUnit>& units, List<CombatGroup>& unit_forces)
+	{
+		CombatAction* action = new CombatAction(actions.size() + 1, CombatAction::INTEL_EVENT, 0, c->GetIFF());
+		action->SetAssetType(g->Type());
+		action->SetAssetId(g->GetID());
+		action->AddRequirement(c, g->Type(), g->GetID(), COMPARISON_OPERATOR::GE, 0);
+
+		actions.append(action);
+		action_forces.append(c->GetForce());
+
+		ListIter<CombatUnit> unit = g->GetUnits();
+		while (++unit) {
+			units.append(unit.value());
+			unit_forces.append(c->GetForce());
+		}
+
+		ListIter<CombatGroup> iter = g->GetComponents();
+		while (++iter)
+			ScriptGroups(c, iter.value(), actions, action_forces, units, unit_forces);
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatGroupIndexDuplicateTest,
+	"StarshatterWars.Game.CombatGroupIndex.DuplicateKeys",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FCombatGroupIndexDuplicateTest::RunTest(const FString& Parameters)
+{
+	const int WING     = CombatGroup::WING;
+	const int SQUADRON = CombatGroup::FIGHTER_SQUADRON;
+
+	CombatGroup* root   = new CombatGroup(WING, 1, "Root", 1, 0);
+	CombatGroup* first  = new CombatGroup(SQUADRON, 7, "First",  1, 0, root);
+	CombatGroup* second = new CombatGroup(WING,     2, "Second", 1, 0, root);
+	CombatGroup* dup    = new CombatGroup(SQUADRON, 7, "Dup",    1, 0, second);
+
+	CombatUnit*  alpha1 = AddUnit(first, "Alpha");
+	CombatUnit*  alpha2 = AddUnit(dup,   "Alpha");
+	CombatUnit*  beta   = AddUnit(dup,   "Beta");
+
+	CombatGroupIndex* index = root->GetIndex();
+
+	TestTrue(TEXT("first holder of the group key"), index->FindGroup(SQUADRON, 7) == first);
+	TestTrue(TEXT("first holder of the unit name"), index->FindUnit("Alpha") == alpha1);
+
+	// dropping the indexed holders brings up the survivors:
+	DeleteBranch(first);
+
+	TestTrue(TEXT("surviving group is indexed"), index->FindGroup(SQUADRON, 7) == dup);
+	TestTrue(TEXT("surviving group is found"),   root->FindGroup(SQUADRON, 7) == dup);
+	TestTrue(TEXT("surviving unit is indexed"),  index->FindUnit("Alpha") == alpha2);
+	TestTrue(TEXT("surviving unit is found"),    dup->FindUnit("Alpha") == alpha2);
+
+	// a transfer out of the tree drops the last holder of a name:
+	CombatGroup* other = new CombatGroup(WING, 3, "Other", 1, 0);
+
+	dup->GetUnits().remove(alpha2);
+	other->GetUnits().append(alpha2);
+	alpha2->SetCombatGroup(other);
+
+	TestTrue(TEXT("transferred unit is gone"), index->FindUnit("Alpha") == 0);
+	TestTrue(TEXT("other units remain"),       index->FindUnit("Beta")  == beta);
+
+	DeleteBranch(second);
+
+	TestTrue(TEXT("deleted branch is gone"), index->FindGroup(SQUADRON, 7) == 0);
+	TestTrue(TEXT("its units are gone"),     index->FindUnit("Beta") == 0);
+
+	delete other;
+	delete root;
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatGroupIndexRosterBenchmarkTest,
+	"StarshatterWars.Game.CombatGroupIndex.RosterBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FCombatGroupIndexRosterBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const int PASSES = 50;
+
+	UCampaign* campaign = TestCampaign::CreateFromRosters(8);
+
+	if (!campaign) {
+		AddInfo(TEXT("no Alliance.def or Hegemony.def, skipped"));
+		return true;
+	}
+
+	List<CombatAction>& actions = campaign->GetActions();
+	List<CombatGroup>   action_forces;
+	List<CombatUnit>    units;
+	List<CombatGroup>   unit_forces;
+
+	ListIter<Combatant> iter = campaign->GetCombatants();
+	while (++iter)
+		ScriptGroups(iter.value(), iter->GetForce(), actions, action_forces, units, unit_forces);
+
+	// the requirements are checked against the current campaign:
+	UCampaign* previous = UCampaign::GetCampaign();
+	UCampaign::SetCurrentCampaign(campaign);
+
+	int    available   = 0;
+	int    found       = 0;
+	int    mismatches  = 0;
+	double action_time = 0;
+	double walk_time   = 0;
+	double unit_time   = 0;
+	double unit_walk   = 0;
+
+	// pass zero draws the probability rolls and builds the index:
+	for (int n = 0; n <= PASSES; n++) {
+		available  = 0;
+		found      = 0;
+		mismatches = 0;
+
+		double t0 = FPlatformTime::Seconds();
+
+		// as the event planner: the action, then its asset:
+		for (int i = 0; i < actions.size(); i++) {
+			CombatAction* a = actions[i];
+
+			if (a->IsAvailable() && campaign->FindGroup(a->GetIFF(), a->AssetType(), a->AssetId()))
+				available++;
+		}
+
+		double t1 = FPlatformTime::Seconds();
+
+		for (int i = 0; i < actions.size(); i++) {
+			CombatAction* a     = actions[i];
+			CombatGroup*  force = action_forces[i];
+			CombatGroup*  g     = WalkFindGroup(force, a->AssetType(), a->AssetId());
+
+			if (g && g->CalcValue() >= 0 && WalkFindGroup(force, a->AssetType(), a->AssetId()))
+				found++;
+		}
+
+		double t2 = FPlatformTime::Seconds();
+
+		for (int i = 0; i < units.size(); i++) {
+			CombatUnit* u = unit_forces[i]->GetIndex()->FindUnit(units[i]->Name());
+			if (!u || u->Name() != units[i]->Name())
+				mismatches++;
+		}
+
+		double t3 = FPlatformTime::Seconds();
+
+		for (int i = 0; i < units.size(); i++) {
+			CombatUnit* u = WalkFindUnit(unit_forces[i], units[i]->Name());
+			if (!u || u->Name() != units[i]->Name())
+				mismatches++;
+		}
+
+		double t4 = FPlatformTime::Seconds();
+
+		if (n > 0) {
+			action_time += t1 - t0;
+			walk_time   += t2 - t1;
+			unit_time   += t3 - t2;
+			unit_walk   += t4 - t3;
+		}
+	}
+
+	UCampaign::SetCurrentCampaign(previous);
+
+	TestEqual(TEXT("every action available"), available, actions.size());
+	TestEqual(TEXT("the walk agrees"),         found,     available);
+	TestEqual(TEXT("every unit found"),        mismatches, 0);
+
+	AddInfo(FString::Printf(
+		TEXT("Rosters, %d actions: evaluated %.3f ms indexed, %.3f ms walking the tree (%.1fx); ")
+		TEXT("%d units by name %.3f ms indexed, %.3f ms walking (%.1fx)"),
+		actions.size(),
+		action_time * 1e3 / PASSES, walk_time * 1e3 / PASSES,
+		action_time > 0 ? walk_time / action_time : 0,
+		units.size(),
+		unit_time * 1e3 / PASSES, unit_walk * 1e3 / PASSES,
+		unit_time > 0 ? unit_walk / unit_time : 0));
+
+	TestCampaign::Destroy(campaign);
+	return true;
+}
+
+#endif
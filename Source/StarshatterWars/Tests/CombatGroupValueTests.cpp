@@ -0,0 +1,194 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         CombatGroupValueTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Benchmark of the cached group value and unit counts on the full
+	Alliance and Hegemony rosters.  Every group is asked for its value
+	and live unit count, as the planners ask, from the caches and by
+	walking the subtree each time as before; then with one unit lost
+	between passes, so only its branch is recounted; then the whole
+	assignment pass is timed on the rosters.  Skipped when the project
+	has no GameData.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "TestCampaign.h"
+#include "../Game/Campaign.h"
+#include "../Game/CampaignPlanAssignment.h"
+#include "../Game/Combatant.h"
+#include "../Game/CombatGroup.h"
+#include "../Game/CombatUnit.h"
+#include "../Foundation/Random.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	void CollectGroups(CombatGroup* g, List<CombatGroup>& groups, List<CombatUnit>& units)
+	{
+		groups.append(g);
+		units.append(g->GetUnits());
+
+		ListIter<CombatGroup> iter = g->GetComponents();
+		while (++iter)
+			CollectGroups(iter.value(), groups, units);
+	}
+
+	// the subtree walks CalcValue and CountUnits made on every call
+	// before they were cached:
+	int WalkValue(CombatGroup* g)
+	{
+		int val = 0;
+
+		ListIter<CombatUnit> unit = g->GetUnits();
+		while (++unit)
+			val += unit->GetValue();
+
+		ListIter<CombatGroup> comp = g->GetComponents();
+		while (++comp)
+			val += WalkValue(comp.value());
+
+		return val;
+	}
+
+	int WalkCount(CombatGroup* g)
+	{
+		int n = 0;
+
+		ListIter<CombatUnit> unit = g->GetUnits();
+		while (++unit)
+			n += unit->Count() - unit->DeadCount();
+
+		ListIter<CombatGroup> comp = g->GetComponents();
+		while (++comp)
+			if (!comp->IsReserve())
+				n += WalkCount(comp.value());
+
+		return n;
+	}
+
+	int64 QueryCached(List<CombatGroup>& groups)
+	{
+		int64 sum = 0;
+
+		for (int i = 0; i < groups.size(); i++)
+			sum += groups[i]->CalcValue() + groups[i]->CountUnits();
+
+		return sum;
+	}
+
+	int64 QueryWalked(List<CombatGroup>& groups)
+	{
+		int64 sum = 0;
+
+		for (int i = 0; i < groups.size(); i++)
+			sum += WalkValue(groups[i]) + WalkCount(groups[i]);
+
+		return sum;
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCombatGroupRosterValueBenchmarkTest,
+	"StarshatterWars.Game.CombatGroup.RosterValueBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FCombatGroupRosterValueBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const int PASSES = 200;
+	const int PLANS  = 20;
+
+	UCampaign* campaign = TestCampaign::CreateFromRosters(8);
+
+	if (!campaign) {
+		AddInfo(TEXT("no Alliance.def or Hegemony.def, skipped"));
+		return true;
+	}
+
+	List<CombatGroup> groups;
+	List<CombatUnit>  units;
+
+	ListIter<Combatant> iter = campaign->GetCombatants();
+	while (++iter)
+		CollectGroups(iter->GetForce(), groups, units);
+
+	// pass zero fills the caches and is not timed:
+	int64  cached_sum  = 0;
+	int64  walked_sum  = 0;
+	double cached_time = 0;
+	double walked_time = 0;
+
+	for (int n = 0; n <= PASSES; n++) {
+		double t0 = FPlatformTime::Seconds();
+		cached_sum = QueryCached(groups);
+		double t1 = FPlatformTime::Seconds();
+		walked_sum = QueryWalked(groups);
+		double t2 = FPlatformTime::Seconds();
+
+		if (n > 0) {
+			cached_time += t1 - t0;
+			walked_time += t2 - t1;
+		}
+	}
+
+	TestTrue(TEXT("cached values match the walk"), cached_sum == walked_sum);
+
+	// a unit lost between passes only dirties its own branch:
+	double churn_time = 0;
+
+	for (int n = 0; n < PASSES && units.size(); n++) {
+		CombatUnit* u = units[(n * 37) % units.size()];
+		u->SetDeadCount(u->DeadCount() ? 0 : 1);
+
+		double t0 = FPlatformTime::Seconds();
+		cached_sum = QueryCached(groups);
+		churn_time += FPlatformTime::Seconds() - t0;
+	}
+
+	TestTrue(TEXT("recounted values match the walk"), cached_sum == QueryWalked(groups));
+
+	// the assignment pass on the full rosters:
+	campaign->SetStatus(UCampaign::CAMPAIGN_ACTIVE);
+
+	UCampaignPlanAssignment* plan = NewObject<UCampaignPlanAssignment>(campaign);
+
+	RandomStream stream(0x5eed);
+	RandomScope  random(stream);
+
+	double plan_time = 0;
+
+	for (int n = 0; n <= PLANS; n++) {
+		double t0 = FPlatformTime::Seconds();
+
+		plan->SetCampaign(campaign);
+		plan->ExecFrame();
+
+		if (n > 0)
+			plan_time += FPlatformTime::Seconds() - t0;
+	}
+
+	AddInfo(FString::Printf(
+		TEXT("Rosters, %d groups, %d units: value and count of every group %.3f ms cached, %.3f ms walked (%.1fx), ")
+		TEXT("%.3f ms with one unit lost per pass; assignment pass %.3f ms"),
+		groups.size(), units.size(),
+		cached_time * 1e3 / PASSES,
+		walked_time * 1e3 / PASSES,
+		cached_time > 0 ? walked_time / cached_time : 0,
+		churn_time * 1e3 / PASSES,
+		plan_time * 1e3 / PLANS));
+
+	TestCampaign::Destroy(campaign);
+	return true;
+}
+
+#endif
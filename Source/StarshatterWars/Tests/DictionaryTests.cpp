@@ -0,0 +1,236 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         DictionaryTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Automation tests for the Foundation Dictionary template: a long
+	random run of inserts, lookups and removals checked against a
+	plain array of the same keys (so backward shift deletion is
+	exercised across wrapped probe runs and table growth), iteration
+	and copies, and a timing of insert, find and remove at a few
+	table sizes.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "../Foundation/Dictionary.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	Text KeyName(int i)
+	{
+		char name[32];
+		sprintf_s(name, 32, "key.%d", i);
+		return Text(name);
+	}
+
+	// every key in the dictionary, and no other, with the value the
+	// reference array holds for it:
+	bool SameContents(Dictionary<int>& dict, const int* values, const bool* present, const Text* keys, int count)
+	{
+		int expect = 0;
+
+		for (int i = 0; i < count; i++) {
+			int value = -1;
+
+			if (present[i]) {
+				expect++;
+
+				if (!dict.Lookup(keys[i], value) || value != values[i])
+					return false;
+
+				if (dict.Find(keys[i].data(), -1) != values[i])
+					return false;
+			}
+			else if (dict.Contains(keys[i]) || dict.Contains(keys[i].data())) {
+				return false;
+			}
+		}
+
+		return dict.Size() == expect;
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDictionaryRandomTest,
+	"StarshatterWars.Foundation.Dictionary.RandomOperations",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FDictionaryRandomTest::RunTest(const FString& Parameters)
+{
+	const int KEYS = 3000;
+	const int OPS  = 200000;
+
+	Text* keys    = new Text[KEYS];
+	int*  values  = new int[KEYS];
+	bool* present = new bool[KEYS];
+
+	for (int i = 0; i < KEYS; i++) {
+		keys[i]    = KeyName(i);
+		values[i]  = 0;
+		present[i] = false;
+	}
+
+	Dictionary<int> dict;
+	FRandomStream   rng(1138);
+	bool            same = true;
+
+	for (int n = 0; n < OPS && same; n++) {
+		int i  = rng.RandRange(0, KEYS - 1);
+		int op = rng.RandRange(0, 9);
+
+		// more inserts than removals, so the table grows through
+		// several sizes while holes keep opening up inside it:
+		if (op < 5) {
+			dict.Insert(keys[i], n);
+			values[i]  = n;
+			present[i] = true;
+		}
+		else if (op < 8) {
+			if (n & 1) dict.Remove(keys[i]);
+			else       dict.Remove(keys[i].data());
+
+			present[i] = false;
+		}
+		else {
+			int value = -1;
+			if (dict.Lookup(keys[i], value) != present[i] || (present[i] && value != values[i]))
+				same = false;
+		}
+
+		if (n % 10000 == 0)
+			same = same && SameContents(dict, values, present, keys, KEYS);
+	}
+
+	same = same && SameContents(dict, values, present, keys, KEYS);
+	TestTrue(TEXT("matches reference after random operations"), same);
+
+	// the iterator visits each key once:
+	int* seen    = new int[KEYS];
+	bool visited = true;
+
+	for (int i = 0; i < KEYS; i++)
+		seen[i] = 0;
+
+	DictionaryIter<int> iter = dict;
+	while (++iter) {
+		int i = atoi(iter.key().data() + 4);
+
+		if (i < 0 || i >= KEYS || !present[i] || iter.value() != values[i])
+			visited = false;
+		else
+			seen[i]++;
+	}
+
+	for (int i = 0; i < KEYS; i++)
+		if (seen[i] != (present[i] ? 1 : 0))
+			visited = false;
+
+	TestTrue(TEXT("iteration visits every key once"), visited);
+
+	// copies are independent of the original:
+	Dictionary<int> copy(dict);
+	TestTrue(TEXT("copy matches"), SameContents(copy, values, present, keys, KEYS));
+
+	copy.Clear();
+	TestEqual(TEXT("cleared copy"), copy.Size(), 0);
+	TestTrue(TEXT("original unchanged"), SameContents(dict, values, present, keys, KEYS));
+
+	// remove everything, in an order unrelated to insertion:
+	for (int i = KEYS - 1; i >= 0; i -= 2) dict.Remove(keys[i]);
+	for (int i = KEYS - 2; i >= 0; i -= 2) dict.Remove(keys[i]);
+
+	TestTrue(TEXT("empty after removing every key"), dict.IsEmpty() != 0);
+
+	// operator[] inserts a default value:
+	dict[keys[7]] += 5;
+	TestEqual(TEXT("operator[] default"), dict.Find(keys[7], -1), 5);
+
+	delete [] seen;
+	delete [] keys;
+	delete [] values;
+	delete [] present;
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDictionaryBenchmarkTest,
+	"StarshatterWars.Foundation.Dictionary.Benchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FDictionaryBenchmarkTest::RunTest(const FString& Parameters)
+{
+	static const int SIZES[] = { 1000, 100000, 1000000 };
+
+	for (int s = 0; s < UE_ARRAY_COUNT(SIZES); s++) {
+		const int COUNT = SIZES[s];
+
+		Text* keys   = new Text[COUNT];
+		Text* misses = new Text[COUNT];
+
+		for (int i = 0; i < COUNT; i++) {
+			keys[i]   = KeyName(i);
+			misses[i] = KeyName(COUNT + i);
+		}
+
+		Dictionary<int> dict;
+
+		double t0 = FPlatformTime::Seconds();
+
+		for (int i = 0; i < COUNT; i++)
+			dict.Insert(keys[i], i);
+
+		double t1 = FPlatformTime::Seconds();
+
+		int found = 0;
+		for (int i = 0; i < COUNT; i++)
+			found += dict.Contains(keys[i]);
+
+		double t2 = FPlatformTime::Seconds();
+
+		for (int i = 0; i < COUNT; i++)
+			found -= dict.Contains(misses[i]);
+
+		double t3 = FPlatformTime::Seconds();
+
+		for (int i = 0; i < COUNT; i++)
+			found += dict.Contains(keys[i].data());
+
+		double t4 = FPlatformTime::Seconds();
+
+		for (int i = 0; i < COUNT; i++)
+			dict.Remove(keys[i]);
+
+		double t5 = FPlatformTime::Seconds();
+
+		AddInfo(FString::Printf(
+			TEXT("Dictionary %7d: insert %.1f ns, find %.1f ns, miss %.1f ns, find by char* %.1f ns, remove %.1f ns per key"),
+			COUNT,
+			(t1 - t0) * 1e9 / COUNT,
+			(t2 - t1) * 1e9 / COUNT,
+			(t3 - t2) * 1e9 / COUNT,
+			(t4 - t3) * 1e9 / COUNT,
+			(t5 - t4) * 1e9 / COUNT));
+
+		TestEqual(TEXT("every key found"), found, 2 * COUNT);
+		TestTrue(TEXT("empty after removal"), dict.IsEmpty() != 0);
+
+		delete [] keys;
+		delete [] misses;
+	}
+
+	return true;
+}
+
+#endif
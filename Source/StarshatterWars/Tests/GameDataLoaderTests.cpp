@@ -0,0 +1,270 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         GameDataLoaderTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Startup benchmark for the content the game data loader reads
+	when play begins: every campaign, star system, ship design and
+	form.  Each file goes through the loader's single mapped read
+	and parse, and through the old ingestion that read it twice and
+	converted the whole text for the log.  The loader itself needs a
+	game instance and its data tables, so the files are found and
+	read the same way here.  Also a timing of the preload, which
+	parses a directory's files on the loader's TaskPool, at one to
+	eight threads.  Skipped when the project has no GameData.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "../Foundation/MappedFile.h"
+#include "../Foundation/ParsedFile.h"
+#include "../Foundation/TaskPool.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	struct ContentSet
+	{
+		const TCHAR* name;
+		const TCHAR* path;
+		const TCHAR* pattern;
+	};
+
+	// the directories AGameDataLoader::BeginPlay works through:
+	const ContentSet CONTENT[] = {
+		{ TEXT("campaigns"),    TEXT("GameData/Campaigns/"),       TEXT("campaign.def") },
+		{ TEXT("star systems"), TEXT("GameData/Galaxy/Systems/"),  TEXT("*.def")        },
+		{ TEXT("ship designs"), TEXT("GameData/Ships/"),           TEXT("*.def")        },
+		{ TEXT("forms"),        TEXT("GameData/Screens/"),         TEXT("*.frm")        },
+	};
+
+	void FindContent(const ContentSet& set, TArray<FString>& names)
+	{
+		FString Dir = FPaths::ProjectDir() / set.path;
+
+		// campaigns live one directory down, one per campaign:
+		if (set.pattern[0] != TEXT('*')) {
+			IFileManager::Get().FindFilesRecursive(names, *Dir, set.pattern, true, false);
+		}
+		else {
+			IFileManager::Get().FindFiles(names, *(Dir + set.pattern), true, false);
+
+			for (int i = 0; i < names.Num(); i++)
+				names[i] = Dir + names[i];
+		}
+	}
+
+	// the current path: one mapped read, parsed in place:
+	int LoadMapped(const FString& name)
+	{
+		MappedFile file;
+		if (!file.Open(TCHAR_TO_ANSI(*name)))
+			return 0;
+
+		ParsedFile content(TCHAR_TO_ANSI(*name));
+		content.Parse(file.GetData(), file.GetSize());
+
+		return content.NumTerms();
+	}
+
+	// the old path: the text read once for the log and converted for
+	// it, then the file read again into a buffer for the parser:
+	int LoadTwice(const FString& name, int& logged)
+	{
+		FString text;
+		if (FFileHelper::LoadFileToString(text, *name))
+			logged += FString::Printf(TEXT("%s"), *text).Len();
+
+		TArray<uint8> block;
+		if (!FFileHelper::LoadFileToArray(block, *name))
+			return 0;
+
+		block.Add(0);
+
+		ParsedFile content(TCHAR_TO_ANSI(*name));
+		content.Parse((const char*)block.GetData(), block.Num() - 1);
+
+		return content.NumTerms();
+	}
+
+	struct PreloadBatch
+	{
+		const TArray<FString>* names;
+		ParsedFile*            content;
+	};
+
+	// as AGameDataLoader::PreloadContent: each task maps and parses
+	// its own file into its own slot:
+	void PreloadTask(void* param, int index)
+	{
+		PreloadBatch* batch = (PreloadBatch*)param;
+
+		MappedFile file;
+		if (file.Open(TCHAR_TO_ANSI(*(*batch->names)[index])))
+			batch->content[index].Parse(file.GetData(), file.GetSize());
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameDataLoaderStartupBenchmarkTest,
+	"StarshatterWars.Game.GameDataLoader.StartupBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FGameDataLoaderStartupBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const int PASSES = 3;
+
+	int    files       = 0;
+	double mapped_time = 0;
+	double twice_time  = 0;
+
+	for (int c = 0; c < UE_ARRAY_COUNT(CONTENT); c++) {
+		TArray<FString> names;
+		FindContent(CONTENT[c], names);
+
+		if (!names.Num())
+			continue;
+
+		int mapped_terms = 0;
+		int twice_terms  = 0;
+		int logged       = 0;
+
+		// once through each path first, so both start from a warm
+		// file cache:
+		for (int i = 0; i < names.Num(); i++) {
+			LoadMapped(names[i]);
+			LoadTwice(names[i], logged);
+		}
+
+		logged = 0;
+
+		double t0 = FPlatformTime::Seconds();
+
+		for (int n = 0; n < PASSES; n++)
+			for (int i = 0; i < names.Num(); i++)
+				mapped_terms += LoadMapped(names[i]);
+
+		double t1 = FPlatformTime::Seconds();
+
+		for (int n = 0; n < PASSES; n++)
+			for (int i = 0; i < names.Num(); i++)
+				twice_terms += LoadTwice(names[i], logged);
+
+		double t2 = FPlatformTime::Seconds();
+
+		TestEqual(FString::Printf(TEXT("%s: both paths parse the same terms"), CONTENT[c].name), mapped_terms, twice_terms);
+
+		AddInfo(FString::Printf(
+			TEXT("Startup %s, %d files: single read %.2f ms, double read and log %.2f ms (%.1f KB of log text)"),
+			CONTENT[c].name, names.Num(),
+			(t1 - t0) * 1e3 / PASSES,
+			(t2 - t1) * 1e3 / PASSES,
+			logged / 1024.0 / PASSES));
+
+		files       += names.Num();
+		mapped_time += t1 - t0;
+		twice_time  += t2 - t1;
+	}
+
+	if (!files) {
+		AddInfo(TEXT("no GameData content, skipped"));
+		return true;
+	}
+
+	AddInfo(FString::Printf(
+		TEXT("Startup content, %d files: single read %.1f ms, double read and log %.1f ms"),
+		files,
+		mapped_time * 1e3 / PASSES,
+		twice_time * 1e3 / PASSES));
+
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FGameDataLoaderPreloadScalingTest,
+	"StarshatterWars.Game.GameDataLoader.PreloadScaling",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FGameDataLoaderPreloadScalingTest::RunTest(const FString& Parameters)
+{
+	static const int THREADS[] = { 1, 2, 4, 8 };
+
+	const int PASSES = 3;
+
+	TArray<FString> names;
+	for (int c = 0; c < UE_ARRAY_COUNT(CONTENT); c++) {
+		TArray<FString> set;
+		FindContent(CONTENT[c], set);
+		names.Append(set);
+	}
+
+	if (!names.Num()) {
+		AddInfo(TEXT("no GameData content, skipped"));
+		return true;
+	}
+
+	// one pool for the whole run, resized between thread counts, as
+	// the loader keeps its own:
+	TaskPool pool(1);
+	double   serial_time  = 0;
+	int      serial_terms = -1;
+
+	for (int t = 0; t < UE_ARRAY_COUNT(THREADS); t++) {
+		const int N = THREADS[t];
+		pool.SetThreads(N);
+
+		double time  = 0;
+		int    terms = 0;
+
+		// pass zero starts the workers and warms the file cache:
+		for (int n = 0; n <= PASSES; n++) {
+			ParsedFile*  content = new ParsedFile[names.Num()];
+			PreloadBatch batch;
+			batch.names   = &names;
+			batch.content = content;
+
+			double t0 = FPlatformTime::Seconds();
+			pool.Run(names.Num(), PreloadTask, &batch);
+			double t1 = FPlatformTime::Seconds();
+
+			terms = 0;
+			for (int i = 0; i < names.Num(); i++)
+				terms += content[i].NumTerms();
+
+			delete [] content;
+
+			if (n > 0)
+				time += t1 - t0;
+		}
+
+		if (serial_terms < 0) {
+			serial_terms = terms;
+			serial_time  = time;
+		}
+
+		TestEqual(FString::Printf(TEXT("%d threads parse the same terms"), N), terms, serial_terms);
+
+		AddInfo(FString::Printf(
+			TEXT("Preload %d files, %d threads: %.1f ms, %.2fx the single thread"),
+			names.Num(), N,
+			time * 1e3 / PASSES,
+			serial_time / time));
+	}
+
+	return true;
+}
+
+#endif
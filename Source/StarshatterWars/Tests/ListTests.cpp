@@ -0,0 +1,162 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         ListTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Automation tests for the Foundation List template: insertSort
+	ordering against the original linear scan, and a timing of bulk
+	append and sorted insert at a few list sizes.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "../Foundation/List.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	struct SortItem
+	{
+		int key;
+		int order;
+
+		int operator <  (const SortItem& s) const { return key <  s.key; }
+		int operator == (const SortItem& s) const { return this == &s;   }
+	};
+
+	// the insertSort this list used to have, for reference:
+	void LinearInsertSort(List<SortItem>& list, SortItem* item)
+	{
+		int i = 0;
+		for (; i < list.size(); i++)
+			if (*item < *list[i])
+				break;
+
+		list.insert(item, i);
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FListInsertSortTest,
+	"StarshatterWars.Foundation.List.InsertSort",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FListInsertSortTest::RunTest(const FString& Parameters)
+{
+	const int COUNT = 2000;
+
+	SortItem* items = new SortItem[COUNT];
+	FRandomStream rng(1138);
+
+	for (int i = 0; i < COUNT; i++) {
+		items[i].key   = rng.RandRange(0, 99);   // plenty of equal keys
+		items[i].order = i;
+	}
+
+	List<SortItem> binary;
+	List<SortItem> linear;
+
+	for (int i = 0; i < COUNT; i++) {
+		binary.insertSort(&items[i]);
+		LinearInsertSort(linear, &items[i]);
+	}
+
+	TestEqual(TEXT("size"), binary.size(), COUNT);
+
+	bool same = true;
+	bool stable = true;
+
+	for (int i = 0; i < COUNT; i++) {
+		if (binary[i] != linear[i])
+			same = false;
+
+		if (i > 0) {
+			const SortItem* a = binary[i-1];
+			const SortItem* b = binary[i];
+
+			if (b->key < a->key || (b->key == a->key && b->order < a->order))
+				stable = false;
+		}
+	}
+
+	TestTrue(TEXT("binary insert matches linear insert"), same);
+	TestTrue(TEXT("sorted and stable"), stable);
+
+	delete [] items;
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FListBenchmarkTest,
+	"StarshatterWars.Foundation.List.Benchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FListBenchmarkTest::RunTest(const FString& Parameters)
+{
+	static const int SIZES[] = { 1000, 10000, 50000 };
+
+	for (int s = 0; s < UE_ARRAY_COUNT(SIZES); s++) {
+		const int COUNT = SIZES[s];
+
+		SortItem* items = new SortItem[COUNT];
+		FRandomStream rng(COUNT);
+
+		for (int i = 0; i < COUNT; i++) {
+			items[i].key   = rng.RandRange(0, COUNT);
+			items[i].order = i;
+		}
+
+		double t0 = FPlatformTime::Seconds();
+
+		List<SortItem> appended;
+		for (int i = 0; i < COUNT; i++)
+			appended.append(&items[i]);
+
+		double t1 = FPlatformTime::Seconds();
+
+		List<SortItem> reserved;
+		reserved.reserve(COUNT);
+		for (int i = 0; i < COUNT; i++)
+			reserved.append(&items[i]);
+
+		double t2 = FPlatformTime::Seconds();
+
+		List<SortItem> binary;
+		for (int i = 0; i < COUNT; i++)
+			binary.insertSort(&items[i]);
+
+		double t3 = FPlatformTime::Seconds();
+
+		List<SortItem> linear;
+		for (int i = 0; i < COUNT; i++)
+			LinearInsertSort(linear, &items[i]);
+
+		double t4 = FPlatformTime::Seconds();
+
+		AddInfo(FString::Printf(
+			TEXT("List %6d: append %.3f ms, reserved append %.3f ms, insertSort %.3f ms, linear insert %.3f ms"),
+			COUNT,
+			(t1 - t0) * 1e3,
+			(t2 - t1) * 1e3,
+			(t3 - t2) * 1e3,
+			(t4 - t3) * 1e3));
+
+		TestEqual(TEXT("insertSort size"), binary.size(), COUNT);
+
+		delete [] items;
+	}
+
+	return true;
+}
+
+#endif
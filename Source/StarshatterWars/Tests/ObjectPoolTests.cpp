@@ -0,0 +1,236 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         ObjectPoolTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Automation tests for ObjectPool: freed slots are handed out again
+	without new blocks, objects made with no pool or too large for
+	their pool come from the heap, and a plain delete returns each
+	object to the pool recorded in its slot.  Also a benchmark of the
+	assignment planner's pools over repeated passes, counting the
+	blocks they hold and timing each pass.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "TestCampaign.h"
+#include "../Foundation/ObjectPool.h"
+#include "../Foundation/Random.h"
+#include "../Foundation/List.h"
+#include "../Game/Campaign.h"
+#include "../Game/CampaignPlanAssignment.h"
+#include "../Game/Combatant.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	// opts in to the pool the same way CombatAssignment does:
+	class Item
+	{
+	public:
+		Item(int v = 0) : value(v) { }
+
+		static void* operator new(size_t size) { return ObjectPool::New(0, size); }
+		static void* operator new(size_t size, ObjectPool* pool) { return ObjectPool::New(pool, size); }
+		static void  operator delete(void* p) { ObjectPool::Delete(p); }
+		static void  operator delete(void* p, ObjectPool*) { ObjectPool::Delete(p); }
+
+		int operator == (const Item& i) const { return this == &i; }
+
+		int      value;
+		double   pad[4];
+	};
+
+	int CountBlocks(UCampaign* campaign)
+	{
+		int blocks = 0;
+
+		ListIter<Combatant> iter = campaign->GetCombatants();
+		while (++iter)
+			blocks += iter->GetAssignmentPool().NumBlocks();
+
+		return blocks;
+	}
+
+	int CountAllocs(UCampaign* campaign)
+	{
+		int allocs = 0;
+
+		ListIter<Combatant> iter = campaign->GetCombatants();
+		while (++iter)
+			allocs += iter->GetAssignmentPool().NumAllocs();
+
+		return allocs;
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FObjectPoolReuseTest,
+	"StarshatterWars.Foundation.ObjectPool.Reuse",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FObjectPoolReuseTest::RunTest(const FString& Parameters)
+{
+	const int SLOTS = 8;
+
+	ObjectPool pool(sizeof(Item), SLOTS);
+	Item*      items[SLOTS];
+
+	for (int i = 0; i < SLOTS; i++)
+		items[i] = new(&pool) Item(i);
+
+	TestEqual(TEXT("one block for a full pass"), pool.NumBlocks(), 1);
+	TestEqual(TEXT("every item live"),           pool.NumLive(), SLOTS);
+
+	// the last slot freed is the first handed out again:
+	Item* last = items[SLOTS - 1];
+
+	for (int i = 0; i < SLOTS; i++)
+		delete items[i];
+
+	TestEqual(TEXT("nothing live"), pool.NumLive(), 0);
+
+	Item* again = new(&pool) Item(1);
+	TestTrue(TEXT("freed slot reused"), again == last);
+	delete again;
+
+	for (int i = 0; i < SLOTS; i++)
+		items[i] = new(&pool) Item(i);
+
+	TestEqual(TEXT("second pass needs no block"), pool.NumBlocks(), 1);
+	TestEqual(TEXT("allocs counted"),             pool.NumAllocs(), 2 * SLOTS + 1);
+
+	// one more than a block holds grows the pool once:
+	Item* extra = new(&pool) Item(SLOTS);
+	TestEqual(TEXT("overflow grows one block"), pool.NumBlocks(), 2);
+
+	delete extra;
+
+	for (int i = 0; i < SLOTS; i++)
+		delete items[i];
+
+	TestEqual(TEXT("all returned"), pool.NumLive(), 0);
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FObjectPoolRoutingTest,
+	"StarshatterWars.Foundation.ObjectPool.Routing",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FObjectPoolRoutingTest::RunTest(const FString& Parameters)
+{
+	ObjectPool first(sizeof(Item), 4);
+	ObjectPool second(sizeof(Item), 4);
+	ObjectPool tiny(sizeof(int), 4);
+
+	// no pool, or a pool whose slots are too small, falls back to
+	// the heap without touching the pool:
+	Item* loose = new Item(1);
+	Item* large = new(&tiny) Item(2);
+
+	TestEqual(TEXT("tiny pool untouched"), tiny.NumAllocs(), 0);
+	TestEqual(TEXT("tiny pool has no block"), tiny.NumBlocks(), 0);
+
+	// a plain delete finds the owning pool through the slot, however
+	// the objects are mixed together:
+	List<Item> items;
+
+	for (int i = 0; i < 6; i++)
+		items.append(new(i % 2 ? &second : &first) Item(i));
+
+	items.append(loose);
+	items.append(large);
+
+	TestEqual(TEXT("first pool live"),  first.NumLive(),  3);
+	TestEqual(TEXT("second pool live"), second.NumLive(), 3);
+
+	delete items.removeIndex(1);
+
+	TestEqual(TEXT("delete went to the second pool"), second.NumLive(), 2);
+	TestEqual(TEXT("first pool untouched"),           first.NumLive(),  3);
+
+	// List::destroy deletes through the same path:
+	items.destroy();
+
+	TestEqual(TEXT("first pool emptied"),  first.NumLive(),  0);
+	TestEqual(TEXT("second pool emptied"), second.NumLive(), 0);
+	TestEqual(TEXT("tiny pool untouched"), tiny.NumLive(), 0);
+
+	ObjectPool::Delete(0);
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FObjectPoolPassBenchmarkTest,
+	"StarshatterWars.Foundation.ObjectPool.PassBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FObjectPoolPassBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const int PASSES = 100;
+
+	UCampaign* campaign = TestCampaign::Create(8, 16);
+	campaign->SetStatus(UCampaign::CAMPAIGN_ACTIVE);
+
+	UCampaignPlanAssignment* plan = NewObject<UCampaignPlanAssignment>(campaign);
+
+	RandomStream stream(0x5eed);
+	RandomScope  random(stream);
+
+	int    first_blocks = 0;
+	int    first_allocs = 0;
+	double total_time   = 0;
+	double worst_time   = 0;
+
+	// pass zero grows the pools and is not timed:
+	for (int n = 0; n <= PASSES; n++) {
+		double t0 = FPlatformTime::Seconds();
+
+		plan->SetCampaign(campaign);
+		plan->ExecFrame();
+
+		double t = FPlatformTime::Seconds() - t0;
+
+		if (n == 0) {
+			first_blocks = CountBlocks(campaign);
+			first_allocs = CountAllocs(campaign);
+		}
+		else {
+			total_time += t;
+
+			if (t > worst_time)
+				worst_time = t;
+		}
+	}
+
+	int blocks = CountBlocks(campaign);
+	int allocs = CountAllocs(campaign);
+
+	TestTrue(TEXT("assignments made from the pools"), first_allocs > 0);
+	TestEqual(TEXT("no blocks after the first pass"), blocks, first_blocks);
+
+	AddInfo(FString::Printf(
+		TEXT("Assignment pools, %d passes: %d blocks after the first pass, %d after the last, ")
+		TEXT("%.1f assignments per pass; %.3f ms per pass, %.3f ms worst"),
+		PASSES, first_blocks, blocks,
+		(allocs - first_allocs) / (double)PASSES,
+		total_time * 1e3 / PASSES,
+		worst_time * 1e3));
+
+	TestCampaign::Destroy(campaign);
+	return true;
+}
+
+#endif
@@ -0,0 +1,471 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         ParserTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Benchmarks for the definition file parser, run over the content
+	in the project's GameData directory: the parser alone, with the
+	files already in memory, and a full content load through mapped
+	files against the old read and copy path.  Skipped when the
+	project has no GameData.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "../Foundation/MappedFile.h"
+#include "../Foundation/ParsedFile.h"
+#include "../Foundation/Parser.h"
+#include "../Foundation/Reader.h"
+#include "../Foundation/Term.h"
+#include "../Foundation/Symbol.h"
+#include "../Foundation/Text.h"
+#include "../Foundation/TermArena.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	// every file under GameData matching the pattern, read into
+	// memory and null terminated.  returns the total size:
+	int LoadSources(const TCHAR* pattern, TArray<FString>& names, TArray<TArray<uint8>>& blocks)
+	{
+		FString Dir = FPaths::ProjectDir() / TEXT("GameData/");
+		IFileManager::Get().FindFilesRecursive(names, *Dir, pattern, true, false);
+		names.Sort();
+
+		int total = 0;
+
+		for (int i = 0; i < names.Num(); i++) {
+			TArray<uint8> block;
+			FFileHelper::LoadFileToArray(block, *names[i]);
+
+			total += block.Num();
+			block.Add(0);
+			blocks.Add(block);
+		}
+
+		return total;
+	}
+
+	const char* Source(const TArray<uint8>& block) { return (const char*)block.GetData(); }
+	int         Length(const TArray<uint8>& block) { return block.Num() - 1; }
+
+	// parses one file onto the heap and deletes the terms again:
+	int ParseFile(const TArray<uint8>& block, int& errors)
+	{
+		Parser parser(new BlockReader(Source(block), Length(block)));
+
+		int   terms = 0;
+		Term* term  = parser.ParseTerm();
+
+		while (term) {
+			terms++;
+			delete term;
+			term = parser.ParseTerm();
+		}
+
+		errors += parser.NumErrors();
+		return terms;
+	}
+
+	// the reader the content loaders used before files were mapped.
+	// it hands the scanner a copy of the block, and the scanner takes
+	// a copy of its own:
+	class CopyReader : public Reader
+	{
+	public:
+		CopyReader(const char* b, int n) : block(b), len(n), done(false) { }
+
+		virtual Text more()
+		{
+			if (done)
+				return Text();
+
+			done = true;
+			return Text(block, len);
+		}
+
+	private:
+		const char* block;
+		int         len;
+		bool        done;
+	};
+
+	// parses one file and frees the terms one top level term at a
+	// time, the way the loaders do.  with an arena the deletes only
+	// run destructors, and Reset gives the memory back in one go:
+	int ParseAndFree(const TArray<uint8>& block, TermArena* arena)
+	{
+		Parser parser(new BlockReader(Source(block), Length(block)), arena);
+
+		int   terms = 0;
+		Term* term  = parser.ParseTerm();
+
+		while (term) {
+			terms++;
+			delete term;
+			term = parser.ParseTerm();
+		}
+
+		if (arena)
+			arena->Reset();
+
+		return terms;
+	}
+
+	double ResidentMB()
+	{
+		return FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+	}
+
+	void CollectKeys(Term* term, List<TermText>& keys)
+	{
+		if (!term)
+			return;
+
+		TermList* elements = 0;
+
+		if (term->isDef()) {
+			keys.append(term->isDef()->name());
+			CollectKeys(term->isDef()->term(), keys);
+		}
+		else if (term->isStruct()) {
+			elements = term->isStruct()->elements();
+		}
+		else if (term->isArray()) {
+			elements = term->isArray()->elements();
+		}
+
+		if (elements)
+			for (int i = 0; i < elements->size(); i++)
+				CollectKeys(elements->at(i), keys);
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FParserBenchmarkTest,
+	"StarshatterWars.Foundation.Parser.Benchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FParserBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const int PASSES = 5;
+
+	TArray<FString>       names;
+	TArray<TArray<uint8>> blocks;
+
+	int bytes = LoadSources(TEXT("*.def"), names, blocks);
+
+	if (!names.Num()) {
+		AddInfo(TEXT("no GameData definition files, skipped"));
+		return true;
+	}
+
+	// the first pass interns every key, the rest find them:
+	int errors = 0;
+	int terms  = 0;
+
+	for (int i = 0; i < blocks.Num(); i++)
+		terms += ParseFile(blocks[i], errors);
+
+	long   text_blocks = TextRep::NumHeapBlocks();
+	double t0          = FPlatformTime::Seconds();
+
+	for (int n = 0; n < PASSES; n++)
+		for (int i = 0; i < blocks.Num(); i++)
+			ParseFile(blocks[i], errors);
+
+	double t1 = FPlatformTime::Seconds();
+
+	text_blocks = TextRep::NumHeapBlocks() - text_blocks;
+
+	TestEqual(TEXT("GameData parses without errors"), errors, 0);
+
+	AddInfo(FString::Printf(
+		TEXT("Parser: %d files, %.1f KB, %d top level terms: %.2f ms per pass, %.1f MB/s, %.1f text heap blocks per term, %d symbols"),
+		names.Num(), bytes / 1024.0, terms,
+		(t1 - t0) * 1e3 / PASSES,
+		bytes * PASSES / (t1 - t0) / (1024 * 1024),
+		(double)text_blocks / PASSES / terms,
+		Symbol::Count()));
+
+	// every key in GameData, dispatched the way the loaders used to
+	// (walking a chain of text compares over the predefined keys) and
+	// the way they do now (one switch on the symbol id, which the
+	// compiler turns into a table lookup):
+	List<Term>     roots;
+	List<TermText> keys;
+
+	for (int i = 0; i < blocks.Num(); i++) {
+		Parser parser(new BlockReader(Source(blocks[i]), Length(blocks[i])));
+
+		Term* term = parser.ParseTerm();
+		while (term) {
+			roots.append(term);
+			CollectKeys(term, keys);
+			term = parser.ParseTerm();
+		}
+	}
+
+	const int CHAIN = SYM_PREDEFINED;
+
+	Text* chain = new Text[CHAIN];
+	for (int i = 0; i < CHAIN; i++)
+		chain[i] = Symbol(i).GetText();
+
+	int by_text = 0;
+	int by_sym  = 0;
+
+	double t2 = FPlatformTime::Seconds();
+
+	for (int k = 0; k < keys.size(); k++) {
+		Text name = keys[k]->value();
+
+		for (int i = 1; i < CHAIN; i++) {
+			if (name == chain[i]) {
+				by_text += i;
+				break;
+			}
+		}
+	}
+
+	double t3 = FPlatformTime::Seconds();
+
+	for (int k = 0; k < keys.size(); k++) {
+		int sym = keys[k]->symbol();
+
+		if (sym > SYM_NONE && sym < CHAIN)
+			by_sym += sym;
+	}
+
+	double t4 = FPlatformTime::Seconds();
+
+	TestEqual(TEXT("symbols match the keys they stand for"), by_sym, by_text);
+
+	AddInfo(FString::Printf(
+		TEXT("Key dispatch over %d keys: %.1f ns per key by text, %.1f ns per key by symbol"),
+		keys.size(),
+		(t3 - t2) * 1e9 / keys.size(),
+		(t4 - t3) * 1e9 / keys.size()));
+
+	delete [] chain;
+	keys.clear();
+	roots.destroy();
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FContentLoadBenchmarkTest,
+	"StarshatterWars.Foundation.MappedFile.ContentLoad",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FContentLoadBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const int PASSES = 3;
+
+	// every definition file and every form, as the loader reads them:
+	TArray<FString> names;
+	FString         Dir = FPaths::ProjectDir() / TEXT("GameData/");
+
+	IFileManager::Get().FindFilesRecursive(names, *Dir, TEXT("*.def"), true, false);
+	IFileManager::Get().FindFilesRecursive(names, *Dir, TEXT("*.frm"), true, false, false);
+
+	if (!names.Num()) {
+		AddInfo(TEXT("no GameData content files, skipped"));
+		return true;
+	}
+
+	double mapped_time = 0, read_time = 0;
+	double mapped_peak = 0, read_peak = 0;
+	int    mapped_terms = 0, read_terms = 0;
+	int    num_mapped = 0;
+
+	long   mapped_blocks = 0, read_blocks = 0;
+
+	// the first pass only warms the allocator and the file cache, and
+	// the order alternates after that, so neither path pays for
+	// growing the heap the other one then reuses:
+	for (int n = 0; n <= PASSES; n++) {
+		for (int m = 0; m < 2; m++) {
+			int mode = (n + m) & 1;
+			// both paths keep every term until the whole load is done,
+			// as the loader does:
+			TermArena  arena;
+			List<Term> terms;
+
+			long   b0   = TextRep::NumHeapBlocks();
+			double base = ResidentMB();
+			double peak = base;
+			double t0   = FPlatformTime::Seconds();
+
+			for (int i = 0; i < names.Num(); i++) {
+				MappedFile    file;
+				TArray<uint8> block;
+				Reader*       reader = 0;
+
+				// mapped: the scanner reads the view in place, and the
+				// view is closed as soon as the file is parsed.
+				// read: the file is read into a heap buffer, then copied
+				// twice more on its way into the scanner:
+				if (mode == 0) {
+					if (file.Open(TCHAR_TO_ANSI(*names[i]))) {
+						reader = new BlockReader(file.GetData(), file.GetSize());
+						num_mapped += file.IsMapped();
+					}
+				}
+				else if (FFileHelper::LoadFileToArray(block, *names[i])) {
+					reader = new CopyReader((const char*)block.GetData(), block.Num());
+				}
+
+				if (reader) {
+					Parser parser(reader, &arena);
+
+					Term* term = parser.ParseTerm();
+					while (term) {
+						terms.append(term);
+						term = parser.ParseTerm();
+					}
+				}
+
+				peak = FMath::Max(peak, ResidentMB());
+			}
+
+			double t1     = FPlatformTime::Seconds();
+			long   blocks = TextRep::NumHeapBlocks() - b0;
+
+			if (n == 0) {
+				num_mapped = 0;
+			}
+			else if (mode == 0) {
+				mapped_time  += t1 - t0;
+				mapped_peak   = FMath::Max(mapped_peak, peak - base);
+				mapped_terms  = terms.size();
+				mapped_blocks = blocks;
+			}
+			else {
+				read_time  += t1 - t0;
+				read_peak   = FMath::Max(read_peak, peak - base);
+				read_terms  = terms.size();
+				read_blocks = blocks;
+			}
+
+			terms.destroy();
+		}
+	}
+
+	TestEqual(TEXT("both paths load the same terms"), mapped_terms, read_terms);
+
+	// the process high water mark only moves if this load sets it,
+	// so the growth over the resident size at the start is reported
+	// alongside it:
+	AddInfo(FString::Printf(
+		TEXT("Content load, %d files (%d mapped): mapped %.1f ms, %ld text heap blocks, peak growth %.1f MB; read %.1f ms, %ld text heap blocks, peak growth %.1f MB; process peak %.1f MB"),
+		names.Num(), num_mapped / PASSES,
+		mapped_time * 1e3 / PASSES, mapped_blocks, mapped_peak,
+		read_time * 1e3 / PASSES, read_blocks, read_peak,
+		FPlatformMemory::GetStats().PeakUsedPhysical / (1024.0 * 1024.0)));
+
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTermArenaBenchmarkTest,
+	"StarshatterWars.Foundation.TermArena.Benchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FTermArenaBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const int PASSES = 10;
+
+	// the campaign files are the largest in GameData:
+	TArray<FString>       names;
+	TArray<TArray<uint8>> blocks;
+
+	FString Dir   = FPaths::ProjectDir() / TEXT("GameData/Campaigns/");
+	int     bytes = 0;
+
+	IFileManager::Get().FindFilesRecursive(names, *Dir, TEXT("*.def"), true, false);
+	names.Sort();
+
+	for (int i = 0; i < names.Num(); i++) {
+		TArray<uint8> block;
+		FFileHelper::LoadFileToArray(block, *names[i]);
+
+		bytes += block.Num();
+		block.Add(0);
+		blocks.Add(block);
+	}
+
+	if (!names.Num()) {
+		AddInfo(TEXT("no GameData campaign files, skipped"));
+		return true;
+	}
+
+	// one untimed pass of each, which also counts what the arena
+	// hands out.  on the heap every one of those is its own new:
+	TermArena arena;
+	int       heap_terms   = 0;
+	int       arena_terms  = 0;
+	int       term_allocs  = 0;
+	int       arena_blocks = 0;
+
+	for (int i = 0; i < blocks.Num(); i++) {
+		heap_terms += ParseAndFree(blocks[i], 0);
+
+		Parser parser(new BlockReader(Source(blocks[i]), Length(blocks[i])), &arena);
+		for (Term* term = parser.ParseTerm(); term; term = parser.ParseTerm()) {
+			arena_terms++;
+			delete term;
+		}
+
+		term_allocs  += arena.NumAllocs();
+		arena_blocks += arena.NumBlocks();
+		arena.Reset();
+	}
+
+	TestEqual(TEXT("both modes parse the same terms"), arena_terms, heap_terms);
+
+	// the passes alternate, so drift in the machine's load is shared:
+	double heap_time  = 0;
+	double arena_time = 0;
+
+	for (int n = 0; n < PASSES; n++) {
+		double t0 = FPlatformTime::Seconds();
+
+		for (int i = 0; i < blocks.Num(); i++)
+			ParseAndFree(blocks[i], 0);
+
+		double t1 = FPlatformTime::Seconds();
+
+		for (int i = 0; i < blocks.Num(); i++)
+			ParseAndFree(blocks[i], &arena);
+
+		double t2 = FPlatformTime::Seconds();
+
+		heap_time  += t1 - t0;
+		arena_time += t2 - t1;
+	}
+
+	AddInfo(FString::Printf(
+		TEXT("Campaigns, %d files, %.1f KB: heap %.2f ms per pass, %d term allocations; arena %.2f ms per pass, %d block allocations"),
+		names.Num(), bytes / 1024.0,
+		heap_time * 1e3 / PASSES, term_allocs,
+		arena_time * 1e3 / PASSES, arena_blocks));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,232 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         PhysicalBatchTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Automation tests for PhysicalBatch: a frame of the batch moves
+	every body where the per object integrator would, handles stay
+	valid across removals, and a benchmark of frame time against
+	body count for the batch and for one virtual call chain per
+	object.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "../Game/PhysicalBatch.h"
+#include "../Foundation/Random.h"
+#include <math.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	const double SUB_FRAME = 1.0 / 60.0;
+
+	// the per object path: one virtual call chain per object per
+	// slice, with the exponentials taken every slice:
+	class Body
+	{
+	public:
+		virtual ~Body() { }
+
+		virtual void ExecFrame(double s)
+		{
+			while (s > 0) {
+				double t = s > SUB_FRAME ? SUB_FRAME : s;
+
+				AngularFrame(t);
+				LinearFrame(t);
+
+				s -= t;
+			}
+		}
+
+		virtual void AngularFrame(double t)
+		{
+			dr = (dr + dr_acc * t) * exp(-dr_drg * t);
+			dp = (dp + dp_acc * t) * exp(-dp_drg * t);
+			dy = (dy + dy_acc * t) * exp(-dy_drg * t);
+		}
+
+		virtual void LinearFrame(double t)
+		{
+			vel += acc * t;
+			vel.y -= g * t;
+			vel *= exp(-drag * t);
+			loc += vel * t;
+		}
+
+		Point  loc, vel, acc;
+		double drag, g;
+		double dr, dp, dy;
+		double dr_acc, dp_acc, dy_acc;
+		double dr_drg, dp_drg, dy_drg;
+	};
+
+	// the batch keeps drag, gravity and the angular terms in single
+	// precision, so the reference starts from the same rounded values:
+	double Single(double d) { return (float)d; }
+
+	void RandomBody(RandomStream& rng, Body& b)
+	{
+		b.loc    = Point(rng.Double(-1e4, 1e4), rng.Double(-1e4, 1e4), rng.Double(-1e4, 1e4));
+		b.vel    = Point(rng.Double(-200, 200), rng.Double(-200, 200), rng.Double(-200, 200));
+		b.acc    = Point(rng.Double(-50, 50),   rng.Double(-50, 50),   rng.Double(-50, 50));
+		b.drag   = Single(rng.Double(0, 0.5));
+		b.g      = Single(rng.Double(0, 10));
+		b.dr     = Single(rng.Double(-1, 1));
+		b.dp     = Single(rng.Double(-1, 1));
+		b.dy     = Single(rng.Double(-1, 1));
+		b.dr_acc = Single(rng.Double(-2, 2));
+		b.dp_acc = Single(rng.Double(-2, 2));
+		b.dy_acc = Single(rng.Double(-2, 2));
+		b.dr_drg = Single(rng.Double(0, 4));
+		b.dp_drg = Single(rng.Double(0, 4));
+		b.dy_drg = Single(rng.Double(0, 4));
+	}
+
+	void PushBody(PhysicalBatch& batch, int h, const Body& b)
+	{
+		batch.SetLocation(h, b.loc);
+		batch.SetVelocity(h, b.vel);
+		batch.SetThrust(h, b.acc);
+		batch.SetDrag(h, b.drag);
+		batch.SetGravity(h, b.g);
+		batch.SetRotation(h, b.dr, b.dp, b.dy);
+		batch.SetAngularAccel(h, b.dr_acc, b.dp_acc, b.dy_acc);
+		batch.SetAngularDrag(h, b.dr_drg, b.dp_drg, b.dy_drg);
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPhysicalBatchIntegrateTest,
+	"StarshatterWars.Game.PhysicalBatch.Integrate",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FPhysicalBatchIntegrateTest::RunTest(const FString& Parameters)
+{
+	const int    COUNT   = 1000;
+	const double SECONDS = 0.25;
+
+	RandomStream  rng(0x5eed);
+	PhysicalBatch batch;
+	Body*         bodies  = new Body[COUNT];
+	int*          handles = new int[COUNT];
+
+	for (int i = 0; i < COUNT; i++) {
+		RandomBody(rng, bodies[i]);
+		handles[i] = batch.Add();
+		PushBody(batch, handles[i], bodies[i]);
+	}
+
+	// removing bodies compacts the slots behind the handles:
+	for (int i = 0; i < COUNT; i += 7)
+		batch.Remove(handles[i]);
+
+	batch.Integrate(SECONDS, SUB_FRAME);
+
+	double worst = 0;
+	bool   valid = true;
+
+	for (int i = 0; i < COUNT; i++) {
+		if (i % 7 == 0) {
+			if (batch.IsValid(handles[i]))
+				valid = false;
+			continue;
+		}
+
+		if (!batch.IsValid(handles[i])) {
+			valid = false;
+			continue;
+		}
+
+		bodies[i].ExecFrame(SECONDS);
+
+		Point  d   = batch.GetLocation(handles[i]) - bodies[i].loc;
+		double err = d.length() / (bodies[i].loc.length() + 1);
+
+		if (err > worst)
+			worst = err;
+
+		double r, p, y;
+		batch.GetRotation(handles[i], r, p, y);
+
+		// angular rates are kept in single precision:
+		if (fabs(r - bodies[i].dr) > 1e-5 || fabs(p - bodies[i].dp) > 1e-5 || fabs(y - bodies[i].dy) > 1e-5)
+			valid = false;
+	}
+
+	TestEqual(TEXT("bodies left"), batch.NumBodies(), COUNT - (COUNT + 6) / 7);
+	TestTrue(TEXT("handles survive removals, rates match"), valid);
+	TestTrue(FString::Printf(TEXT("positions match per object path (%g)"), worst), worst < 1e-9);
+
+	delete [] bodies;
+	delete [] handles;
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPhysicalBatchBenchmarkTest,
+	"StarshatterWars.Game.PhysicalBatch.Benchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FPhysicalBatchBenchmarkTest::RunTest(const FString& Parameters)
+{
+	static const int SIZES[] = { 1000, 10000, 50000, 100000 };
+
+	const int    FRAMES  = 30;
+	const double SECONDS = 1.0 / 30.0;    // two sub frames each
+
+	for (int s = 0; s < UE_ARRAY_COUNT(SIZES); s++) {
+		const int COUNT = SIZES[s];
+
+		RandomStream  rng(COUNT);
+		PhysicalBatch batch;
+		Body**        bodies = new Body*[COUNT];
+
+		for (int i = 0; i < COUNT; i++) {
+			bodies[i] = new Body;
+			RandomBody(rng, *bodies[i]);
+			PushBody(batch, batch.Add(), *bodies[i]);
+		}
+
+		double t0 = FPlatformTime::Seconds();
+
+		for (int n = 0; n < FRAMES; n++)
+			batch.Integrate(SECONDS, SUB_FRAME);
+
+		double t1 = FPlatformTime::Seconds();
+
+		for (int n = 0; n < FRAMES; n++)
+			for (int i = 0; i < COUNT; i++)
+				bodies[i]->ExecFrame(SECONDS);
+
+		double t2 = FPlatformTime::Seconds();
+
+		AddInfo(FString::Printf(
+			TEXT("PhysicalBatch %6d bodies: batch %.3f ms, per object %.3f ms per frame (%.1f ns, %.1f ns per body)"),
+			COUNT,
+			(t1 - t0) * 1e3 / FRAMES,
+			(t2 - t1) * 1e3 / FRAMES,
+			(t1 - t0) * 1e9 / FRAMES / COUNT,
+			(t2 - t1) * 1e9 / FRAMES / COUNT));
+
+		for (int i = 0; i < COUNT; i++)
+			delete bodies[i];
+
+		delete [] bodies;
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,93 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         RandomStreamTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Automation tests for the per thread random streams: the game
+	thread must draw the same sequence from a master seed whether or
+	not another thread drew from its own streams first.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "../Foundation/Random.h"
+#include <thread>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	const int DRAWS = 64;
+
+	void Draw(int stream, uint64* dst)
+	{
+		RandomStream& s = RandomStream::Get(stream);
+
+		for (int i = 0; i < DRAWS; i++)
+			dst[i] = s.Next();
+	}
+
+	void DrawOnThread(uint64* dst)
+	{
+		Draw(RandomStream::SIMULATION, dst);
+	}
+
+	bool Same(const uint64* a, const uint64* b)
+	{
+		for (int i = 0; i < DRAWS; i++)
+			if (a[i] != b[i])
+				return false;
+
+		return true;
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FRandomStreamThreadOrderTest,
+	"StarshatterWars.Foundation.RandomStream.ThreadOrder",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FRandomStreamThreadOrderTest::RunTest(const FString& Parameters)
+{
+	const uint64 SEED = 0x5eed;
+
+	uint64 previous = RandomStream::GetMasterSeed();
+
+	uint64 alone[RandomStream::NUM_STREAMS][DRAWS];
+	uint64 after[RandomStream::NUM_STREAMS][DRAWS];
+	uint64 other[DRAWS];
+
+	// the game thread on its own:
+	RandomStream::SeedAll(SEED);
+
+	for (int i = 0; i < RandomStream::NUM_STREAMS; i++)
+		Draw(i, alone[i]);
+
+	// a new thread touches its streams before the game thread does:
+	RandomStream::SeedAll(SEED);
+
+	std::thread worker(DrawOnThread, other);
+	worker.join();
+
+	for (int i = 0; i < RandomStream::NUM_STREAMS; i++)
+		Draw(i, after[i]);
+
+	TestTrue(TEXT("campaign stream repeats"),   Same(after[RandomStream::CAMPAIGN],   alone[RandomStream::CAMPAIGN]));
+	TestTrue(TEXT("mission stream repeats"),    Same(after[RandomStream::MISSION],    alone[RandomStream::MISSION]));
+	TestTrue(TEXT("simulation stream repeats"), Same(after[RandomStream::SIMULATION], alone[RandomStream::SIMULATION]));
+	TestTrue(TEXT("other thread draws the same sequence"), Same(other, alone[RandomStream::SIMULATION]));
+	TestFalse(TEXT("named streams differ"),     Same(alone[RandomStream::CAMPAIGN], alone[RandomStream::SIMULATION]));
+
+	RandomStream::SeedAll(previous);
+	return true;
+}
+
+#endif
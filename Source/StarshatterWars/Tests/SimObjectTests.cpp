@@ -0,0 +1,197 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         SimObjectTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Automation tests for SimObject observers: an observer deleted by
+	another observer's update, in the middle of Notify(), is skipped
+	by that notify and has left every other object it watched.  Also
+	a benchmark of Register, Unregister and Notify on 10,000 objects
+	with ten observers each.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "../Game/SimObject.h"
+#include "../Foundation/Random.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	class Counter : public SimObserver
+	{
+	public:
+		Counter(int* c = 0) : count(c) { }
+
+		virtual bool Update(USimObject* obj)
+		{
+			if (count)
+				(*count)++;
+
+			return SimObserver::Update(obj);
+		}
+
+		int*  count;
+	};
+
+	// deletes another observer when told of an update:
+	class Killer : public SimObserver
+	{
+	public:
+		Killer(SimObserver* v) : victim(v) { }
+
+		virtual bool Update(USimObject* obj)
+		{
+			delete victim;
+			victim = 0;
+
+			return SimObserver::Update(obj);
+		}
+
+		SimObserver*  victim;
+	};
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSimObjectDeleteDuringNotifyTest,
+	"StarshatterWars.Game.SimObject.DeleteDuringNotify",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSimObjectDeleteDuringNotifyTest::RunTest(const FString& Parameters)
+{
+	USimObject* first  = NewObject<USimObject>();
+	USimObject* second = NewObject<USimObject>();
+
+	int victim_updates  = 0;
+	int witness_updates = 0;
+
+	Counter* victim  = new Counter(&victim_updates);
+	Counter  witness(&witness_updates);
+	Killer   killer(victim);
+
+	// the killer is told first, before the victim's turn comes up:
+	killer.Observe(first);
+	victim->Observe(first);
+	victim->Observe(second);
+	witness.Observe(first);
+	witness.Observe(second);
+
+	first->Notify();
+
+	TestTrue(TEXT("victim deleted"),        killer.victim == 0);
+	TestEqual(TEXT("victim skipped"),       victim_updates, 0);
+	TestEqual(TEXT("witness told"),         witness_updates, 1);
+
+	// the victim must have left the other object's list as well:
+	second->Notify();
+
+	TestEqual(TEXT("victim not told again"), victim_updates, 0);
+	TestEqual(TEXT("witness told again"),    witness_updates, 2);
+
+	// both lists are clear, so the objects take observers again:
+	witness.Observe(first);
+	witness.Observe(first);
+	first->Notify();
+
+	TestEqual(TEXT("registered once"), witness_updates, 3);
+
+	// an observer that goes away outside of Notify leaves no link:
+	Counter* gone = new Counter(&victim_updates);
+	gone->Observe(second);
+	delete gone;
+
+	second->Notify();
+
+	TestEqual(TEXT("deleted observer not told"), victim_updates, 0);
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSimObjectObserverBenchmarkTest,
+	"StarshatterWars.Game.SimObject.ObserverBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSimObjectObserverBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const int OBJECTS   = 10000;
+	const int OBSERVERS = 10;
+	const int PASSES    = 10;
+
+	TArray<USimObject*> objects;
+
+	for (int i = 0; i < OBJECTS; i++)
+		objects.Add(NewObject<USimObject>());
+
+	int     updates = 0;
+	Counter observers[OBSERVERS];
+
+	for (int n = 0; n < OBSERVERS; n++)
+		observers[n].count = &updates;
+
+	RandomStream stream(0x5eed);
+
+	double register_time   = 0;
+	double unregister_time = 0;
+	double notify_time     = 0;
+
+	// pass zero grows the lists and is not timed:
+	for (int pass = 0; pass <= PASSES; pass++) {
+		updates = 0;
+
+		double t0 = FPlatformTime::Seconds();
+
+		// every observer watches every object:
+		for (int i = 0; i < OBJECTS; i++)
+			for (int n = 0; n < OBSERVERS; n++)
+				objects[i]->Register(&observers[n]);
+
+		double t1 = FPlatformTime::Seconds();
+
+		// half the links drop in no particular order:
+		for (int k = 0; k < OBJECTS * OBSERVERS / 2; k++) {
+			int i = (int)(stream.Next() % OBJECTS);
+			int n = (int)(stream.Next() % OBSERVERS);
+
+			objects[i]->Unregister(&observers[n]);
+		}
+
+		double t2 = FPlatformTime::Seconds();
+
+		for (int i = 0; i < OBJECTS; i++)
+			objects[i]->Notify();
+
+		double t3 = FPlatformTime::Seconds();
+
+		if (pass > 0) {
+			register_time   += t1 - t0;
+			unregister_time += t2 - t1;
+			notify_time     += t3 - t2;
+		}
+
+		TestTrue(TEXT("some links survive"), updates > 0 && updates < OBJECTS * OBSERVERS);
+	}
+
+	const double links = (double)OBJECTS * OBSERVERS * PASSES;
+
+	AddInfo(FString::Printf(
+		TEXT("SimObject %d objects x %d observers: Register %.1f ns, Unregister %.1f ns, ")
+		TEXT("Notify %.3f ms per pass"),
+		OBJECTS, OBSERVERS,
+		register_time * 1e9 / links,
+		unregister_time * 1e9 / (links / 2),
+		notify_time * 1e3 / PASSES));
+
+	return true;
+}
+
+#endif
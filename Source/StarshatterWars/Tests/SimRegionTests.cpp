@@ -0,0 +1,285 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         SimRegionTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Automation tests for running SimRegion frames in parallel: each
+	region draws the same sequence from its own stream whether the
+	regions run serially or across the pool, the fixed timestep
+	covers all of the frame time even past the step limit, and
+	benchmarks of region frames over pools of different sizes and of
+	the game tick at 1x, 4x, 16x and 32x time compression.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "../Game/Sim.h"
+#include "../Foundation/Random.h"
+#include "../System/Game.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	// a background region whose frame does an uneven amount of work
+	// and folds every draw into a trace:
+	class TraceRegion : public SimRegion
+	{
+	public:
+		TraceRegion(USim* s, const char* n, int w)
+			: SimRegion(s, n, REAL_SPACE), trace(0), frames(0), work(w), elapsed(0) { }
+
+		virtual void ExecFrame(double seconds)
+		{
+			SimRegion::ExecFrame(seconds);
+			elapsed += seconds;
+
+			RandomStream& rng = RandomStream::Current();
+			int           n   = work + (int)(rng.Next() % 64);
+
+			for (int i = 0; i < n; i++)
+				trace = trace * 31 + rng.Next();
+
+			frames++;
+		}
+
+		uint64  trace;
+		int     frames;
+		int     work;
+		double  elapsed;
+	};
+
+	USim* CreateRegions(int count, int work)
+	{
+		USim* prev = USim::sim;
+		USim* sim  = NewObject<USim>();
+
+		// a test sim must not become the game's sim:
+		USim::sim = prev;
+
+		for (int i = 0; i < count; i++) {
+			char name[32];
+			sprintf_s(name, "Region %d", i);
+			sim->GetRegions().append(new TraceRegion(sim, name, work * (1 + i % 4)));
+		}
+
+		return sim;
+	}
+
+	void RunRegions(USim* sim, int threads, int frames, uint64* traces)
+	{
+		sim->SetRegionThreads(threads);
+
+		// start every region over from the same master seed:
+		ListIter<SimRegion> iter = sim->GetRegions();
+		while (++iter) {
+			TraceRegion* rgn = (TraceRegion*)iter.value();
+			rgn->SeedRandom();
+			rgn->trace   = 0;
+			rgn->frames  = 0;
+			rgn->elapsed = 0;
+		}
+
+		for (int i = 0; i < frames; i++)
+			sim->ExecRegions(1.0 / 60.0);
+
+		for (int i = 0; i < sim->GetRegions().size(); i++)
+			traces[i] = ((TraceRegion*)sim->GetRegions()[i])->trace;
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSimRegionDeterminismTest,
+	"StarshatterWars.Game.SimRegion.Determinism",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSimRegionDeterminismTest::RunTest(const FString& Parameters)
+{
+	const int REGIONS = 12;
+	const int FRAMES  = 60;
+
+	USim* sim = CreateRegions(REGIONS, 16);
+
+	uint64 serial[REGIONS];
+	uint64 parallel[REGIONS];
+	uint64 again[REGIONS];
+
+	RandomStream::SeedAll(0x5eed);
+
+	RunRegions(sim, 1, FRAMES, serial);
+	RunRegions(sim, 4, FRAMES, parallel);
+	RunRegions(sim, 0, FRAMES, again);
+
+	bool same     = true;
+	bool distinct = true;
+
+	for (int i = 0; i < REGIONS; i++) {
+		if (parallel[i] != serial[i] || again[i] != serial[i])
+			same = false;
+
+		for (int j = 0; j < i; j++)
+			if (serial[i] == serial[j])
+				distinct = false;
+
+		TestEqual(TEXT("frames run"), ((TraceRegion*)sim->GetRegions()[i])->frames, FRAMES);
+	}
+
+	TestTrue(TEXT("parallel regions match serial"), same);
+	TestTrue(TEXT("each region has a stream of its own"), distinct);
+
+	sim->GetRegions().destroy();
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSimRegionStepTest,
+	"StarshatterWars.Game.SimRegion.FixedStep",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FSimRegionStepTest::RunTest(const FString& Parameters)
+{
+	const double STEP = UPhysical::GetSubFrameLength();
+
+	USim* sim = CreateRegions(3, 16);
+	sim->SetRegionThreads(1);
+
+	// six sub frames of time against a limit of four steps: the
+	// regions run four longer steps that still cover all six:
+	sim->SetMaxSteps(4);
+
+	TestEqual(TEXT("steps taken"), sim->StepRegions(6.25 * STEP), 4);
+
+	for (int i = 0; i < sim->GetRegions().size(); i++) {
+		TraceRegion* rgn = (TraceRegion*)sim->GetRegions()[i];
+
+		TestEqual(TEXT("frames run"), rgn->frames, 4);
+		TestTrue(TEXT("frame time covered"), FMath::Abs(rgn->elapsed - 6 * STEP) < 1e-9);
+	}
+
+	// the rest is banked, and is the blend factor until a whole
+	// step has built up:
+	sim->SetMaxSteps(64);
+
+	TestTrue(TEXT("quarter step left over"), FMath::Abs(sim->GetStepAlpha() - 0.25) < 1e-6);
+	TestEqual(TEXT("no step yet"), sim->StepRegions(0.5 * STEP), 0);
+	TestTrue(TEXT("three quarters left over"), FMath::Abs(sim->GetStepAlpha() - 0.75) < 1e-6);
+	TestEqual(TEXT("one step"), sim->StepRegions(0.5 * STEP), 1);
+	TestTrue(TEXT("quarter step left over again"), FMath::Abs(sim->GetStepAlpha() - 0.25) < 1e-6);
+
+	TestEqual(TEXT("frames run"), ((TraceRegion*)sim->GetRegions()[0])->frames, 5);
+
+	sim->GetRegions().destroy();
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSimRegionBenchmarkTest,
+	"StarshatterWars.Game.SimRegion.Benchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSimRegionBenchmarkTest::RunTest(const FString& Parameters)
+{
+	static const int COUNTS[]  = { 2, 8, 32 };
+	static const int THREADS[] = { 1, 2, 4, 0 };
+
+	const int FRAMES = 120;
+
+	uint64 traces[32];
+
+	RandomStream::SeedAll(0x5eed);
+
+	for (int c = 0; c < UE_ARRAY_COUNT(COUNTS); c++) {
+		USim* sim = CreateRegions(COUNTS[c], 20000);
+
+		for (int t = 0; t < UE_ARRAY_COUNT(THREADS); t++) {
+			double t0 = FPlatformTime::Seconds();
+			RunRegions(sim, THREADS[t], FRAMES, traces);
+			double t1 = FPlatformTime::Seconds();
+
+			AddInfo(FString::Printf(
+				TEXT("SimRegion %2d regions, %d threads: %.3f ms per frame"),
+				COUNTS[c], sim->GetRegionThreads(), (t1 - t0) * 1e3 / FRAMES));
+		}
+
+		sim->GetRegions().destroy();
+	}
+
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSimRegionTimeCompressionBenchmarkTest,
+	"StarshatterWars.Game.SimRegion.TimeCompressionBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FSimRegionTimeCompressionBenchmarkTest::RunTest(const FString& Parameters)
+{
+	static const int COMPRESSION[] = { 1, 4, 16, 32 };
+
+	const int    REGIONS = 8;
+	const int    FRAMES  = 120;
+	const double FRAME   = 1.0 / 60.0;
+	const double STEP    = UPhysical::GetSubFrameLength();
+
+	DWORD previous = Game::TimeCompression();
+
+	RandomStream::SeedAll(0x5eed);
+
+	USim* sim = CreateRegions(REGIONS, 2000);
+	sim->SetRegionThreads(0);
+
+	for (int c = 0; c < UE_ARRAY_COUNT(COMPRESSION); c++) {
+		Game::SetTimeCompression(COMPRESSION[c]);
+
+		ListIter<SimRegion> iter = sim->GetRegions();
+		while (++iter) {
+			TraceRegion* rgn = (TraceRegion*)iter.value();
+			rgn->frames  = 0;
+			rgn->elapsed = 0;
+		}
+
+		// one untimed tick, so the workers are running:
+		sim->Tick((float)FRAME);
+
+		TraceRegion* first  = (TraceRegion*)sim->GetRegions()[0];
+		int          before = first->frames;
+
+		double t0 = FPlatformTime::Seconds();
+
+		for (int i = 0; i < FRAMES; i++)
+			sim->Tick((float)FRAME);
+
+		double t1 = FPlatformTime::Seconds();
+
+		double steps = (first->frames - before) / (double)FRAMES;
+
+		// every rendered frame hands the regions its compressed time:
+		TestTrue(FString::Printf(TEXT("%dx: steps cover the frame time"), COMPRESSION[c]),
+			FMath::Abs(steps * STEP - FRAME * COMPRESSION[c]) <= STEP);
+
+		AddInfo(FString::Printf(
+			TEXT("SimRegion %d regions at %2dx: %.3f ms per frame, %.1f steps per frame (%.4f ms per step)"),
+			REGIONS, COMPRESSION[c],
+			(t1 - t0) * 1e3 / FRAMES,
+			steps,
+			steps > 0 ? (t1 - t0) * 1e3 / (FRAMES * steps) : 0));
+	}
+
+	Game::SetTimeCompression(previous);
+
+	sim->GetRegions().destroy();
+	return true;
+}
+
+#endif
@@ -0,0 +1,103 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         TaskPoolTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Automation tests for the persistent worker TaskPool: every index
+	runs exactly once across many batches on the same pool, a batch
+	started from inside a task runs inline, and resizing the pool
+	restarts its workers.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "../Foundation/TaskPool.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	struct CountBatch
+	{
+		std::atomic<int>*   hits;
+		TaskPool*           pool;
+	};
+
+	void CountTask(void* param, int index)
+	{
+		CountBatch* b = (CountBatch*)param;
+		b->hits[index]++;
+	}
+
+	void NestedTask(void* param, int index)
+	{
+		CountBatch* b = (CountBatch*)param;
+		b->pool->Run(8, CountTask, b);
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTaskPoolRunTest,
+	"StarshatterWars.Foundation.TaskPool.Run",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTaskPoolRunTest::RunTest(const FString& Parameters)
+{
+	const int COUNT   = 1000;
+	const int BATCHES = 200;
+
+	std::atomic<int> hits[COUNT];
+	for (int i = 0; i < COUNT; i++)
+		hits[i] = 0;
+
+	TaskPool   pool(4);
+	CountBatch batch = { hits, &pool };
+
+	for (int n = 0; n < BATCHES; n++)
+		pool.Run(COUNT, CountTask, &batch);
+
+	bool exact = true;
+	for (int i = 0; i < COUNT; i++) {
+		if (hits[i] != BATCHES)
+			exact = false;
+		hits[i] = 0;
+	}
+
+	TestTrue(TEXT("every index runs once per batch"), exact);
+
+	// a batch started by a task runs inline instead of deadlocking:
+	pool.Run(16, NestedTask, &batch);
+
+	int nested = 0;
+	for (int i = 0; i < 8; i++)
+		nested += hits[i];
+
+	TestEqual(TEXT("nested batches"), nested, 16 * 8);
+
+	// resizing stops the old workers and starts new ones on demand:
+	pool.SetThreads(2);
+
+	for (int i = 0; i < COUNT; i++)
+		hits[i] = 0;
+
+	pool.Run(COUNT, CountTask, &batch);
+
+	exact = true;
+	for (int i = 0; i < COUNT; i++)
+		if (hits[i] != 1)
+			exact = false;
+
+	TestTrue(TEXT("batch after resize"), exact);
+	return true;
+}
+
+#endif
@@ -0,0 +1,126 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         TermCacheTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Automation tests for the parsed content cache: a clean parse
+	round trips through the cache, an edit that keeps the file size
+	invalidates it, a damaged or truncated cache file is rejected, and
+	a file with a syntax error is never stored.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "../Foundation/ParsedFile.h"
+#include "../Foundation/TermCache.h"
+#include <stdio.h>
+#include <string.h>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	const char* SOURCE  = "TermCacheTest/ships.def";
+
+	const char* CLEAN   = "SHIP\nname: \"Falcon\"\nmass: 100\nloc: (1, 2, 3)\n";
+	const char* EDITED  = "SHIP\nname: \"Falcon\"\nmass: 900\nloc: (1, 2, 3)\n";
+	const char* BROKEN  = "SHIP\nname: \"Falcon\"\nloc: (1, 2, 3\nmass: 100\n";
+
+	bool Damage(const Text& name, bool truncate)
+	{
+		FILE* f = 0;
+		if (::fopen_s(&f, name, "r+b") != 0 || !f)
+			return false;
+
+		::fseek(f, 0, SEEK_END);
+		long size = ::ftell(f);
+		::fseek(f, size - 1, SEEK_SET);
+
+		int c = ::fgetc(f);
+		::fseek(f, size - 1, SEEK_SET);
+		::fputc(c ^ 0x5a, f);
+		::fclose(f);
+
+		if (truncate) {
+			TArray<uint8> bytes;
+			FFileHelper::LoadFileToArray(bytes, ANSI_TO_TCHAR((const char*) name));
+			bytes.SetNum(bytes.Num() / 2);
+			FFileHelper::SaveArrayToFile(bytes, ANSI_TO_TCHAR((const char*) name));
+		}
+
+		return true;
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTermCacheInvalidationTest,
+	"StarshatterWars.Foundation.TermCache.Invalidation",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTermCacheInvalidationTest::RunTest(const FString& Parameters)
+{
+	FString Dir = FPaths::AutomationTransientDir() / TEXT("TermCache/");
+	IFileManager::Get().MakeDirectory(*Dir, true);
+
+	TermCache cache(TCHAR_TO_ANSI(*Dir));
+	int len = (int) ::strlen(CLEAN);
+
+	ParsedFile parsed(SOURCE);
+	parsed.Parse(CLEAN, len);
+
+	TestTrue(TEXT("clean parse"), parsed.IsClean());
+	TestTrue(TEXT("clean parse is stored"), cache.Store(SOURCE, CLEAN, len, parsed));
+
+	ParsedFile cached(SOURCE);
+	TestTrue(TEXT("unchanged text hits"), cache.Load(SOURCE, CLEAN, len, cached));
+	TestEqual(TEXT("cached terms"), cached.NumTerms(), parsed.NumTerms());
+
+	// same length, same second, different text:
+	TestEqual(TEXT("edit keeps the size"), (int) ::strlen(EDITED), len);
+
+	ParsedFile stale(SOURCE);
+	TestFalse(TEXT("edited text misses"), cache.Load(SOURCE, EDITED, len, stale));
+
+	// damaged cache files fail their checksum or length checks:
+	Text name = cache.CacheName(SOURCE);
+
+	TestTrue(TEXT("damage cache"), Damage(name, false));
+	ParsedFile damaged(SOURCE);
+	TestFalse(TEXT("damaged cache misses"), cache.Load(SOURCE, CLEAN, len, damaged));
+	TestEqual(TEXT("damaged cache leaves no terms"), damaged.NumTerms(), 0);
+
+	cache.Store(SOURCE, CLEAN, len, parsed);
+	TestTrue(TEXT("truncate cache"), Damage(name, true));
+	ParsedFile truncated(SOURCE);
+	TestFalse(TEXT("truncated cache misses"), cache.Load(SOURCE, CLEAN, len, truncated));
+
+	// a partial parse after a syntax error is never cached:
+	cache.Remove(SOURCE);
+
+	int broken_len = (int) ::strlen(BROKEN);
+	ParsedFile broken(SOURCE);
+	broken.Parse(BROKEN, broken_len);
+
+	TestTrue(TEXT("broken parse loads"), broken.IsLoaded());
+	TestFalse(TEXT("broken parse is not clean"), broken.IsClean());
+	TestFalse(TEXT("broken parse is not stored"), cache.Store(SOURCE, BROKEN, broken_len, broken));
+
+	ParsedFile retry(SOURCE);
+	TestFalse(TEXT("broken text misses"), cache.Load(SOURCE, BROKEN, broken_len, retry));
+
+	cache.Remove(SOURCE);
+	return true;
+}
+
+#endif
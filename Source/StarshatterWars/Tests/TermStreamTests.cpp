@@ -0,0 +1,174 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         TermStreamTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Benchmark of the two ways an order of battle file can be read: the
+	whole file parsed into a term tree, as the preload held it, and
+	streamed straight into the roster by CombatGroup::LoadOrderOfBattle.
+	Time and the memory each path holds are reported for the two large
+	rosters, Alliance.def and Hegemony.def.  Skipped when the project
+	has no GameData.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "../Foundation/MappedFile.h"
+#include "../Foundation/ParsedFile.h"
+#include "../Foundation/Term.h"
+#include "../Foundation/Text.h"
+#include "../Game/CombatGroup.h"
+#include "../Game/CombatUnit.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	const TCHAR* ROSTERS[] = {
+		TEXT("Alliance.def"),
+		TEXT("Hegemony.def"),
+	};
+
+	int CountGroups(CombatGroup* g)
+	{
+		int count = 1;
+
+		ListIter<CombatGroup> iter = g->GetComponents();
+		while (++iter)
+			count += CountGroups(iter.value());
+
+		return count;
+	}
+
+	int CountUnits(CombatGroup* g)
+	{
+		int count = g->GetUnits().size();
+
+		ListIter<CombatGroup> iter = g->GetComponents();
+		while (++iter)
+			count += CountUnits(iter.value());
+
+		return count;
+	}
+
+	// the tree path: every term of the file held at once, then walked
+	// for its groups and units:
+	int WalkTree(ParsedFile& content, int& units)
+	{
+		int groups = 0;
+
+		for (int i = 0; i < content.NumTerms(); i++) {
+			TermDef* def = content.GetTerm(i)->isDef();
+			if (!def || def->name()->value() != "group" || !def->term() || !def->term()->isStruct())
+				continue;
+
+			TermStruct* val = def->term()->isStruct();
+			groups++;
+
+			for (int n = 0; n < val->elements()->size(); n++) {
+				TermDef* pdef = val->elements()->at(n)->isDef();
+				if (pdef && pdef->name()->value() == "unit")
+					units++;
+			}
+		}
+
+		return groups;
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTermStreamRosterBenchmarkTest,
+	"StarshatterWars.Foundation.TermStream.RosterBenchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FTermStreamRosterBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const int PASSES = 20;
+
+	FString Dir = FPaths::ProjectDir() / TEXT("GameData/Campaigns/");
+
+	for (int r = 0; r < UE_ARRAY_COUNT(ROSTERS); r++) {
+		FString name = Dir / ROSTERS[r];
+
+		MappedFile file;
+		if (!file.Open(TCHAR_TO_ANSI(*name))) {
+			AddInfo(FString::Printf(TEXT("no %s, skipped"), ROSTERS[r]));
+			continue;
+		}
+
+		// what each path holds at its peak: the tree has every term
+		// of the file in its arena, the stream only the record it is
+		// filling:
+		long   tree_texts   = 0;
+		long   stream_texts = 0;
+		size_t tree_bytes   = 0;
+		int    tree_groups  = 0;
+		int    tree_units   = 0;
+		int    groups       = 0;
+		int    units        = 0;
+
+		double tree_time   = 0;
+		double stream_time = 0;
+
+		// pass zero warms the file cache and is not timed:
+		for (int n = 0; n <= PASSES; n++) {
+			long   b0 = TextRep::NumHeapBlocks();
+			double t0 = FPlatformTime::Seconds();
+
+			{
+				ParsedFile content(TCHAR_TO_ANSI(*name));
+				content.Parse(file.GetData(), file.GetSize());
+
+				tree_units  = 0;
+				tree_groups = WalkTree(content, tree_units);
+				tree_bytes  = content.GetArena()->BytesUsed();
+			}
+
+			long   b1 = TextRep::NumHeapBlocks();
+			double t1 = FPlatformTime::Seconds();
+
+			CombatGroup* force = CombatGroup::LoadOrderOfBattle(TCHAR_TO_ANSI(*name), -1, 0);
+
+			double t2 = FPlatformTime::Seconds();
+			long   b2 = TextRep::NumHeapBlocks();
+
+			if (force) {
+				groups = CountGroups(force);
+				units  = CountUnits(force);
+				delete force;
+			}
+
+			if (n > 0) {
+				tree_time    += t1 - t0;
+				stream_time  += t2 - t1;
+				tree_texts   += b1 - b0;
+				stream_texts += b2 - b1;
+			}
+		}
+
+		// groups whose parent is not in the file are dropped by the
+		// loader, so the roster can only be smaller than the tree:
+		TestTrue(FString::Printf(TEXT("%s: roster loaded"), ROSTERS[r]), groups > 0 && units > 0);
+		TestTrue(FString::Printf(TEXT("%s: roster within the file"), ROSTERS[r]), groups <= tree_groups && units <= tree_units);
+
+		AddInfo(FString::Printf(
+			TEXT("%s, %.1f KB: tree %.3f ms, %.1f KB of terms held, %ld text blocks (%d groups, %d units); ")
+			TEXT("stream into roster %.3f ms, %ld text blocks (%d groups, %d units)"),
+			ROSTERS[r], file.GetSize() / 1024.0,
+			tree_time * 1e3 / PASSES, tree_bytes / 1024.0, tree_texts / PASSES, tree_groups, tree_units,
+			stream_time * 1e3 / PASSES, stream_texts / PASSES, groups, units));
+	}
+
+	return true;
+}
+
+#endif
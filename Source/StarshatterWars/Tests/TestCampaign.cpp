@@ -0,0 +1,312 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         TestCampaign.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Synthetic campaigns for the planner tests and benchmarks
+*/
+
+#include "TestCampaign.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Misc/Paths.h"
+
+#include "../Game/Campaign.h"
+#include "../Game/Combatant.h"
+#include "../Game/CombatAction.h"
+#include "../Game/CombatEvent.h"
+#include "../Game/CombatGroup.h"
+#include "../Game/CombatUnit.h"
+#include "../Game/CombatZone.h"
+#include "../Game/Intel.h"
+#include "../Game/MissionInfo.h"
+#include "../Game/Ship.h"
+#include "../Game/ZoneForce.h"
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	struct GroupKind
+	{
+		int         type;
+		int         ship_class;
+		const char* design;
+		bool        in_wing;
+	};
+
+	// the groups each force keeps in every zone:
+	const GroupKind KINDS[] = {
+		{ CombatGroup::BATTLE_GROUP,       UShip::CRUISER,   "Cruiser",     false },
+		{ CombatGroup::DESTROYER_SQUADRON, UShip::DESTROYER, "Destroyer",   false },
+		{ CombatGroup::CARRIER_GROUP,      UShip::CARRIER,   "Carrier",     false },
+		{ CombatGroup::FIGHTER_SQUADRON,   UShip::FIGHTER,   "Fighter",     true  },
+		{ CombatGroup::ATTACK_SQUADRON,    UShip::ATTACK,    "Attack",      true  },
+		{ CombatGroup::INTERCEPT_SQUADRON, UShip::FIGHTER,   "Interceptor", true  },
+	};
+
+	void AddUnits(CombatGroup* g, int ship_class, const char* design, int count)
+	{
+		for (int i = 0; i < count; i++) {
+			char name[64];
+			sprintf_s(name, 64, "%s %d-%d-%d", design, g->GetIFF(), g->Type(), g->GetID() * 100 + i);
+
+			CombatUnit* u = new CombatUnit(name, "", ship_class, design, 1, g->GetIFF());
+			u->SetRegion(g->GetRegion());
+			u->SetLeader(i == 0);
+
+			g->GetUnits().append(u);
+			u->SetCombatGroup(g);
+		}
+	}
+
+	CombatGroup* CreateForce(int iff, List<CombatZone>& zones, int units)
+	{
+		char name[64];
+		sprintf_s(name, 64, "Force %d", iff);
+
+		CombatGroup* force = new CombatGroup(CombatGroup::FORCE, iff, name, iff, Intel::KNOWN);
+		CombatGroup* fleet = new CombatGroup(CombatGroup::FLEET, 1, "Fleet", iff, Intel::KNOWN, force);
+		CombatGroup* wing  = new CombatGroup(CombatGroup::WING,  1, "Wing",  iff, Intel::KNOWN, force);
+
+		for (int z = 0; z < zones.size(); z++) {
+			CombatZone* zone   = zones[z];
+			Text        region = *zone->GetRegions().first();
+
+			for (int k = 0; k < UE_ARRAY_COUNT(KINDS); k++) {
+				const GroupKind& kind = KINDS[k];
+
+				sprintf_s(name, 64, "%s %d", kind.design, z + 1);
+
+				CombatGroup* g = new CombatGroup(kind.type, z + 1, name, iff, Intel::KNOWN,
+					kind.in_wing ? wing : fleet);
+
+				g->SetRegion(region);
+				AddUnits(g, kind.ship_class, kind.design, units);
+			}
+
+			sprintf_s(name, 64, "Starbase %d", z + 1);
+
+			CombatGroup* base = new CombatGroup(CombatGroup::STARBASE, z + 1, name, iff, Intel::KNOWN, force);
+			base->SetRegion(region);
+			AddUnits(base, UShip::STARBASE, "Starbase", 1);
+		}
+
+		return force;
+	}
+
+	// every group of the force that sits in the zone's regions:
+	void GroupsInZone(CombatGroup* g, CombatZone* zone, List<CombatGroup>& list)
+	{
+		if (g->GetUnits().size() && zone->HasRegion(g->GetRegion()))
+			list.append(g);
+
+		ListIter<CombatGroup> iter = g->GetComponents();
+		while (++iter)
+			GroupsInZone(iter.value(), zone, list);
+	}
+
+	// each group is assigned to the zone it sits in, and each zone
+	// force attacks the enemy groups there and defends its bases:
+	void Deploy(UCampaign* campaign)
+	{
+		ListIter<CombatZone> zone = campaign->GetZones();
+		while (++zone) {
+			ListIter<Combatant> iter = campaign->GetCombatants();
+			while (++iter) {
+				List<CombatGroup> local;
+				GroupsInZone(iter->GetForce(), zone.value(), local);
+
+				ListIter<CombatGroup> g = local;
+				while (++g) {
+					g->SetAssignedZone(zone.value());
+					zone->AddGroup(g.value());
+
+					if (g->Type() == CombatGroup::STARBASE || g->Type() == CombatGroup::STATION)
+						zone->FindForce(iter->GetIFF())->GetDefendList().append(g.value());
+				}
+
+				ListIter<Combatant> enemy = campaign->GetCombatants();
+				while (++enemy) {
+					if (enemy->GetIFF() != iter->GetIFF())
+						zone->FindForce(enemy->GetIFF())->GetTargetList().append(local);
+				}
+			}
+		}
+	}
+
+	// deals each region of the tree out to the next zone in turn:
+	void DealRegions(CombatGroup* g, List<CombatZone>& zones, int& next)
+	{
+		const char* region = g->GetRegion();
+
+		if (region && *region) {
+			bool dealt = false;
+
+			for (int i = 0; i < zones.size() && !dealt; i++)
+				dealt = zones[i]->HasRegion(region);
+
+			if (!dealt)
+				zones[next++ % zones.size()]->AddRegion(region);
+		}
+
+		ListIter<CombatGroup> iter = g->GetComponents();
+		while (++iter)
+			DealRegions(iter.value(), zones, next);
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+UCampaign*
+TestCampaign::Create(int combatants, int zones, int units_per_group)
+{
+	UCampaign* campaign = NewObject<UCampaign>();
+
+	for (int z = 0; z < zones; z++) {
+		char region[32];
+		sprintf_s(region, 32, "Sector %d", z + 1);
+
+		CombatZone* zone = new CombatZone();
+		zone->AddRegion(region);
+		campaign->GetZones().append(zone);
+	}
+
+	for (int c = 0; c < combatants; c++) {
+		char name[32];
+		sprintf_s(name, 32, "Combatant %d", c + 1);
+
+		CombatGroup* force = CreateForce(c + 1, campaign->GetZones(), units_per_group);
+		campaign->GetCombatants().append(new Combatant(name, force));
+	}
+
+	Deploy(campaign);
+
+	if (combatants > 0)
+		campaign->SetPlayerGroup(PlayerGroup(campaign));
+
+	return campaign;
+}
+
+UCampaign*
+TestCampaign::CreateFromRosters(int zones)
+{
+	static const char* ROSTERS[] = { "Alliance", "Hegemony" };
+
+	FString Dir = FPaths::ProjectDir() / TEXT("GameData/Campaigns/");
+
+	UCampaign* campaign = NewObject<UCampaign>();
+
+	for (int r = 0; r < UE_ARRAY_COUNT(ROSTERS); r++) {
+		FString name = Dir / ANSI_TO_TCHAR(ROSTERS[r]) + TEXT(".def");
+
+		Combatant* c = new Combatant(ROSTERS[r], TCHAR_TO_ANSI(*name), r + 1);
+		campaign->GetCombatants().append(c);
+
+		if (!c->GetForce()) {
+			Destroy(campaign);
+			return 0;
+		}
+	}
+
+	if (zones < 1)
+		zones = 1;
+
+	for (int z = 0; z < zones; z++)
+		campaign->GetZones().append(new CombatZone());
+
+	int next = 0;
+
+	ListIter<Combatant> iter = campaign->GetCombatants();
+	while (++iter)
+		DealRegions(iter->GetForce(), campaign->GetZones(), next);
+
+	Deploy(campaign);
+
+	Combatant* player = campaign->GetCombatants().first();
+	campaign->SetPlayerGroup(player->FindGroup(CombatGroup::FLEET));
+
+	return campaign;
+}
+
+// +--------------------------------------------------------------------+
+
+void
+TestCampaign::AddActions(UCampaign* campaign, int count, int chains, int spacing)
+{
+	static const int TYPES[] = {
+		CombatAction::NO_ACTION,
+		CombatAction::CAMPAIGN_SITUATION,
+		CombatAction::ZONE_ASSIGNMENT,
+		CombatAction::CAMPAIGN_ORDERS,
+		CombatAction::STRATEGIC_DIRECTIVE,
+	};
+
+	List<Combatant>&  combatants = campaign->GetCombatants();
+	List<CombatZone>& zones      = campaign->GetZones();
+
+	if (chains < 1)
+		chains = 1;
+
+	for (int id = 1; id <= count; id++) {
+		int type = TYPES[id % UE_ARRAY_COUNT(TYPES)];
+
+		// moves and directives are given to the enemy's groups, so
+		// the player's team is not told about them:
+		int iff = combatants.size() > 1 ? 2 : 1;
+
+		CombatAction* action = new CombatAction(id, type, 0, iff);
+		action->SetCount(1);
+		action->SetStartAfter((id - 1) / chains * spacing);
+		action->SetText("do-not-display");
+
+		if (type == CombatAction::ZONE_ASSIGNMENT || type == CombatAction::STRATEGIC_DIRECTIVE) {
+			action->SetAssetType(CombatGroup::BATTLE_GROUP);
+			action->SetAssetId(1 + id % zones.size());
+			action->SetRegion(*zones[(id / 2) % zones.size()]->GetRegions().first());
+		}
+
+		if (id > chains)
+			action->AddRequirement(id - chains, CombatAction::COMPLETE);
+
+		campaign->GetActions().append(action);
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+void
+TestCampaign::Destroy(UCampaign* campaign)
+{
+	if (!campaign)
+		return;
+
+	if (UCampaign::GetCampaign() == campaign)
+		UCampaign::SetCurrentCampaign(0);
+
+	campaign->SetStatus(UCampaign::CAMPAIGN_INIT);
+	campaign->SetPlayerGroup(0);
+	campaign->Clear();
+
+	// the zones let go of the groups before the forces are deleted:
+	campaign->GetZones().destroy();
+	campaign->GetActions().destroy();
+	campaign->GetEvents().destroy();
+	campaign->GetMissionList().destroy();
+	campaign->GetCombatants().destroy();
+}
+
+CombatGroup*
+TestCampaign::PlayerGroup(UCampaign* campaign)
+{
+	Combatant* c = campaign->GetCombatants().first();
+	return c ? c->FindGroup(CombatGroup::FLEET, 1) : 0;
+}
+
+#endif
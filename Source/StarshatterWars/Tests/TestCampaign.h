@@ -0,0 +1,58 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         TestCampaign.h
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Synthetic campaigns for the planner tests and benchmarks, so they
+	do not depend on a campaign being loaded.  Every combatant gets a
+	fleet and a wing with a few groups in each zone, all assigned to
+	their zone, and each zone force is given the enemy groups there as
+	targets and its own starbase to defend.  Scripted actions can be
+	added as a number of independent chains.  The shipped Alliance and
+	Hegemony orders of battle can stand in for the synthetic forces,
+	for benchmarks at full roster size.
+*/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+class UCampaign;
+class CombatGroup;
+
+// +--------------------------------------------------------------------+
+
+namespace TestCampaign
+{
+	// combatants are numbered from iff 1.  the player flies with the
+	// first combatant's fleet, so the event and mission planners run:
+	UCampaign*   Create(int combatants, int zones, int units_per_group = 4);
+
+	// the Alliance (iff 1) and Hegemony (iff 2) rosters from GameData,
+	// their regions dealt out over the given number of zones so the
+	// two forces meet in each one.  null when there is no GameData:
+	UCampaign*   CreateFromRosters(int zones);
+
+	// count actions with ids from 1 up, in the given number of chains.
+	// each action requires the one before it in its chain to complete,
+	// and starts no sooner than spacing seconds after it:
+	void         AddActions(UCampaign* campaign, int count, int chains, int spacing = 3600);
+
+	// deletes the zones, actions, events and combatants, and stops
+	// the campaign being current:
+	void         Destroy(UCampaign* campaign);
+
+	// the fleet the player flies with:
+	CombatGroup* PlayerGroup(UCampaign* campaign);
+}
+
+#endif
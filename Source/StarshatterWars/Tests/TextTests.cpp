@@ -0,0 +1,241 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         TextTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Automation tests for Text: heap blocks taken by short and long
+	strings, copies and copy on write, counted through the rep's
+	allocation counter; copies and destruction of shared reps from
+	many threads at once; and a benchmark of threaded copy/destroy
+	throughput over pools of different sizes.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "../Foundation/Text.h"
+#include "../Foundation/TaskPool.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	const int SHARED = 64;
+	const int LOCALS = 16;
+
+	struct CopyBatch
+	{
+		const Text* shared;
+		int         rounds;
+		unsigned    sums[64];
+	};
+
+	// every task copies, reassigns and drops the same shared reps, so
+	// the reference counts are hit from all threads at once:
+	void CopyTask(void* param, int index)
+	{
+		CopyBatch* b   = (CopyBatch*)param;
+		unsigned   sum = 0;
+		Text       local[LOCALS];
+
+		for (int r = 0; r < b->rounds; r++) {
+			for (int i = 0; i < LOCALS; i++) {
+				local[i] = b->shared[(r * 7 + i * 13 + index) % SHARED];
+
+				Text copy(local[(i + 1) % LOCALS]);
+				sum = sum * 31 + copy.hash() + copy.length();
+			}
+		}
+
+		b->sums[index] = sum;
+	}
+
+	void MakeShared(Text* shared)
+	{
+		// names, keys and a few long descriptions, on both sides of
+		// the inline limit:
+		for (int i = 0; i < SHARED; i++) {
+			char buf[128];
+			int  len = (i % 4 == 3) ? 60 + i : 4 + i % 24;
+
+			for (int n = 0; n < len; n++)
+				buf[n] = (char)('a' + (i + n) % 26);
+
+			buf[len] = 0;
+			shared[i] = buf;
+		}
+	}
+
+	int Blocks() { return (int)TextRep::NumHeapBlocks(); }
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTextAllocationTest,
+	"StarshatterWars.Foundation.Text.Allocations",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTextAllocationTest::RunTest(const FString& Parameters)
+{
+	static const int LENGTHS[] = { 0, 1, 8, 23, 24, 64, 200 };
+
+	const int COUNT = 1000;
+
+	Text* texts  = new Text[COUNT];
+	char  buf[256];
+
+	for (int l = 0; l < UE_ARRAY_COUNT(LENGTHS); l++) {
+		const int LEN = LENGTHS[l];
+
+		memset(buf, 'x', LEN);
+		buf[LEN] = 0;
+
+		int b0 = Blocks();
+
+		for (int i = 0; i < COUNT; i++)
+			texts[i] = buf;
+
+		int made = Blocks() - b0;
+
+		// the rep alone while the text fits inside it, the rep and
+		// a buffer past that.  without inline storage every text
+		// took two:
+		int expect = LEN < 24 ? COUNT : 2 * COUNT;
+
+		TestEqual(FString::Printf(TEXT("blocks for length %d"), LEN), made, expect);
+
+		AddInfo(FString::Printf(TEXT("Text length %3d: %.1f heap blocks per string (2.0 without inline storage)"),
+			LEN, (double)made / COUNT));
+	}
+
+	// copies share the rep, and writing to a copy clones it once:
+	Text* copies = new Text[COUNT];
+
+	int b0 = Blocks();
+
+	for (int i = 0; i < COUNT; i++)
+		copies[i] = texts[i];
+
+	TestEqual(TEXT("blocks for copies"), Blocks() - b0, 0);
+
+	bool shared = true;
+	for (int i = 0; i < COUNT; i++)
+		if (copies[i].data() != texts[i].data())
+			shared = false;
+
+	TestTrue(TEXT("copies share the rep"), shared);
+
+	b0 = Blocks();
+	copies[0][0] = 'y';
+
+	TestEqual(TEXT("blocks for copy on write"), Blocks() - b0, 2);
+	TestTrue(TEXT("original unchanged"), texts[0][0] == 'x' && copies[0][0] == 'y');
+
+	delete [] copies;
+	delete [] texts;
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTextThreadedCopyTest,
+	"StarshatterWars.Foundation.Text.ThreadedCopies",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FTextThreadedCopyTest::RunTest(const FString& Parameters)
+{
+	const int TASKS = 32;
+
+	Text shared[SHARED];
+	MakeShared(shared);
+
+	CopyBatch serial;
+	serial.shared = shared;
+	serial.rounds = 2000;
+
+	TaskPool one(1);
+	one.Run(TASKS, CopyTask, &serial);
+
+	CopyBatch threaded = serial;
+	TaskPool  pool(0);
+
+	int b0 = Blocks();
+	pool.Run(TASKS, CopyTask, &threaded);
+
+	TestEqual(TEXT("threaded copies allocate nothing"), Blocks() - b0, 0);
+
+	bool same = true;
+	for (int i = 0; i < TASKS; i++)
+		if (threaded.sums[i] != serial.sums[i])
+			same = false;
+
+	TestTrue(TEXT("threaded copies read the same text"), same);
+
+	// every task has dropped its references again, so the shared
+	// reps are still intact and still the only owners:
+	Text check[SHARED];
+	MakeShared(check);
+
+	bool intact = true;
+	for (int i = 0; i < SHARED; i++)
+		if (shared[i] != check[i] || shared[i].hash() != check[i].hash())
+			intact = false;
+
+	TestTrue(TEXT("shared reps intact"), intact);
+
+	// a write now must not clone, or a reference was leaked:
+	b0 = Blocks();
+	shared[1][0] = '#';
+	TestEqual(TEXT("sole owner writes in place"), Blocks() - b0, 0);
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTextBenchmarkTest,
+	"StarshatterWars.Foundation.Text.Benchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FTextBenchmarkTest::RunTest(const FString& Parameters)
+{
+	static const int THREADS[] = { 1, 2, 4, 8 };
+
+	const int ROUNDS = 20000;
+
+	Text shared[SHARED];
+	MakeShared(shared);
+
+	for (int t = 0; t < UE_ARRAY_COUNT(THREADS); t++) {
+		const int N = THREADS[t];
+
+		CopyBatch batch;
+		batch.shared = shared;
+		batch.rounds = ROUNDS;
+
+		TaskPool pool(N);
+
+		double t0 = FPlatformTime::Seconds();
+		pool.Run(N, CopyTask, &batch);
+		double t1 = FPlatformTime::Seconds();
+
+		// one assignment, one copy and one destruction per step:
+		double copies = (double)N * ROUNDS * LOCALS * 2;
+
+		AddInfo(FString::Printf(
+			TEXT("Text copy/destroy, %d threads: %.1f ms, %.1f M copies per second, %.1f ns per copy per thread"),
+			N,
+			(t1 - t0) * 1e3,
+			copies / (t1 - t0) * 1e-6,
+			(t1 - t0) * 1e9 * N / copies));
+	}
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,185 @@
+/*  Project Starshatter Wars
+	Fractal Dev Games
+	Copyright (C) 2024. All Rights Reserved.
+
+	SUBSYSTEM:    Tests
+	FILE:         WeightedSamplerTests.cpp
+	AUTHOR:       Carlos Bott
+
+	OVERVIEW
+	========
+	Automation tests for WeightedSampler: draws land on each slot in
+	proportion to its weight (chi-square against the weights), slots
+	with zero weight are never drawn, and a benchmark of table builds
+	and draws against a linear scan of the weights.
+*/
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "../Foundation/WeightedSampler.h"
+#include "../Foundation/Random.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// +--------------------------------------------------------------------+
+
+namespace
+{
+	int LinearFind(const int* weights, int count, int point)
+	{
+		for (int i = 0; i < count; i++) {
+			if (point < weights[i])
+				return i;
+
+			point -= weights[i];
+		}
+
+		return -1;
+	}
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWeightedSamplerDistributionTest,
+	"StarshatterWars.Foundation.WeightedSampler.Distribution",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FWeightedSamplerDistributionTest::RunTest(const FString& Parameters)
+{
+	// campaign sized weights, so the total is far past 15 bits,
+	// with a few struck out slots mixed in:
+	static const int WEIGHTS[] = {
+		15000,     0, 25000,  5000,   400, 10000,     0,  8000,
+		  200, 50000,  2500,     0,  1000, 20000,  3000,   100
+	};
+
+	const int SLOTS = UE_ARRAY_COUNT(WEIGHTS);
+	const int DRAWS = 1000000;
+
+	WeightedSampler sampler;
+	sampler.Reset(SLOTS);
+
+	int total = 0;
+	for (int i = 0; i < SLOTS; i++) {
+		sampler.SetWeight(i, WEIGHTS[i]);
+		total += WEIGHTS[i];
+	}
+
+	TestEqual(TEXT("total"), sampler.Total(), total);
+
+	// every point maps to the slot a linear scan finds:
+	bool exact = true;
+	for (int p = 0; p < total; p++)
+		if (sampler.Find(p) != LinearFind(WEIGHTS, SLOTS, p))
+			exact = false;
+
+	TestTrue(TEXT("Find matches a linear scan"), exact);
+
+	int hits[SLOTS] = { 0 };
+	RandomStream rng(0x5eed);
+
+	for (int n = 0; n < DRAWS; n++)
+		hits[sampler.Find((int)(rng.Next() % (uint64)total))]++;
+
+	double chi2    = 0;
+	int    nonzero = 0;
+	bool   struck  = false;
+
+	for (int i = 0; i < SLOTS; i++) {
+		if (WEIGHTS[i] == 0) {
+			if (hits[i])
+				struck = true;
+			continue;
+		}
+
+		double expect = (double)DRAWS * WEIGHTS[i] / total;
+		double diff   = hits[i] - expect;
+
+		chi2 += diff * diff / expect;
+		nonzero++;
+	}
+
+	TestFalse(TEXT("zero weight slots are never drawn"), struck);
+
+	// 12 degrees of freedom; 32.91 is the 0.999 quantile, so a fair
+	// sampler fails this one run in a thousand, and the seed is fixed:
+	TestEqual(TEXT("weighted slots"), nonzero, 13);
+	TestTrue(FString::Printf(TEXT("chi-square %.2f below 32.91"), chi2), chi2 < 32.91);
+
+	// striking a slot moves its share to the others:
+	sampler.SetWeight(9, 0);
+	TestEqual(TEXT("total after strike"), sampler.Total(), total - WEIGHTS[9]);
+
+	bool moved = true;
+	for (int p = 0; p < sampler.Total(); p++)
+		if (sampler.Find(p) == 9)
+			moved = false;
+
+	TestTrue(TEXT("struck slot is never found"), moved);
+
+	sampler.Clear();
+	TestEqual(TEXT("empty sampler"), sampler.Find(0), -1);
+	return true;
+}
+
+// +--------------------------------------------------------------------+
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWeightedSamplerBenchmarkTest,
+	"StarshatterWars.Foundation.WeightedSampler.Benchmark",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FWeightedSamplerBenchmarkTest::RunTest(const FString& Parameters)
+{
+	static const int SIZES[] = { 100, 1000, 10000 };
+
+	const int DRAWS = 100000;
+
+	for (int s = 0; s < UE_ARRAY_COUNT(SIZES); s++) {
+		const int COUNT = SIZES[s];
+
+		int*         weights = new int[COUNT];
+		RandomStream rng(COUNT);
+
+		for (int i = 0; i < COUNT; i++)
+			weights[i] = 10 + (int)(rng.Next() % 5000);
+
+		double t0 = FPlatformTime::Seconds();
+
+		WeightedSampler sampler;
+		sampler.Reset(COUNT);
+		for (int i = 0; i < COUNT; i++)
+			sampler.SetWeight(i, weights[i]);
+
+		double t1 = FPlatformTime::Seconds();
+
+		uint64 total = (uint64)sampler.Total();
+		int    check = 0;
+
+		for (int n = 0; n < DRAWS; n++)
+			check += sampler.Find((int)(rng.Next() % total));
+
+		double t2 = FPlatformTime::Seconds();
+
+		for (int n = 0; n < DRAWS; n++)
+			check -= LinearFind(weights, COUNT, (int)(rng.Next() % total));
+
+		double t3 = FPlatformTime::Seconds();
+
+		AddInfo(FString::Printf(
+			TEXT("WeightedSampler %5d: build %.3f ms, %d draws %.3f ms, linear scan %.3f ms"),
+			COUNT,
+			(t1 - t0) * 1e3,
+			DRAWS,
+			(t2 - t1) * 1e3,
+			(t3 - t2) * 1e3));
+
+		// keeps the draws from being optimized away:
+		TestTrue(TEXT("draws ran"), check != 0x7fffffff);
+
+		delete [] weights;
+	}
+
+	return true;
+}
+
+#endif